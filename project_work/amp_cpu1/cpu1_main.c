@@ -0,0 +1,58 @@
+/**
+ * @file cpu1_main.c
+ * @brief AMP mode, CPU1: the bare-metal control / plant loop.
+ *
+ * No RTOS and no interrupts, nothing else runs on this core. The loop waits for the
+ * mailbox CPU0 sets up in AmpLink_Start(), then runs AmpLoop_Step() every control
+ * interval, paced by busy-waiting on the global timer, which CPU0 owns (the BSP of this
+ * core is built with USE_AMP=1 so it doesn't reset it). Built as its own application on
+ * a ps7_cortexa9_1 BSP, see the README.
+ */
+
+#include "amp_mailbox.h"
+#include "amp_loop.h"
+
+/* Xilinx includes. */
+#include "xil_mmu.h"
+#include "xtime_l.h"
+
+static AmpLoop_t loop;
+
+int main(void)
+{
+	AmpMailbox_t *mailbox;
+	const PIDGains_t no_gains = { 0, 0, 0 };	// CPU0 sends the gains in its first period
+	const XTime interval = COUNTS_PER_SECOND / 1000 * PID_SAMPLE_TIME_MS;
+	XTime next;
+	XTime now;
+
+	// Same mapping as on CPU0, see AmpLink_Start.
+	Xil_SetTlbAttributes(AMP_MAILBOX_BASE, NORM_NONCACHE);
+
+	while ((mailbox = AmpMailbox_Attach((void *)AMP_MAILBOX_BASE)) == NULL)
+	{
+	}
+
+	AmpLoop_Init(&loop, &no_gains);
+	__atomic_store_n(&mailbox->cpu1_ready, 1, __ATOMIC_RELEASE);
+
+	XTime_GetTime(&next);
+	for (;;)
+	{
+		AmpLoop_Step(&loop, mailbox);
+
+		next += interval;
+		XTime_GetTime(&now);
+		if (now >= next)
+		{
+			// Step took longer than the interval: count it and start over from now.
+			__atomic_store_n(&mailbox->overruns, mailbox->overruns + 1, __ATOMIC_RELAXED);
+			next = now;
+			continue;
+		}
+		while (now < next)
+		{
+			XTime_GetTime(&now);
+		}
+	}
+}
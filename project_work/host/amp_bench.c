@@ -0,0 +1,192 @@
+/**
+ * @file amp_bench.c
+ * @brief AMP mailbox on Linux: two threads stand in for the two cores.
+ *
+ * Usage:
+ *   amp_bench [-n round_trips] [-t seconds]
+ *
+ * The "CPU1" thread runs AmpLoop_Step back to back, the main thread plays CPU0.
+ * Each thread is pinned to its own CPU when there are at least two; otherwise they
+ * share one and yield to each other while polling, which makes the latencies
+ * scheduler bound (a warning is printed).
+ *
+ * Round trip: CPU0 sends a setpoint and polls the telemetry until a record echoes its
+ * seq. Throughput: telemetry records per second CPU0 drains while CPU1 free-runs.
+ */
+
+#define _GNU_SOURCE
+#include "amp_mailbox.h"
+#include "amp_loop.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+
+static AmpMailbox_t shared __attribute__((aligned(SPSC_CACHE_LINE)));
+static volatile bool stop = false;
+static bool pinned = false;
+
+static double now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void pin(int cpu)
+{
+	cpu_set_t set;
+
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+	{
+		fprintf(stderr, "could not pin to CPU %d\n", cpu);
+	}
+}
+
+/// @brief Poll loop body. Spins when pinned, lets the other thread run otherwise.
+static void relax(void)
+{
+	if (!pinned)
+	{
+		sched_yield();
+	}
+}
+
+static int compare_double(const void *a, const void *b)
+{
+	double x = *(const double *)a;
+	double y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+static void *cpu1_thread(void *arg)
+{
+	AmpLoop_t loop;
+	AmpMailbox_t *mailbox;
+	const PIDGains_t gains = { 4.5f, 6.0f, 0.01f };
+
+	(void)arg;
+	if (pinned)
+	{
+		pin(1);
+	}
+	while ((mailbox = AmpMailbox_Attach(&shared)) == NULL)
+	{
+		relax();
+	}
+
+	AmpLoop_Init(&loop, &gains);
+	__atomic_store_n(&mailbox->cpu1_ready, 1, __ATOMIC_RELEASE);
+
+	while (!__atomic_load_n(&stop, __ATOMIC_ACQUIRE))
+	{
+		AmpLoop_Step(&loop, mailbox);
+		relax();
+	}
+	return NULL;
+}
+
+int main(int argc, char **argv)
+{
+	long round_trips = 100000;
+	double seconds = 1.0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:t:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'n': round_trips = atol(optarg); break;
+		case 't': seconds = atof(optarg); break;
+		default:
+			fprintf(stderr, "usage: %s [-n round_trips] [-t seconds]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (round_trips < 1 || !(seconds > 0))
+	{
+		fprintf(stderr, "invalid arguments\n");
+		return 2;
+	}
+
+	pinned = sysconf(_SC_NPROCESSORS_ONLN) >= 2;
+	if (pinned)
+	{
+		pin(0);
+	}
+	else
+	{
+		fprintf(stderr, "warning: only one CPU, threads are not pinned and latencies are scheduler bound\n");
+	}
+
+	AmpMailbox_t *mailbox = AmpMailbox_Init(&shared);
+	pthread_t cpu1;
+	pthread_create(&cpu1, NULL, cpu1_thread, NULL);
+	while (!__atomic_load_n(&mailbox->cpu1_ready, __ATOMIC_ACQUIRE))
+	{
+		relax();
+	}
+
+	// Round trip: setpoint out, echoed seq back.
+	double *latency = malloc(round_trips * sizeof(double));
+	AmpTelemetry_t telemetry;
+
+	for (long i = 0; i < round_trips; i++)
+	{
+		AmpSetpoint_t setpoint = { (u32)i + 1, 1, 200.0f + (i & 1) };
+		bool echoed = false;
+		double t0 = now_ns();
+
+		while (!AmpMailbox_SendSetpoint(mailbox, &setpoint))
+		{
+			relax();
+		}
+		while (!echoed)
+		{
+			while (AmpMailbox_ReceiveTelemetry(mailbox, &telemetry))
+			{
+				echoed |= (telemetry.seq == setpoint.seq);
+			}
+			if (!echoed)
+			{
+				relax();
+			}
+		}
+		latency[i] = now_ns() - t0;
+	}
+	qsort(latency, round_trips, sizeof(double), compare_double);
+	printf("round trip (%ld): p50 %.0f ns  p99 %.0f ns  max %.0f ns\n", round_trips,
+		   latency[round_trips / 2], latency[round_trips * 99 / 100], latency[round_trips - 1]);
+	free(latency);
+
+	// Throughput: drain telemetry while CPU1 free-runs.
+	u32 steps_start = __atomic_load_n(&mailbox->heartbeat, __ATOMIC_ACQUIRE);
+	u32 dropped_start = mailbox->telemetry_dropped;
+	long received = 0;
+	double t0 = now_ns();
+	double elapsed;
+
+	while ((elapsed = now_ns() - t0) < seconds * 1e9)
+	{
+		while (AmpMailbox_ReceiveTelemetry(mailbox, &telemetry))
+		{
+			received++;
+		}
+		relax();
+	}
+	u32 steps = __atomic_load_n(&mailbox->heartbeat, __ATOMIC_ACQUIRE) - steps_start;
+	u32 dropped = mailbox->telemetry_dropped - dropped_start;
+
+	__atomic_store_n(&stop, true, __ATOMIC_RELEASE);
+	pthread_join(cpu1, NULL);
+
+	printf("throughput: %.0f steps/s on CPU1, %.0f records/s drained, %u dropped (%.2f %%)\n",
+		   steps / elapsed * 1e9, received / elapsed * 1e9, dropped, steps ? 100.0 * dropped / steps : 0.0);
+	printf("last record: step %u  u_ref %.1f V  u_meas %.2f V  u_out %.2f V\n",
+		   telemetry.step, telemetry.u_ref, telemetry.u_meas, telemetry.u_out);
+	return 0;
+}
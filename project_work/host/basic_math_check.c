@@ -0,0 +1,189 @@
+/**
+ * @file basic_math_check.c
+ * @brief Checks the f32 BasicMathFunctions of the linked CMSIS-DSP build against plain C loops.
+ *
+ * Usage:
+ *   basic_math_check
+ *
+ * Runs every kernel with an x86 variant (ARM_MATH_SSE / ARM_MATH_AVX2) on all lengths up
+ * to 70, a few long ones and 1M, at every float misalignment of a 32 byte vector, on
+ * random data mixed with NaN, infinities, signed zeros and denormals. The element-wise
+ * kernels must match the loops bit for bit. arm_dot_prod_f32 sums in a different order:
+ * it must be within n * FLT_EPSILON * sum(|a * b|) of the exact (double) dot product.
+ * With DISPATCH every variant the CPU supports is checked.
+ * Exits 1 on the first mismatch.
+ */
+
+#include "arm_math.h"
+#if defined(ARM_MATH_DISPATCH)
+#include "arm_x86_dispatch.h"
+#endif
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LEN		(1u << 20)
+#define MISALIGN	8		// Float offsets tried, one AVX2 vector
+
+static float32_t *a, *b, *out, *ref;
+static uint64_t seed = 0x9E3779B97F4A7C15ull;
+static unsigned long checks;
+
+static uint32_t random_u32(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (uint32_t)(seed >> 32);
+}
+
+/// @brief Random values in [-4, 4), with special values every few elements if requested.
+static void fill(float32_t *x, uint32_t len, int specials)
+{
+	static const float32_t special[] = { NAN, -NAN, INFINITY, -INFINITY, 0.0f, -0.0f,
+										 FLT_MIN / 4, -FLT_MIN / 4, FLT_MAX, -FLT_MAX };
+
+	for (uint32_t i = 0; i < len; i++)
+	{
+		if (specials && random_u32() % 7 == 0)
+		{
+			x[i] = special[random_u32() % (sizeof(special) / sizeof(special[0]))];
+		}
+		else
+		{
+			x[i] = ((float32_t)(random_u32() >> 8) / 16777216.0f - 0.5f) * 8.0f;
+		}
+	}
+}
+
+static int same_bits(const float32_t *x, const float32_t *y, uint32_t len, const char *name, uint32_t n, uint32_t offset)
+{
+	checks++;
+	if (memcmp(x, y, len * sizeof(float32_t)) == 0)
+	{
+		return 1;
+	}
+	for (uint32_t i = 0; i < len; i++)
+	{
+		if (memcmp(&x[i], &y[i], sizeof(float32_t)) != 0)
+		{
+			fprintf(stderr, "%s: n %u offset %u: element %u is %a, expected %a\n", name, n, offset, i, x[i], y[i]);
+			break;
+		}
+	}
+	return 0;
+}
+
+static int check_elementwise(uint32_t n, uint32_t offset, int specials)
+{
+	const float32_t *pa = a + offset;
+	const float32_t *pb = b + offset;
+	float32_t *po = out + offset;
+	int ok = 1;
+
+	fill(a + offset, n, specials);
+	fill(b + offset, n, specials);
+
+#define CHECK(name, call, expr)							\
+	do {												\
+		for (uint32_t i = 0; i < n; i++)				\
+		{												\
+			ref[i] = (expr);							\
+		}												\
+		call;											\
+		ok &= same_bits(po, ref, n, name, n, offset);	\
+	} while (0)
+
+	CHECK("arm_abs_f32", arm_abs_f32(pa, po, n), fabsf(pa[i]));
+	CHECK("arm_negate_f32", arm_negate_f32(pa, po, n), -pa[i]);
+	CHECK("arm_offset_f32", arm_offset_f32(pa, 0.3f, po, n), pa[i] + 0.3f);
+	CHECK("arm_scale_f32", arm_scale_f32(pa, -1.7f, po, n), pa[i] * -1.7f);
+	CHECK("arm_add_f32", arm_add_f32(pa, pb, po, n), pa[i] + pb[i]);
+	CHECK("arm_sub_f32", arm_sub_f32(pa, pb, po, n), pa[i] - pb[i]);
+	CHECK("arm_mult_f32", arm_mult_f32(pa, pb, po, n), pa[i] * pb[i]);
+	CHECK("arm_clip_f32", arm_clip_f32(pa, po, -1.0f, 2.5f, n),
+		  pa[i] > 2.5f ? 2.5f : (pa[i] < -1.0f ? -1.0f : pa[i]));
+#undef CHECK
+
+	return ok;
+}
+
+static int check_dot_prod(uint32_t n, uint32_t offset)
+{
+	const float32_t *pa = a + offset;
+	const float32_t *pb = b + offset;
+	double exact = 0;
+	double magnitude = 0;
+	float32_t result;
+
+	fill(a + offset, n, 0);
+	fill(b + offset, n, 0);
+	for (uint32_t i = 0; i < n; i++)
+	{
+		// float * float is exact in double
+		exact += (double)pa[i] * pb[i];
+		magnitude += fabs((double)pa[i] * pb[i]);
+	}
+	arm_dot_prod_f32(pa, pb, n, &result);
+
+	checks++;
+	double bound = (double)n * FLT_EPSILON * magnitude;
+	if (fabs(result - exact) > bound)
+	{
+		fprintf(stderr, "arm_dot_prod_f32: n %u offset %u: %.9g, exact %.9g, error %.3g > %.3g\n",
+				n, offset, result, exact, fabs(result - exact), bound);
+		return 0;
+	}
+	return 1;
+}
+
+/// @brief All lengths at all offsets, for the variant in use.
+static int check_all(void)
+{
+	static const uint32_t long_lengths[] = { 255, 256, 257, 1000, 4097, 65536 + 13, MAX_LEN - MISALIGN };
+	int ok = 1;
+
+	for (uint32_t offset = 0; offset < MISALIGN && ok; offset++)
+	{
+		for (uint32_t n = 0; n <= 70 && ok; n++)
+		{
+			ok = check_elementwise(n, offset, 0) && check_elementwise(n, offset, 1) && check_dot_prod(n, offset);
+		}
+		for (uint32_t k = 0; k < sizeof(long_lengths) / sizeof(long_lengths[0]) && ok; k++)
+		{
+			uint32_t n = long_lengths[k];
+			ok = check_elementwise(n, offset, 1) && check_dot_prod(n, offset);
+		}
+	}
+	return ok;
+}
+
+int main(void)
+{
+	a = malloc((MAX_LEN + MISALIGN) * sizeof(float32_t));
+	b = malloc((MAX_LEN + MISALIGN) * sizeof(float32_t));
+	out = malloc((MAX_LEN + MISALIGN) * sizeof(float32_t));
+	ref = malloc(MAX_LEN * sizeof(float32_t));
+	if (a == NULL || b == NULL || out == NULL || ref == NULL)
+	{
+		fprintf(stderr, "out of memory\n");
+		return 2;
+	}
+
+#if defined(ARM_MATH_DISPATCH)
+	int ok = 1;
+	for (int isa = ARM_X86_ISA_SCALAR; isa <= (int)arm_x86_dispatch_detect() && ok; isa++)
+	{
+		arm_x86_dispatch_select((arm_x86_isa)isa);
+		printf("checking %s\n", arm_x86_dispatch_name((arm_x86_isa)isa));
+		ok = check_all();
+	}
+#else
+	int ok = check_all();
+#endif
+
+	printf("%s: %lu checks\n", ok ? "ok" : "FAILED", checks);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+/**
+ * @file boot_check.c
+ * @brief Compares the boot profiles of two UART captures.
+ *
+ * Usage:
+ *   boot_check [-p percent] [-a us] baseline.log current.log
+ *
+ * Reads the "BOOT,<phase>,<us>,+<us>" lines the target prints after boot (or on the
+ * UART 'boot' command) and compares every phase of the current run with the baseline.
+ * A phase regresses when it ends more than percent (default 10) and more than us
+ * (default 200) later than in the baseline. Exit status 1 if any phase regressed or
+ * went missing, so it can gate a hardware-in-the-loop run.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_PHASES	32
+#define MAX_NAME	48
+
+typedef struct {
+	char name[MAX_NAME];
+	long us;
+} Phase_t;
+
+/// @brief The last profile in the capture, a reprint with 'boot' replaces the earlier one.
+static int load(const char *path, Phase_t *phases)
+{
+	char line[256];
+	int count = 0;
+	FILE *file = fopen(path, "r");
+
+	if (file == NULL)
+	{
+		perror(path);
+		return -1;
+	}
+	while (fgets(line, sizeof(line), file) != NULL)
+	{
+		char *start = strstr(line, "BOOT,");
+		char name[MAX_NAME];
+		long us;
+
+		if (start == NULL || sscanf(start, "BOOT,%47[^,],%ld", name, &us) != 2)
+		{
+			continue;
+		}
+		if (strcmp(name, "main") == 0)
+		{
+			count = 0;		// First mark, a new profile starts
+		}
+		if (count < MAX_PHASES)
+		{
+			strcpy(phases[count].name, name);
+			phases[count].us = us;
+			count++;
+		}
+	}
+	fclose(file);
+	return count;
+}
+
+int main(int argc, char **argv)
+{
+	static Phase_t baseline[MAX_PHASES];
+	static Phase_t current[MAX_PHASES];
+	double percent = 10;
+	long slack_us = 200;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "p:a:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'p': percent = atof(optarg); break;
+		case 'a': slack_us = atol(optarg); break;
+		default:
+			optind = argc;
+			break;
+		}
+	}
+	if (argc - optind != 2)
+	{
+		fprintf(stderr, "usage: %s [-p percent] [-a us] baseline.log current.log\n", argv[0]);
+		return 2;
+	}
+
+	int baseline_count = load(argv[optind], baseline);
+	int current_count = load(argv[optind + 1], current);
+	if (baseline_count <= 0 || current_count < 0)
+	{
+		fprintf(stderr, "no boot profile in the baseline\n");
+		return 2;
+	}
+
+	int regressions = 0;
+	printf("%-24s %10s %10s %8s\n", "phase", "base us", "now us", "change");
+	for (int i = 0; i < baseline_count; i++)
+	{
+		const Phase_t *base = &baseline[i];
+		const Phase_t *now = NULL;
+
+		for (int k = 0; k < current_count; k++)
+		{
+			if (strcmp(current[k].name, base->name) == 0)
+			{
+				now = &current[k];
+				break;
+			}
+		}
+		if (now == NULL)
+		{
+			printf("%-24s %10ld %10s  MISSING\n", base->name, base->us, "-");
+			regressions++;
+			continue;
+		}
+
+		long diff = now->us - base->us;
+		double change = base->us > 0 ? 100.0 * diff / base->us : 0;
+		int regressed = diff > slack_us && change > percent;
+
+		printf("%-24s %10ld %10ld %+7.1f%%%s\n", base->name, base->us, now->us, change, regressed ? "  REGRESSED" : "");
+		regressions += regressed;
+	}
+	return regressions ? 1 : 0;
+}
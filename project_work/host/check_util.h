@@ -0,0 +1,106 @@
+/**
+ * @file check_util.h
+ * @brief Random inputs, error measures and failure reports shared by the CMSIS-DSP checks.
+ *
+ * Each check is one source file that includes this header: the functions are static so
+ * that every tool keeps its own seed and check counter, and draws the same inputs from
+ * run to run. A failure prints what was checked, the configuration given in printf
+ * style and the values found, on stderr.
+ */
+
+#ifndef CHECK_UTIL_H
+#define CHECK_UTIL_H
+
+#include "arm_math.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#define MAX_ERROR	1e-6	// Relative RMS error, a few float epsilons
+
+static uint64_t seed = 0x9E3779B97F4A7C15ull;
+static unsigned checks;
+
+/// @brief Next value of a xorshift64 generator.
+static inline uint64_t random_bits(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return seed;
+}
+
+/// @brief Uniform in [-0.5, 0.5), 24 bits so that the float is exact.
+static inline float32_t random_value(void)
+{
+	return (float32_t)(random_bits() >> 40) / 16777216.0f - 0.5f;
+}
+
+/// @brief RMS of (a - b) relative to the RMS of b, over len values.
+static inline double relative_error(const float32_t *a, const double *b, uint32_t len)
+{
+	double err = 0, norm = 0;
+
+	for (uint32_t i = 0; i < len; i++)
+	{
+		err += (a[i] - b[i]) * (a[i] - b[i]);
+		norm += b[i] * b[i];
+	}
+	return sqrt(err / (norm > 0 ? norm : 1));
+}
+
+/// @brief relative_error against a float reference, e.g. the output of another function.
+static inline double relative_error_f32(const float32_t *a, const float32_t *b, uint32_t len)
+{
+	double err = 0, norm = 0;
+
+	for (uint32_t i = 0; i < len; i++)
+	{
+		double e = (double)a[i] - b[i];
+		err += e * e;
+		norm += (double)b[i] * b[i];
+	}
+	return sqrt(err / (norm > 0 ? norm : 1));
+}
+
+/// @brief Counts a check that error is at most limit, and prints it when it is not.
+/// @return 1 if it passed.
+static inline int __attribute__((format(printf, 4, 5)))
+report(const char *what, double error, double limit, const char *config, ...)
+{
+	va_list args;
+
+	checks++;
+	if (!(error <= limit))
+	{
+		fprintf(stderr, "%s: ", what);
+		va_start(args, config);
+		vfprintf(stderr, config, args);
+		va_end(args);
+		fprintf(stderr, ": relative error %.3g > %.3g\n", error, limit);
+		return 0;
+	}
+	return 1;
+}
+
+/// @brief Counts a check that a function returned the expected status, and prints it when it did not.
+/// @return 1 if it passed.
+static inline int __attribute__((format(printf, 4, 5)))
+check_status(const char *what, arm_status status, arm_status expected, const char *config, ...)
+{
+	va_list args;
+
+	checks++;
+	if (status != expected)
+	{
+		fprintf(stderr, "%s: ", what);
+		va_start(args, config);
+		vfprintf(stderr, config, args);
+		va_end(args);
+		fprintf(stderr, ": status %d, expected %d\n", status, expected);
+		return 0;
+	}
+	return 1;
+}
+
+#endif
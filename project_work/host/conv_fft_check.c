@@ -0,0 +1,161 @@
+/**
+ * @file conv_fft_check.c
+ * @brief Checks the FFT convolution and correlation of the linked CMSIS-DSP build against the sums in double.
+ *
+ * Usage:
+ *   conv_fft_check
+ *
+ * Pairs of lengths from 1 to 5000 samples, either one the longer: arm_conv_fft_f32,
+ * arm_correlate_fft_f32 and the auto versions must match the convolution / correlation
+ * computed in double within MAX_ERROR (relative RMS), arm_correlate_f32 too, so that the
+ * reference has its layout. The zero padding of the correlations must be written, and
+ * lengths the FFT versions can't take rejected. Then arm_conv_fft_calibrate_f32 with
+ * the monotonic clock: the ratio it measures is printed. Exits 1 on the first failure.
+ */
+
+#include "arm_math.h"
+#include "check_util.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_LEN			5000
+#define SCRATCH_LEN		(3 * 4096)
+
+static float32_t a[MAX_LEN], b[MAX_LEN], out[2 * MAX_LEN], scratch[SCRATCH_LEN];
+static double ref[2 * MAX_LEN];
+#if defined(ARM_FFT_RUNTIME_TABLES)
+static uint64_t tables_pool[128 * 1024 / sizeof(uint64_t)];
+#endif
+
+/// @brief out filled with NaNs, so that values the function does not write show up.
+static void poison(uint32_t len)
+{
+	for (uint32_t i = 0; i < len; i++)
+	{
+		out[i] = NAN;
+	}
+}
+
+/// @brief c[n] = sum a[k] b[n - k], and for correlations b reversed at the offset of arm_correlate_f32.
+static uint32_t reference(uint32_t aLen, uint32_t bLen, int correlate)
+{
+	const uint32_t convLen = aLen + bLen - 1;
+	const uint32_t len = correlate ? 2 * (aLen > bLen ? aLen : bLen) - 1 : convLen;
+	const uint32_t offset = (correlate && aLen > bLen) ? aLen - bLen : 0;
+
+	memset(ref, 0, len * sizeof(double));
+	for (uint32_t i = 0; i < aLen; i++)
+	{
+		for (uint32_t j = 0; j < bLen; j++)
+		{
+			ref[offset + i + j] += (double)a[i] * (correlate ? b[bLen - 1 - j] : b[j]);
+		}
+	}
+	return len;
+}
+
+static int check_pair(uint32_t aLen, uint32_t bLen)
+{
+	uint32_t len;
+
+	for (uint32_t i = 0; i < aLen; i++)
+	{
+		a[i] = random_value();
+	}
+	for (uint32_t i = 0; i < bLen; i++)
+	{
+		b[i] = random_value();
+	}
+
+	len = reference(aLen, bLen, 0);
+	poison(len);
+	if (!check_status("arm_conv_fft_f32", arm_conv_fft_f32(a, aLen, b, bLen, out, scratch), ARM_MATH_SUCCESS, "%u x %u", aLen, bLen)
+		|| !report("arm_conv_fft_f32", relative_error(out, ref, len), MAX_ERROR, "%u x %u", aLen, bLen))
+	{
+		return 0;
+	}
+	poison(len);
+	if (!check_status("arm_conv_auto_f32", arm_conv_auto_f32(a, aLen, b, bLen, out, scratch), ARM_MATH_SUCCESS, "%u x %u", aLen, bLen)
+		|| !report("arm_conv_auto_f32", relative_error(out, ref, len), MAX_ERROR, "%u x %u", aLen, bLen))
+	{
+		return 0;
+	}
+
+	len = reference(aLen, bLen, 1);
+	memset(out, 0, len * sizeof(float32_t));
+	arm_correlate_f32(a, aLen, b, bLen, out);
+	if (!report("arm_correlate_f32", relative_error(out, ref, len), MAX_ERROR, "%u x %u", aLen, bLen))
+	{
+		return 0;
+	}
+	poison(len);
+	if (!check_status("arm_correlate_fft_f32", arm_correlate_fft_f32(a, aLen, b, bLen, out, scratch), ARM_MATH_SUCCESS, "%u x %u", aLen, bLen)
+		|| !report("arm_correlate_fft_f32", relative_error(out, ref, len), MAX_ERROR, "%u x %u", aLen, bLen))
+	{
+		return 0;
+	}
+	poison(len);
+	return check_status("arm_correlate_auto_f32", arm_correlate_auto_f32(a, aLen, b, bLen, out, scratch), ARM_MATH_SUCCESS, "%u x %u", aLen, bLen)
+		&& report("arm_correlate_auto_f32", relative_error(out, ref, len), MAX_ERROR, "%u x %u", aLen, bLen);
+}
+
+static uint32_t clock_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+int main(void)
+{
+	static const uint32_t lengths[] = { 1, 2, 7, 31, 64, 100, 1024, 2048, 3000, 4096, MAX_LEN };
+	const uint32_t count = sizeof(lengths) / sizeof(lengths[0]);
+	int ok = 1;
+
+#if defined(ARM_FFT_RUNTIME_TABLES)
+	arm_fft_tables_pool_f32(tables_pool, sizeof(tables_pool));
+#endif
+	for (uint32_t i = 0; i < count && ok; i++)
+	{
+		for (uint32_t j = 0; j < count && ok; j++)
+		{
+			if (lengths[i] > 2048 && lengths[j] > 2048)
+			{
+				ok = check_status("arm_conv_fft_f32", arm_conv_fft_f32(a, lengths[i], b, lengths[j], out, scratch),
+								  ARM_MATH_ARGUMENT_ERROR, "%u x %u", lengths[i], lengths[j])
+					&& check_status("arm_correlate_fft_f32", arm_correlate_fft_f32(a, lengths[i], b, lengths[j], out, scratch),
+									ARM_MATH_ARGUMENT_ERROR, "%u x %u", lengths[i], lengths[j]);
+				continue;
+			}
+			ok = check_pair(lengths[i], lengths[j]);
+		}
+	}
+	ok = ok && check_status("arm_conv_fft_f32", arm_conv_fft_f32(a, 0, b, 16, out, scratch), ARM_MATH_ARGUMENT_ERROR, "0 x 16");
+
+	// Both paths of the auto versions: direct for short templates, FFT for long ones
+	for (uint32_t k = 0; k < 2 && ok; k++)
+	{
+		arm_conv_fft_set_ratio_f32(k ? 1e9f : 1e-9f);
+		ok = check_pair(4096, 1024) && check_pair(100, 4096);
+	}
+
+	if (ok)
+	{
+		float32_t ratio = arm_conv_fft_calibrate_f32(clock_ns, scratch);
+
+		printf("calibration: FFT work unit / direct multiply-accumulate %.3f\n", ratio);
+		checks++;
+		if (!(ratio > 0 && ratio < 1e9f))
+		{
+			fprintf(stderr, "arm_conv_fft_calibrate_f32: ratio %g\n", ratio);
+			ok = 0;
+		}
+	}
+
+	printf("%s: %u checks\n", ok ? "ok" : "FAILED", checks);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,232 @@
+/**
+ * @file dct_check.c
+ * @brief Checks the fast DCT-II / DCT-III / DCT-IV of the linked CMSIS-DSP build against the sums in double.
+ *
+ * Usage:
+ *   dct_check
+ *
+ * Every length from 32 to 4096: the f32 transforms must match the defining sums within
+ * MAX_ERROR and the q31 ones, divided by N, within MAX_ERROR_Q31 (relative RMS). The
+ * DCT-III of the DCT-II and the DCT-IV of the DCT-IV must give N/2 times the input back.
+ * Then arm_mfcc_f32 with the fast DCT against the same MFCC with the DCT matrix of the
+ * scripts. Unsupported lengths must be rejected. Exits 1 on the first failure.
+ */
+
+#include "arm_math.h"
+#include "check_util.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LEN			4096
+#define MAX_ERROR_Q31	1e-6	// Output divided by N: the 1.31 rounding is larger relative to it
+
+static float32_t x[MAX_LEN], out[MAX_LEN], back[MAX_LEN], tmp[2 * MAX_LEN];
+static float32_t twiddle[3 * MAX_LEN];
+static q31_t xq[MAX_LEN], outq[MAX_LEN], tmpq[2 * MAX_LEN], twiddleq[3 * MAX_LEN];
+static double ref[MAX_LEN], cos_table[8 * MAX_LEN];
+#if defined(ARM_FFT_RUNTIME_TABLES)
+static uint64_t tables_pool[128 * 1024 / sizeof(uint64_t)];
+#endif
+
+/// @brief cos(2 * pi * m / (8N)) for m = 0 .. 8N-1: every angle of the three DCTs by exact index.
+static void fill_cos_table(uint32_t n)
+{
+	for (uint32_t m = 0; m < 8 * n; m++)
+	{
+		cos_table[m] = cos(2.0 * M_PI * m / (8.0 * n));
+	}
+}
+
+/// @brief DCT-II (type 2), DCT-III (3) or DCT-IV (4) of in, from the definitions, in double.
+static void dct(int type, const float32_t *in, double *result, uint32_t n)
+{
+	for (uint32_t k = 0; k < n; k++)
+	{
+		double sum = (type == 3) ? in[0] / 2.0 : 0;
+
+		for (uint32_t t = (type == 3) ? 1 : 0; t < n; t++)
+		{
+			// type 2: pi (2t+1) k / 2N, type 3: pi (2k+1) t / 2N, type 4: pi (2t+1) (2k+1) / 4N
+			uint64_t m = (type == 2) ? 2 * (2 * (uint64_t)t + 1) * k
+					   : (type == 3) ? 2 * (2 * (uint64_t)k + 1) * t
+					   : (2 * (uint64_t)t + 1) * (2 * k + 1);
+			sum += in[t] * cos_table[m % (8 * n)];
+		}
+		result[k] = sum;
+	}
+}
+
+static int check_f32(uint32_t n)
+{
+	arm_dct_instance_f32 S;
+	double input[MAX_LEN];
+
+	if (arm_dct_init_f32(&S, n, twiddle) != ARM_MATH_SUCCESS)
+	{
+		fprintf(stderr, "arm_dct_init_f32: n %u rejected\n", n);
+		return 0;
+	}
+	for (uint32_t i = 0; i < n; i++)
+	{
+		x[i] = random_value();
+		input[i] = x[i];
+	}
+
+	dct(2, x, ref, n);
+	arm_dct2_f32(&S, x, out, tmp);
+	if (!report("arm_dct2_f32", relative_error(out, ref, n), MAX_ERROR, "n %u", n))
+	{
+		return 0;
+	}
+	arm_dct3_f32(&S, out, back, tmp);
+	arm_scale_f32(back, 2.0f / n, back, n);		// Exact, N a power of 2
+	if (!report("arm_dct3_f32 of arm_dct2_f32", relative_error(back, input, n), MAX_ERROR, "n %u", n))
+	{
+		return 0;
+	}
+
+	dct(3, x, ref, n);
+	arm_dct3_f32(&S, x, out, tmp);
+	if (!report("arm_dct3_f32", relative_error(out, ref, n), MAX_ERROR, "n %u", n))
+	{
+		return 0;
+	}
+
+	dct(4, x, ref, n);
+	arm_dct4_f32(&S, x, out, tmp);
+	if (!report("arm_dct4_f32", relative_error(out, ref, n), MAX_ERROR, "n %u", n))
+	{
+		return 0;
+	}
+	// In place
+	arm_dct4_f32(&S, out, out, tmp);
+	arm_scale_f32(out, 2.0f / n, out, n);
+	return report("arm_dct4_f32 of arm_dct4_f32", relative_error(out, input, n), MAX_ERROR, "n %u", n);
+}
+
+static int check_q31(uint32_t n)
+{
+	arm_dct_instance_q31 S;
+
+	if (arm_dct_init_q31(&S, n, twiddleq) != ARM_MATH_SUCCESS)
+	{
+		fprintf(stderr, "arm_dct_init_q31: n %u rejected\n", n);
+		return 0;
+	}
+	// Full scale
+	for (uint32_t i = 0; i < n; i++)
+	{
+		x[i] = 1.99f * random_value();
+	}
+	arm_float_to_q31(x, xq, n);
+	arm_q31_to_float(xq, x, n);
+
+	dct(2, x, ref, n);
+	arm_dct2_q31(&S, xq, outq, tmpq);
+	arm_q31_to_float(outq, out, n);
+	arm_scale_f32(out, (float32_t)n, out, n);	// Undo the 1/N, exact
+	if (!report("arm_dct2_q31", relative_error(out, ref, n), MAX_ERROR_Q31, "n %u", n))
+	{
+		return 0;
+	}
+
+	dct(4, x, ref, n);
+	arm_dct4_q31(&S, xq, xq, tmpq);
+	arm_q31_to_float(xq, out, n);
+	arm_scale_f32(out, (float32_t)n, out, n);
+	return report("arm_dct4_q31", relative_error(out, ref, n), MAX_ERROR_Q31, "n %u", n);
+}
+
+/// @brief arm_mfcc_f32 with the DCT matrix of the scripts, then with arm_mfcc_init_dct_f32.
+static int check_mfcc(uint32_t fft_len, uint32_t filters, uint32_t outputs)
+{
+	static float32_t dct_coefs[64 * 64], filter_coefs[4096], window[1024];
+	static float32_t src[1024], mfcc_tmp[2 * 1024], matrix_out[64], fast_out[64];
+	static uint32_t filter_pos[64], filter_lengths[64];
+	arm_mfcc_instance_f32 S;
+	arm_dct_instance_f32 D;
+	double expected[64];
+	uint32_t count = 0;
+
+	// Overlapping filters over the first half of the spectrum, any positive weights
+	for (uint32_t i = 0; i < filters; i++)
+	{
+		filter_pos[i] = i * (fft_len / 2 - 8) / filters;
+		filter_lengths[i] = 8;
+		for (uint32_t j = 0; j < 8; j++)
+		{
+			filter_coefs[count++] = 0.5f + random_value();
+		}
+	}
+	for (uint32_t i = 0; i < outputs; i++)
+	{
+		for (uint32_t j = 0; j < filters; j++)
+		{
+			dct_coefs[i * filters + j] = (float32_t)(cos(i * M_PI * (j + 0.5) / filters) * sqrt(2.0 / filters));
+		}
+	}
+	arm_hamming_f32(window, fft_len);
+	arm_dct_init_f32(&D, filters, twiddle);
+
+	if (arm_mfcc_init_f32(&S, fft_len, filters, outputs, dct_coefs, filter_pos, filter_lengths, filter_coefs, window) != ARM_MATH_SUCCESS)
+	{
+		fprintf(stderr, "arm_mfcc_init_f32: fft %u, %u filters rejected\n", fft_len, filters);
+		return 0;
+	}
+	for (uint32_t i = 0; i < fft_len; i++)
+	{
+		x[i] = random_value();
+	}
+	memcpy(src, x, fft_len * sizeof(float32_t));
+	arm_mfcc_f32(&S, src, matrix_out, mfcc_tmp);
+
+	checks++;
+	if (arm_mfcc_init_dct_f32(&S, &D) != ARM_MATH_SUCCESS)
+	{
+		fprintf(stderr, "arm_mfcc_init_dct_f32: fft %u, %u filters rejected\n", fft_len, filters);
+		return 0;
+	}
+	memcpy(src, x, fft_len * sizeof(float32_t));
+	arm_mfcc_f32(&S, src, fast_out, mfcc_tmp);
+
+	for (uint32_t i = 0; i < outputs; i++)
+	{
+		expected[i] = matrix_out[i];
+	}
+	return report("arm_mfcc_f32 fast DCT", relative_error(fast_out, expected, outputs), MAX_ERROR, "fft %u, %u filters", fft_len, filters);
+}
+
+int main(void)
+{
+	static const uint16_t rejected[] = { 0, 16, 48, 100, 8192 };
+	arm_dct_instance_f32 S;
+	arm_dct_instance_q31 Q;
+	int ok = 1;
+
+#if defined(ARM_FFT_RUNTIME_TABLES)
+	arm_fft_tables_pool_f32(tables_pool, sizeof(tables_pool));
+#endif
+	for (uint32_t k = 0; k < sizeof(rejected) / sizeof(rejected[0]) && ok; k++)
+	{
+		checks += 2;
+		if (arm_dct_init_f32(&S, rejected[k], twiddle) != ARM_MATH_ARGUMENT_ERROR
+			|| arm_dct_init_q31(&Q, rejected[k], twiddleq) != ARM_MATH_ARGUMENT_ERROR)
+		{
+			fprintf(stderr, "arm_dct_init: n %u accepted\n", rejected[k]);
+			ok = 0;
+		}
+	}
+
+	for (uint32_t n = 32; n <= MAX_LEN && ok; n <<= 1)
+	{
+		fill_cos_table(n);
+		ok = check_f32(n) && check_q31(n);
+	}
+
+	ok = ok && check_mfcc(256, 32, 13) && check_mfcc(1024, 64, 64);
+
+	printf("%s: %u checks\n", ok ? "ok" : "FAILED", checks);
+	return ok ? 0 : 1;
+}
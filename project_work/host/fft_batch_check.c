@@ -0,0 +1,145 @@
+/**
+ * @file fft_batch_check.c
+ * @brief Checks the multi-channel CFFT/RFFT of the linked CMSIS-DSP build against the single-channel transforms.
+ *
+ * Usage:
+ *   fft_batch_check
+ *
+ * Every CFFT length from 16 to 4096 (RFFT 32 to 4096) and 1, 2, 3, 8 and 64 channels:
+ * each channel of the interleaved and strided transforms, forward and inverse, must match
+ * arm_cfft_f32 / arm_rfft_fast_f32 of that channel alone within MAX_ERROR (relative RMS).
+ * Exits 1 on the first failure.
+ */
+
+#include "arm_math.h"
+#include "check_util.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LEN			4096
+#define MAX_CHANNELS	64
+
+static float32_t x[2 * MAX_LEN * MAX_CHANNELS], batch[2 * MAX_LEN * MAX_CHANNELS], out[2 * MAX_LEN * MAX_CHANNELS];
+static float32_t single[2 * MAX_LEN], single_out[2 * MAX_LEN], channel[2 * MAX_LEN];
+#if defined(ARM_FFT_RUNTIME_TABLES)
+static uint64_t tables_pool[128 * 1024 / sizeof(uint64_t)];
+#endif
+
+/// @brief Channel c of x, interleaved with channels in all, into a buffer of its own.
+static void channel_of(float32_t *dst, const float32_t *src, uint32_t len, uint32_t channels, uint32_t c)
+{
+	for (uint32_t j = 0; j < len; j++)
+	{
+		dst[j] = src[j * channels + c];
+	}
+}
+
+static int check_cfft(uint32_t n, uint32_t channels)
+{
+	arm_cfft_instance_f32 S;
+	const uint32_t len = 2 * n;
+	int ok = 1;
+
+	arm_cfft_init_f32(&S, n);
+	for (uint32_t i = 0; i < len * channels; i++)
+	{
+		x[i] = random_value();
+	}
+
+	for (uint8_t inverse = 0; inverse <= 1 && ok; inverse++)
+	{
+		memcpy(batch, x, len * channels * sizeof(float32_t));
+		arm_cfft_batch_f32(&S, batch, channels, inverse);
+
+		// Strided: the channels one after the other in out
+		for (uint32_t c = 0; c < channels; c++)
+		{
+			channel_of(out + c * len, x, len, channels, c);
+		}
+		arm_cfft_batch_strided_f32(&S, out, channels, len, inverse);
+
+		for (uint32_t c = 0; c < channels && ok; c++)
+		{
+			channel_of(single, x, len, channels, c);
+			arm_cfft_f32(&S, single, inverse, 1);
+			channel_of(channel, batch, len, channels, c);
+			ok = report(inverse ? "arm_cfft_batch_f32 inverse" : "arm_cfft_batch_f32",
+						relative_error_f32(channel, single, len), MAX_ERROR, "n %u, %u channels: channel %u", n, channels, c)
+				&& report(inverse ? "arm_cfft_batch_strided_f32 inverse" : "arm_cfft_batch_strided_f32",
+						  relative_error_f32(out + c * len, single, len), MAX_ERROR, "n %u, %u channels: channel %u", n, channels, c);
+		}
+	}
+	return ok;
+}
+
+static int check_rfft(uint32_t n, uint32_t channels)
+{
+	arm_rfft_fast_instance_f32 S;
+	int ok = 1;
+
+	arm_rfft_fast_init_f32(&S, n);
+	for (uint8_t inverse = 0; inverse <= 1 && ok; inverse++)
+	{
+		for (uint32_t i = 0; i < n * channels; i++)
+		{
+			x[i] = random_value();
+		}
+		if (inverse)
+		{
+			// A packed spectrum: X[0] and X[n/2] real
+			for (uint32_t c = 0; c < channels; c++)
+			{
+				x[c] = random_value();
+			}
+		}
+
+		memcpy(batch, x, n * channels * sizeof(float32_t));
+		arm_rfft_fast_batch_f32(&S, batch, out, channels, inverse);
+
+		for (uint32_t c = 0; c < channels && ok; c++)
+		{
+			channel_of(single, x, n, channels, c);
+			arm_rfft_fast_f32(&S, single, single_out, inverse);
+			channel_of(channel, out, n, channels, c);
+			ok = report(inverse ? "arm_rfft_fast_batch_f32 inverse" : "arm_rfft_fast_batch_f32",
+						relative_error_f32(channel, single_out, n), MAX_ERROR, "n %u, %u channels: channel %u", n, channels, c);
+		}
+
+		// Strided, into batch
+		for (uint32_t c = 0; c < channels; c++)
+		{
+			channel_of(out + c * n, x, n, channels, c);
+		}
+		arm_rfft_fast_batch_strided_f32(&S, out, batch, channels, n, inverse);
+		for (uint32_t c = 0; c < channels && ok; c++)
+		{
+			channel_of(single, x, n, channels, c);
+			arm_rfft_fast_f32(&S, single, single_out, inverse);
+			ok = report(inverse ? "arm_rfft_fast_batch_strided_f32 inverse" : "arm_rfft_fast_batch_strided_f32",
+						relative_error_f32(batch + c * n, single_out, n), MAX_ERROR, "n %u, %u channels: channel %u", n, channels, c);
+		}
+	}
+	return ok;
+}
+
+int main(void)
+{
+	static const uint32_t channel_counts[] = { 1, 2, 3, 8, MAX_CHANNELS };
+	int ok = 1;
+
+#if defined(ARM_FFT_RUNTIME_TABLES)
+	arm_fft_tables_pool_f32(tables_pool, sizeof(tables_pool));
+#endif
+	for (uint32_t k = 0; k < sizeof(channel_counts) / sizeof(channel_counts[0]) && ok; k++)
+	{
+		for (uint32_t n = 16; n <= MAX_LEN && ok; n <<= 1)
+		{
+			ok = check_cfft(n, channel_counts[k]) && (n < 32 || check_rfft(n, channel_counts[k]));
+		}
+	}
+
+	printf("%s: %u checks\n", ok ? "ok" : "FAILED", checks);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,171 @@
+/**
+ * @file fft_large_check.c
+ * @brief Checks the four-step CFFT/RFFT of the linked CMSIS-DSP build against an FFT in double.
+ *
+ * Usage:
+ *   fft_large_check
+ *
+ * Every power of two from 256 (512 for the RFFT) to 4M points: the forward CFFT must match the reference
+ * within MAX_ERROR (relative RMS), the inverse must give the input back, and the RFFT
+ * must match the reference of the same real data. Unsupported lengths must be rejected.
+ * Exits 1 on the first failure.
+ */
+
+#include "arm_math.h"
+#include "check_util.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LEN		(1U << 22)
+
+static float32_t *x, *buf, *out;
+static double *ref;
+static float32_t twiddle[8 * 4096];
+#if defined(ARM_FFT_RUNTIME_TABLES)
+static uint64_t tables_pool[128 * 1024 / sizeof(uint64_t)];	// Inner arm_cfft_f32 tables up to 4096
+#endif
+
+/// @brief Radix-2 FFT of n complex values in double, twiddles by exact index so its own error is negligible.
+static void fft_double(double *data, uint32_t n)
+{
+	for (uint32_t i = 1, j = 0; i < n; i++)
+	{
+		uint32_t bit = n >> 1;
+		for (; j & bit; bit >>= 1)
+		{
+			j ^= bit;
+		}
+		j |= bit;
+		if (i < j)
+		{
+			double re = data[2 * i], im = data[2 * i + 1];
+			data[2 * i] = data[2 * j];
+			data[2 * i + 1] = data[2 * j + 1];
+			data[2 * j] = re;
+			data[2 * j + 1] = im;
+		}
+	}
+	for (uint32_t len = 2; len <= n; len <<= 1)
+	{
+		for (uint32_t k = 0; k < len / 2; k++)
+		{
+			double wr = cos(2.0 * M_PI * k / len), wi = -sin(2.0 * M_PI * k / len);
+			for (uint32_t i = k; i < n; i += len)
+			{
+				double *a = data + 2 * i, *b = data + 2 * (i + len / 2);
+				double tr = b[0] * wr - b[1] * wi, ti = b[0] * wi + b[1] * wr;
+				b[0] = a[0] - tr;
+				b[1] = a[1] - ti;
+				a[0] += tr;
+				a[1] += ti;
+			}
+		}
+	}
+}
+
+static int check_cfft(uint32_t n)
+{
+	arm_cfft_4step_instance_f32 S;
+
+	if (arm_cfft_4step_init_f32(&S, n, twiddle) != ARM_MATH_SUCCESS)
+	{
+		fprintf(stderr, "arm_cfft_4step_init_f32: n %u rejected\n", n);
+		return 0;
+	}
+	for (uint32_t i = 0; i < 2 * n; i++)
+	{
+		x[i] = random_value();
+		ref[i] = x[i];
+	}
+
+	fft_double(ref, n);
+	memcpy(buf, x, 2 * n * sizeof(float32_t));
+	arm_cfft_4step_f32(&S, buf, out, 0);
+	if (!report("arm_cfft_4step_f32", relative_error(out, ref, 2 * n), MAX_ERROR, "n %u", n))
+	{
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < 2 * n; i++)
+	{
+		ref[i] = x[i];
+	}
+	arm_cfft_4step_f32(&S, out, buf, 1);
+	return report("arm_cfft_4step_f32 inverse", relative_error(buf, ref, 2 * n), MAX_ERROR, "n %u", n);
+}
+
+static int check_rfft(uint32_t n)
+{
+	arm_rfft_4step_instance_f32 S;
+
+	if (arm_rfft_4step_init_f32(&S, n, twiddle) != ARM_MATH_SUCCESS)
+	{
+		fprintf(stderr, "arm_rfft_4step_init_f32: n %u rejected\n", n);
+		return 0;
+	}
+
+	// Reference: the FFT of the real data as complex, packed like the RFFT output
+	for (uint32_t i = 0; i < n; i++)
+	{
+		x[i] = random_value();
+		ref[2 * i] = x[i];
+		ref[2 * i + 1] = 0;
+	}
+	fft_double(ref, n);
+	ref[1] = ref[n];
+
+	memcpy(buf, x, n * sizeof(float32_t));
+	arm_rfft_4step_f32(&S, buf, out, 0);
+	if (!report("arm_rfft_4step_f32", relative_error(out, ref, n), MAX_ERROR, "n %u", n))
+	{
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < n; i++)
+	{
+		ref[i] = x[i];
+	}
+	arm_rfft_4step_f32(&S, out, buf, 1);
+	return report("arm_rfft_4step_f32 inverse", relative_error(buf, ref, n), MAX_ERROR, "n %u", n);
+}
+
+int main(void)
+{
+	static const uint32_t rejected[] = { 0, 128, 3000, 65537, 1U << 25 };
+	arm_cfft_4step_instance_f32 S;
+	arm_rfft_4step_instance_f32 R;
+	int ok = 1;
+
+	x = malloc(2 * MAX_LEN * sizeof(float32_t));
+	buf = malloc(2 * MAX_LEN * sizeof(float32_t));
+	out = malloc(2 * MAX_LEN * sizeof(float32_t));
+	ref = malloc(2 * MAX_LEN * sizeof(double));
+	if (x == NULL || buf == NULL || out == NULL || ref == NULL)
+	{
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+
+#if defined(ARM_FFT_RUNTIME_TABLES)
+	arm_fft_tables_pool_f32(tables_pool, sizeof(tables_pool));
+#endif
+	for (uint32_t k = 0; k < sizeof(rejected) / sizeof(rejected[0]) && ok; k++)
+	{
+		checks++;
+		if (arm_cfft_4step_init_f32(&S, rejected[k], twiddle) != ARM_MATH_ARGUMENT_ERROR ||
+			arm_rfft_4step_init_f32(&R, 2 * rejected[k], twiddle) != ARM_MATH_ARGUMENT_ERROR)
+		{
+			fprintf(stderr, "arm_cfft_4step_init_f32: n %u accepted\n", rejected[k]);
+			ok = 0;
+		}
+	}
+	for (uint32_t n = 256; n <= MAX_LEN && ok; n *= 2)
+	{
+		ok = check_cfft(n) && (n < 512 || check_rfft(n));
+	}
+
+	printf("%s: %u checks\n", ok ? "ok" : "FAILED", checks);
+	return ok ? 0 : 1;
+}
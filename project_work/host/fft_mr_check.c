@@ -0,0 +1,146 @@
+/**
+ * @file fft_mr_check.c
+ * @brief Checks the mixed-radix CFFT/RFFT of the linked CMSIS-DSP build against a DFT in double.
+ *
+ * Usage:
+ *   fft_mr_check
+ *
+ * Every supported length up to 512, then 1000, 3000, 4096, 4800 and 8192: the forward
+ * CFFT must match the DFT within MAX_ERROR (relative RMS), the inverse must give the
+ * input back, and the RFFT must match the CFFT of the same real data. Unsupported
+ * lengths must be rejected. Exits 1 on the first failure.
+ */
+
+#include "arm_math.h"
+#include "check_util.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LEN		8192
+
+static float32_t x[2 * MAX_LEN], buf[2 * MAX_LEN], out[2 * MAX_LEN];
+static float32_t twiddle[2 * MAX_LEN], scratch[2 * MAX_LEN];
+static double ref[2 * MAX_LEN];
+
+static int supported(uint32_t n)
+{
+	static const uint32_t primes[] = { 2, 3, 5, 7 };
+
+	for (uint32_t k = 0; k < 4; k++)
+	{
+		while (n > 1 && n % primes[k] == 0)
+		{
+			n /= primes[k];
+		}
+	}
+	return n == 1;
+}
+
+/// @brief DFT of n complex values, in double, twiddles by exact index so its own error is negligible.
+static void dft(const float32_t *in, double *result, uint32_t n)
+{
+	for (uint32_t k = 0; k < n; k++)
+	{
+		double re = 0, im = 0;
+		for (uint32_t t = 0; t < n; t++)
+		{
+			double theta = -2.0 * M_PI * (double)(((uint64_t)k * t) % n) / n;
+			re += in[2 * t] * cos(theta) - in[2 * t + 1] * sin(theta);
+			im += in[2 * t] * sin(theta) + in[2 * t + 1] * cos(theta);
+		}
+		result[2 * k] = re;
+		result[2 * k + 1] = im;
+	}
+}
+
+static int check_cfft(uint32_t n)
+{
+	arm_cfft_mr_instance_f32 S;
+	double input[2 * MAX_LEN];
+
+	if (arm_cfft_mr_init_f32(&S, n, twiddle, scratch) != ARM_MATH_SUCCESS)
+	{
+		fprintf(stderr, "arm_cfft_mr_init_f32: n %u rejected\n", n);
+		return 0;
+	}
+	for (uint32_t i = 0; i < 2 * n; i++)
+	{
+		x[i] = random_value();
+		input[i] = x[i];
+	}
+
+	dft(x, ref, n);
+	memcpy(buf, x, 2 * n * sizeof(float32_t));
+	arm_cfft_mr_f32(&S, buf, 0);
+	if (!report("arm_cfft_mr_f32", relative_error(buf, ref, 2 * n), MAX_ERROR, "n %u", n))
+	{
+		return 0;
+	}
+
+	arm_cfft_mr_f32(&S, buf, 1);
+	return report("arm_cfft_mr_f32 inverse", relative_error(buf, input, 2 * n), MAX_ERROR, "n %u", n);
+}
+
+static int check_rfft(uint32_t n)
+{
+	arm_rfft_mr_instance_f32 S;
+	double input[MAX_LEN];
+
+	if (arm_rfft_mr_init_f32(&S, n, twiddle, scratch) != ARM_MATH_SUCCESS)
+	{
+		fprintf(stderr, "arm_rfft_mr_init_f32: n %u rejected\n", n);
+		return 0;
+	}
+
+	// Reference: the DFT of the real data as complex, packed like the RFFT output
+	for (uint32_t i = 0; i < n; i++)
+	{
+		x[i] = random_value();
+		input[i] = x[i];
+		buf[2 * i] = x[i];
+		buf[2 * i + 1] = 0;
+	}
+	dft(buf, ref, n);
+	ref[1] = ref[n];
+
+	memcpy(buf, x, n * sizeof(float32_t));
+	arm_rfft_mr_f32(&S, buf, out, 0);
+	if (!report("arm_rfft_mr_f32", relative_error(out, ref, n), MAX_ERROR, "n %u", n))
+	{
+		return 0;
+	}
+
+	arm_rfft_mr_f32(&S, out, buf, 1);
+	return report("arm_rfft_mr_f32 inverse", relative_error(buf, input, n), MAX_ERROR, "n %u", n);
+}
+
+int main(void)
+{
+	static const uint32_t long_lengths[] = { 1000, 3000, 4096, 4800, 8192 };
+	arm_cfft_mr_instance_f32 S;
+	int ok = 1;
+
+	for (uint32_t n = 0; n <= 512 && ok; n++)
+	{
+		if (n < 2 || !supported(n))
+		{
+			checks++;
+			if (arm_cfft_mr_init_f32(&S, n, twiddle, scratch) != ARM_MATH_ARGUMENT_ERROR)
+			{
+				fprintf(stderr, "arm_cfft_mr_init_f32: n %u accepted\n", n);
+				ok = 0;
+			}
+			continue;
+		}
+		ok = check_cfft(n) && (n % 2 != 0 || n < 4 || check_rfft(n));
+	}
+	for (uint32_t k = 0; k < sizeof(long_lengths) / sizeof(long_lengths[0]) && ok; k++)
+	{
+		ok = check_cfft(long_lengths[k]) && check_rfft(long_lengths[k]);
+	}
+
+	printf("%s: %u checks\n", ok ? "ok" : "FAILED", checks);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,279 @@
+/**
+ * @file fft_tables_check.c
+ * @brief Checks the run-time FFT tables of the linked CMSIS-DSP build against CommonTables and a DFT in double.
+ *
+ * Usage:
+ *   fft_tables_check
+ *
+ * Every CFFT length from 16 to 4096 and RFFT length from 32 to 4096: the generated
+ * twiddles must be within one float rounding of the CommonTables ones and the bit
+ * reversal swaps must give the same permutation (both left out when the build has
+ * ARM_FFT_RUNTIME_TABLES). The transforms initialized from caller buffers, from the
+ * pool and by the generic inits must match a DFT within MAX_ERROR (relative RMS), and
+ * so must the deprecated radix-2 and radix-4 CFFTs, which take the pooled twiddles.
+ * Then the plan cache: a second init takes no memory and a full pool is reported.
+ * Exits 1 on the first failure.
+ */
+
+#include "arm_math.h"
+#include "check_util.h"
+#include "arm_const_structs.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LEN		4096
+#define POOL_SIZE	(256 * 1024)
+
+static float32_t x[2 * MAX_LEN], buf[2 * MAX_LEN], out[2 * MAX_LEN];
+static float32_t twiddle[2 * MAX_LEN];
+static uint16_t bitrev[2 * MAX_LEN];
+static double ref[2 * MAX_LEN];
+static uint64_t pool[POOL_SIZE / sizeof(uint64_t)];
+
+/// @brief DFT of n complex values, in double, twiddles by exact index so its own error is negligible.
+static void dft(const float32_t *in, double *result, uint32_t n)
+{
+	for (uint32_t k = 0; k < n; k++)
+	{
+		double re = 0, im = 0;
+		for (uint32_t t = 0; t < n; t++)
+		{
+			double theta = -2.0 * M_PI * (double)(((uint64_t)k * t) % n) / n;
+			re += in[2 * t] * cos(theta) - in[2 * t + 1] * sin(theta);
+			im += in[2 * t] * sin(theta) + in[2 * t + 1] * cos(theta);
+		}
+		result[2 * k] = re;
+		result[2 * k + 1] = im;
+	}
+}
+
+/// @brief Forward CFFT of the random input in x against ref.
+static int check_cfft_transform(const char *what, const arm_cfft_instance_f32 *S)
+{
+	memcpy(buf, x, 2 * S->fftLen * sizeof(float32_t));
+	arm_cfft_f32(S, buf, 0, 1);
+	return report(what, relative_error(buf, ref, 2 * S->fftLen), MAX_ERROR, "n %u", S->fftLen);
+}
+
+/// @brief Forward RFFT of the random real input in x against ref, packed like the RFFT output.
+static int check_rfft_transform(const char *what, arm_rfft_fast_instance_f32 *S)
+{
+	memcpy(buf, x, S->fftLenRFFT * sizeof(float32_t));
+	arm_rfft_fast_f32(S, buf, out, 0);
+	return report(what, relative_error(out, ref, S->fftLenRFFT), MAX_ERROR, "n %u", S->fftLenRFFT);
+}
+
+#if !defined(ARM_FFT_RUNTIME_TABLES)
+/// @brief Generated against CommonTables twiddles: at most one float rounding apart.
+static int compare_twiddles(const char *what, uint32_t n, const float32_t *a, const float32_t *b, uint32_t len)
+{
+	checks++;
+	for (uint32_t i = 0; i < len; i++)
+	{
+		if (fabsf(a[i] - b[i]) > FLT_EPSILON * fmaxf(fabsf(b[i]), 0.5f))
+		{
+			fprintf(stderr, "%s: n %u: twiddle %u is %.9g, table %.9g\n", what, n, i, a[i], b[i]);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/// @brief Both swap lists must give the same permutation of the complex values.
+static int compare_bitrev(uint32_t n, const arm_cfft_instance_f32 *S, const arm_cfft_instance_f32 *table)
+{
+	static uint32_t a[MAX_LEN], b[MAX_LEN];
+
+	checks++;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		a[i] = b[i] = i;
+	}
+	for (uint32_t i = 0; i < S->bitRevLength; i += 2)
+	{
+		uint32_t t = a[S->pBitRevTable[i] / 8];
+		a[S->pBitRevTable[i] / 8] = a[S->pBitRevTable[i + 1] / 8];
+		a[S->pBitRevTable[i + 1] / 8] = t;
+	}
+	for (uint32_t i = 0; i < table->bitRevLength; i += 2)
+	{
+		uint32_t t = b[table->pBitRevTable[i] / 8];
+		b[table->pBitRevTable[i] / 8] = b[table->pBitRevTable[i + 1] / 8];
+		b[table->pBitRevTable[i + 1] / 8] = t;
+	}
+	if (memcmp(a, b, n * sizeof(uint32_t)) != 0)
+	{
+		fprintf(stderr, "arm_cfft_init_tables_f32: n %u: bit reversal differs from the table\n", n);
+		return 0;
+	}
+	return 1;
+}
+#endif
+
+/// @brief The deprecated radix-2 CFFT, and the radix-4 one for powers of 4, against ref.
+static int check_radix(uint32_t n)
+{
+	arm_cfft_radix2_instance_f32 R2;
+	arm_cfft_radix4_instance_f32 R4;
+	const int power_of_4 = (n & 0x55555555U) != 0;
+
+	if (!check_status("arm_cfft_radix2_init_f32", arm_cfft_radix2_init_f32(&R2, n, 0, 1), ARM_MATH_SUCCESS, "n %u", n))
+	{
+		return 0;
+	}
+	memcpy(buf, x, 2 * n * sizeof(float32_t));
+	arm_cfft_radix2_f32(&R2, buf);
+	if (!report("arm_cfft_radix2_f32", relative_error(buf, ref, 2 * n), MAX_ERROR, "n %u", n))
+	{
+		return 0;
+	}
+
+	if (!check_status("arm_cfft_radix4_init_f32", arm_cfft_radix4_init_f32(&R4, n, 0, 1),
+					  power_of_4 ? ARM_MATH_SUCCESS : ARM_MATH_ARGUMENT_ERROR, "n %u", n))
+	{
+		return 0;
+	}
+	if (!power_of_4)
+	{
+		return 1;
+	}
+	memcpy(buf, x, 2 * n * sizeof(float32_t));
+	arm_cfft_radix4_f32(&R4, buf);
+	return report("arm_cfft_radix4_f32", relative_error(buf, ref, 2 * n), MAX_ERROR, "n %u", n);
+}
+
+static int check_cfft(uint32_t n)
+{
+	arm_cfft_instance_f32 S, pooled, generic;
+
+	for (uint32_t i = 0; i < 2 * n; i++)
+	{
+		x[i] = random_value();
+	}
+	dft(x, ref, n);
+
+	if (!check_status("arm_cfft_init_tables_f32", arm_cfft_init_tables_f32(&S, n, twiddle, bitrev), ARM_MATH_SUCCESS, "n %u", n)
+		|| !check_status("arm_cfft_init_pooled_f32", arm_cfft_init_pooled_f32(&pooled, n), ARM_MATH_SUCCESS, "n %u", n)
+		|| !check_status("arm_cfft_init_f32", arm_cfft_init_f32(&generic, n), ARM_MATH_SUCCESS, "n %u", n))
+	{
+		return 0;
+	}
+
+#if !defined(ARM_FFT_RUNTIME_TABLES)
+	arm_cfft_instance_f32 table;
+
+	arm_cfft_init_f32(&table, n);
+	if (!compare_twiddles("arm_cfft_init_tables_f32", n, S.pTwiddle, table.pTwiddle, 2 * n)
+		|| !compare_bitrev(n, &S, &table)
+		|| !check_cfft_transform("arm_cfft_f32 table", &table))
+	{
+		return 0;
+	}
+#endif
+
+	return check_cfft_transform("arm_cfft_f32 tables", &S)
+		&& check_cfft_transform("arm_cfft_f32 pooled", &pooled)
+		&& check_cfft_transform("arm_cfft_f32 generic init", &generic)
+		&& check_radix(n);
+}
+
+static int check_rfft(uint32_t n)
+{
+	arm_rfft_fast_instance_f32 S, pooled, generic;
+
+	for (uint32_t i = 0; i < n; i++)
+	{
+		x[i] = random_value();
+		buf[2 * i] = x[i];
+		buf[2 * i + 1] = 0;
+	}
+	dft(buf, ref, n);
+	ref[1] = ref[n];
+
+	if (!check_status("arm_rfft_fast_init_tables_f32", arm_rfft_fast_init_tables_f32(&S, n, twiddle, bitrev), ARM_MATH_SUCCESS, "n %u", n)
+		|| !check_status("arm_rfft_fast_init_pooled_f32", arm_rfft_fast_init_pooled_f32(&pooled, n), ARM_MATH_SUCCESS, "n %u", n)
+		|| !check_status("arm_rfft_fast_init_f32", arm_rfft_fast_init_f32(&generic, n), ARM_MATH_SUCCESS, "n %u", n))
+	{
+		return 0;
+	}
+
+#if !defined(ARM_FFT_RUNTIME_TABLES)
+	arm_rfft_fast_instance_f32 table;
+
+	arm_rfft_fast_init_f32(&table, n);
+	if (!compare_twiddles("arm_rfft_fast_init_tables_f32", n, S.pTwiddleRFFT, table.pTwiddleRFFT, n)
+		|| !check_rfft_transform("arm_rfft_fast_f32 table", &table))
+	{
+		return 0;
+	}
+#endif
+
+	return check_rfft_transform("arm_rfft_fast_f32 tables", &S)
+		&& check_rfft_transform("arm_rfft_fast_f32 pooled", &pooled)
+		&& check_rfft_transform("arm_rfft_fast_f32 generic init", &generic);
+}
+
+/// @brief Unsupported lengths rejected, cache hits free, a full pool reported and left as it was.
+static int check_pool(void)
+{
+	static const uint16_t rejected[] = { 0, 8, 24, 100, 8192 };
+	arm_cfft_instance_f32 S;
+	arm_rfft_fast_instance_f32 R;
+	uint32_t used;
+	int ok = 1;
+
+	for (uint32_t k = 0; k < sizeof(rejected) / sizeof(rejected[0]) && ok; k++)
+	{
+		ok = check_status("arm_cfft_init_pooled_f32", arm_cfft_init_pooled_f32(&S, rejected[k]), ARM_MATH_ARGUMENT_ERROR, "n %u", rejected[k])
+			&& check_status("arm_rfft_fast_init_pooled_f32", arm_rfft_fast_init_pooled_f32(&R, rejected[k]), ARM_MATH_ARGUMENT_ERROR, "n %u", rejected[k]);
+	}
+
+	// Every length is cached by now
+	used = arm_fft_tables_pool_used_f32();
+	for (uint32_t n = 32; n <= MAX_LEN && ok; n <<= 1)
+	{
+		ok = check_status("arm_cfft_init_pooled_f32", arm_cfft_init_pooled_f32(&S, n / 2), ARM_MATH_SUCCESS, "n %u", n / 2)
+			&& check_status("arm_rfft_fast_init_pooled_f32", arm_rfft_fast_init_pooled_f32(&R, n), ARM_MATH_SUCCESS, "n %u", n);
+	}
+	checks++;
+	if (ok && arm_fft_tables_pool_used_f32() != used)
+	{
+		fprintf(stderr, "plan cache: %u bytes used by cached lengths\n", arm_fft_tables_pool_used_f32() - used);
+		ok = 0;
+	}
+
+	// 4096 needs more than 8 * 4096 bytes
+	arm_fft_tables_pool_f32(pool, 8 * MAX_LEN);
+	ok = ok && check_status("arm_cfft_init_pooled_f32 small pool", arm_cfft_init_pooled_f32(&S, MAX_LEN), ARM_MATH_LENGTH_ERROR, "n %u", MAX_LEN);
+	checks++;
+	if (ok && arm_fft_tables_pool_used_f32() != 0)
+	{
+		fprintf(stderr, "plan cache: %u bytes kept after a failed init\n", arm_fft_tables_pool_used_f32());
+		ok = 0;
+	}
+	ok = ok && check_status("arm_cfft_init_pooled_f32 small pool", arm_cfft_init_pooled_f32(&S, MAX_LEN / 2), ARM_MATH_SUCCESS, "n %u", MAX_LEN / 2);
+
+	arm_fft_tables_pool_f32(NULL, 0);
+	return ok && check_status("arm_cfft_init_pooled_f32 no pool", arm_cfft_init_pooled_f32(&S, 16), ARM_MATH_LENGTH_ERROR, "n 16");
+}
+
+int main(void)
+{
+	int ok = 1;
+
+	arm_fft_tables_pool_f32(pool, sizeof(pool));
+	for (uint32_t n = 16; n <= MAX_LEN && ok; n <<= 1)
+	{
+		ok = check_cfft(n) && (n < 32 || check_rfft(n));
+	}
+	if (ok)
+	{
+		printf("pool: %u bytes for every CFFT and RFFT length\n", arm_fft_tables_pool_used_f32());
+		ok = check_pool();
+	}
+
+	printf("%s: %u checks\n", ok ? "ok" : "FAILED", checks);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file fir_partitioned_check.c
+ * @brief Checks the partitioned FFT FIR of the linked CMSIS-DSP build against a direct FIR in double.
+ *
+ * Usage:
+ *   fir_partitioned_check
+ *
+ * Filters from 1 to 20000 taps, partitions of 16 to 2048 samples: two channels sharing
+ * one set of filter spectra, fed different signals in blocks of random multiples of the
+ * partition size, must match the FIR in double within MAX_ERROR (relative RMS), and
+ * arm_fir_f32 for the filters it takes, so that the coefficient order is the same.
+ * Unsupported partition sizes and block sizes must be rejected. Exits 1 on the first
+ * failure.
+ */
+
+#include "arm_math.h"
+#include "check_util.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_TAPS		20000
+#define MAX_LEN			32768	// Input samples per channel
+#define MAX_PARTITION	2048
+#define CHANNELS		2
+#define MAX_FIR_ERROR	1e-5	// Against arm_fir_f32, which rounds its long sums in float
+
+static float32_t coeffs[MAX_TAPS], x[CHANNELS][MAX_LEN], y[CHANNELS][MAX_LEN];
+static float32_t spectra[2 * (MAX_TAPS + MAX_PARTITION)], scratch[2 * MAX_PARTITION];
+static float32_t state[CHANNELS][2 * (MAX_TAPS + 4 * MAX_PARTITION)];
+static float32_t fir_state[MAX_TAPS + MAX_LEN], fir_out[MAX_LEN];
+static double ref[MAX_LEN];
+#if defined(ARM_FFT_RUNTIME_TABLES)
+static uint64_t tables_pool[128 * 1024 / sizeof(uint64_t)];
+#endif
+
+/// @brief y[n] = sum b[k] x[n - k] in double, coefficients time reversed like arm_fir_f32.
+static void reference(const float32_t *in, uint32_t len, uint32_t taps)
+{
+	for (uint32_t n = 0; n < len; n++)
+	{
+		double sum = 0;
+		for (uint32_t k = 0; k < taps && k <= n; k++)
+		{
+			sum += (double)coeffs[taps - 1 - k] * in[n - k];
+		}
+		ref[n] = sum;
+	}
+}
+
+static int check_filter(uint32_t taps, uint16_t partition)
+{
+	arm_fir_partitioned_filter_f32 F;
+	arm_fir_partitioned_instance_f32 S[CHANNELS];
+	// A few times the filter length, at most MAX_LEN, whole partitions
+	uint32_t len = 4 * partition + 2 * taps;
+	int ok = 1;
+
+	len = (len > MAX_LEN ? MAX_LEN : len) / partition * partition;
+	for (uint32_t k = 0; k < taps; k++)
+	{
+		coeffs[k] = random_value();
+	}
+	if (!check_status("arm_fir_partitioned_filter_init_f32",
+					  arm_fir_partitioned_filter_init_f32(&F, taps, coeffs, partition, spectra, scratch), ARM_MATH_SUCCESS,
+					  "%u taps, partition %u", taps, partition))
+	{
+		return 0;
+	}
+
+	for (uint32_t c = 0; c < CHANNELS; c++)
+	{
+		arm_fir_partitioned_init_f32(&S[c], &F, state[c]);
+		for (uint32_t i = 0; i < len; i++)
+		{
+			x[c][i] = random_value();
+		}
+	}
+
+	// Blocks of 1 to 8 partitions, the channels interleaved with each other
+	for (uint32_t done = 0; done < len && ok;)
+	{
+		uint32_t block = partition * (1 + (uint32_t)((random_value() + 0.5f) * 8));
+
+		block = block > len - done ? len - done : block;
+		for (uint32_t c = 0; c < CHANNELS && ok; c++)
+		{
+			ok = check_status("arm_fir_partitioned_f32", arm_fir_partitioned_f32(&S[c], x[c] + done, y[c] + done, block),
+							  ARM_MATH_SUCCESS, "%u taps, partition %u", taps, partition);
+		}
+		done += block;
+	}
+
+	for (uint32_t c = 0; c < CHANNELS && ok; c++)
+	{
+		reference(x[c], len, taps);
+		ok = report("arm_fir_partitioned_f32", relative_error(y[c], ref, len), MAX_ERROR,
+					"%u taps, partition %u: channel %u", taps, partition, c);
+	}
+
+	if (ok && taps <= UINT16_MAX)
+	{
+		arm_fir_instance_f32 fir;
+		double out[MAX_LEN];
+
+		arm_fir_init_f32(&fir, (uint16_t)taps, coeffs, fir_state, len);
+		arm_fir_f32(&fir, x[0], fir_out, len);
+		for (uint32_t i = 0; i < len; i++)
+		{
+			out[i] = fir_out[i];
+		}
+		ok = report("arm_fir_partitioned_f32 against arm_fir_f32", relative_error(y[0], out, len), MAX_FIR_ERROR,
+					"%u taps, partition %u: channel 0", taps, partition);
+	}
+
+	// A block that is not whole partitions is rejected and changes nothing
+	return ok && check_status("arm_fir_partitioned_f32", arm_fir_partitioned_f32(&S[0], x[0], y[0], partition + 1),
+							  ARM_MATH_ARGUMENT_ERROR, "%u taps, partition %u", taps, partition);
+}
+
+int main(void)
+{
+	static const struct { uint32_t taps; uint16_t partition; } cases[] = {
+		{ 1, 16 }, { 16, 16 }, { 17, 16 }, { 100, 32 }, { 255, 64 }, { 1000, 128 },
+		{ 4096, 256 }, { 4096, 64 }, { 5000, 512 }, { 300, 2048 }, { 8192, 1024 },
+		{ MAX_TAPS, 512 }, { MAX_TAPS, 2048 },
+	};
+	static const uint16_t rejected[] = { 0, 8, 24, 100, 4096 };
+	arm_fir_partitioned_filter_f32 F;
+	int ok = 1;
+
+#if defined(ARM_FFT_RUNTIME_TABLES)
+	arm_fft_tables_pool_f32(tables_pool, sizeof(tables_pool));
+#endif
+	for (uint32_t k = 0; k < sizeof(cases) / sizeof(cases[0]) && ok; k++)
+	{
+		ok = check_filter(cases[k].taps, cases[k].partition);
+	}
+	for (uint32_t k = 0; k < sizeof(rejected) / sizeof(rejected[0]) && ok; k++)
+	{
+		ok = check_status("arm_fir_partitioned_filter_init_f32",
+						  arm_fir_partitioned_filter_init_f32(&F, 100, coeffs, rejected[k], spectra, scratch), ARM_MATH_ARGUMENT_ERROR,
+						  "100 taps, partition %u", rejected[k]);
+	}
+	ok = ok && check_status("arm_fir_partitioned_filter_init_f32",
+							arm_fir_partitioned_filter_init_f32(&F, 0, coeffs, 64, spectra, scratch), ARM_MATH_ARGUMENT_ERROR,
+							"0 taps, partition 64");
+
+	printf("%s: %u checks\n", ok ? "ok" : "FAILED", checks);
+	return ok ? 0 : 1;
+}
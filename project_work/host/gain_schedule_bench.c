@@ -0,0 +1,175 @@
+/**
+ * @file gain_schedule_bench.c
+ * @brief Per-sample cost of the gain-schedule lookup on a PC.
+ *
+ * Loads a 1-D and a 2-D table and times one lookup per controller sample over a
+ * 0-400 V sweep. The 1-D table is also checked against arm_linear_interp_f32 on the
+ * same points, which is what the precomputed slopes replace. Lookups at and beyond the
+ * grid edges must return the edge points exactly; exits 1 if not.
+ */
+
+#include "gain_schedule.h"
+#include "arm_math.h"
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#define ROUNDS		2000000
+#define POINTS_1D	9
+#define ROWS_2D		5
+#define COLS_2D		5
+
+static volatile float sink;
+
+static double now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static float sweep(int i)
+{
+	return (float)(i % 4096) * (400.0f / 4096.0f);
+}
+
+static void report(const char *name, double t0, double t1)
+{
+	printf("%-36s %6.2f ns / sample\n", name, (t1 - t0) / ROUNDS);
+}
+
+/// @brief Looks up (u_ref, u_meas) and compares the gains with the expected grid point.
+static int check_edge(const char *table, float u_ref, float u_meas, float kp, float ki, float kd)
+{
+	PIDGains_t gains;
+
+	GainSchedule_Lookup(u_ref, u_meas, &gains);
+	if (gains.kp != kp || gains.ki != ki || gains.kd != kd)
+	{
+		fprintf(stderr, "%s edge at (%g V, %g V): kp %g ki %g kd %g, expected %g %g %g\n",
+				table, u_ref, u_meas, gains.kp, gains.ki, gains.kd, kp, ki, kd);
+		return 0;
+	}
+	return 1;
+}
+
+int main(void)
+{
+	float kp[POINTS_1D], ki[POINTS_1D], kd[POINTS_1D];
+	GainScheduleGrid_t grid = { SCHEDULE_AXIS_REF, 0.0f, 50.0f, POINTS_1D, 0.0f, 0.0f, 1 };
+	PIDGains_t gains;
+	double t0, t1;
+
+	// 1-D over the reference: gains falling off towards the top of the range.
+	GainSchedule_Begin(&grid);
+	for (int i = 0; i < POINTS_1D; i++)
+	{
+		kp[i] = 6.0f - 0.4f * i;
+		ki[i] = 8.0f - 0.5f * i;
+		kd[i] = 0.01f + 0.002f * i;
+		gains.kp = kp[i];
+		gains.ki = ki[i];
+		gains.kd = kd[i];
+		GainSchedule_AddPoint(&gains);
+	}
+	if (GainSchedule_Commit() != XST_SUCCESS)
+	{
+		fprintf(stderr, "1-D commit failed\n");
+		return 1;
+	}
+
+	arm_linear_interp_instance_f32 lin_kp = { POINTS_1D, grid.x0, grid.x_step, kp };
+	arm_linear_interp_instance_f32 lin_ki = { POINTS_1D, grid.x0, grid.x_step, ki };
+	arm_linear_interp_instance_f32 lin_kd = { POINTS_1D, grid.x0, grid.x_step, kd };
+
+	float max_err = 0;
+	for (int i = 0; i < 4096; i++)
+	{
+		float v = sweep(i);
+		GainSchedule_Lookup(v, 0, &gains);
+		max_err = fmaxf(max_err, fabsf(gains.kp - arm_linear_interp_f32(&lin_kp, v)));
+		max_err = fmaxf(max_err, fabsf(gains.ki - arm_linear_interp_f32(&lin_ki, v)));
+		max_err = fmaxf(max_err, fabsf(gains.kd - arm_linear_interp_f32(&lin_kd, v)));
+	}
+	printf("1-D max difference to arm_linear_interp_f32: %g\n", max_err);
+
+	// First and last point, and beyond them
+	int last = POINTS_1D - 1;
+	float top = grid.x0 + grid.x_step * last;
+	if (!check_edge("1-D", grid.x0, 0, kp[0], ki[0], kd[0]) || !check_edge("1-D", grid.x0 - 10.0f, 0, kp[0], ki[0], kd[0]) ||
+		!check_edge("1-D", top, 0, kp[last], ki[last], kd[last]) || !check_edge("1-D", top + 10.0f, 0, kp[last], ki[last], kd[last]))
+	{
+		return 1;
+	}
+
+	t0 = now_ns();
+	for (int i = 0; i < ROUNDS; i++)
+	{
+		float v = sweep(i);
+		sink += arm_linear_interp_f32(&lin_kp, v) + arm_linear_interp_f32(&lin_ki, v) + arm_linear_interp_f32(&lin_kd, v);
+	}
+	t1 = now_ns();
+	report("1-D, 3x arm_linear_interp_f32", t0, t1);
+
+	t0 = now_ns();
+	for (int i = 0; i < ROUNDS; i++)
+	{
+		GainSchedule_Lookup(sweep(i), 0, &gains);
+		sink += gains.kp + gains.ki + gains.kd;
+	}
+	t1 = now_ns();
+	report("1-D, precomputed slopes", t0, t1);
+
+	// 2-D over reference x measured voltage.
+	grid = (GainScheduleGrid_t){ SCHEDULE_AXIS_BOTH, 0.0f, 100.0f, COLS_2D, 0.0f, 100.0f, ROWS_2D };
+	GainSchedule_Begin(&grid);
+	PIDGains_t points_2d[ROWS_2D][COLS_2D];
+	for (int r = 0; r < ROWS_2D; r++)
+	{
+		for (int c = 0; c < COLS_2D; c++)
+		{
+			gains.kp = 6.0f - 0.5f * c - 0.2f * r;
+			gains.ki = 8.0f - 0.6f * c;
+			gains.kd = 0.01f + 0.001f * r;
+			points_2d[r][c] = gains;
+			GainSchedule_AddPoint(&gains);
+		}
+	}
+	if (GainSchedule_Commit() != XST_SUCCESS)
+	{
+		fprintf(stderr, "2-D commit failed\n");
+		return 1;
+	}
+
+	GainSchedule_Lookup(150.0f, 250.0f, &gains);
+	printf("2-D at (150 V, 250 V): kp %.3f (expected %.3f)\n", gains.kp, 6.0f - 0.5f * 1.5f - 0.2f * 2.5f);
+
+	// Corners, the last row and column, and beyond them; (x, y) = (u_ref, u_meas) = (column, row)
+	const PIDGains_t *corner = &points_2d[ROWS_2D - 1][COLS_2D - 1];
+	const PIDGains_t *right = &points_2d[2][COLS_2D - 1];
+	const PIDGains_t *bottom = &points_2d[ROWS_2D - 1][1];
+	const PIDGains_t *origin = &points_2d[0][0];
+	if (!check_edge("2-D", 400.0f, 400.0f, corner->kp, corner->ki, corner->kd) ||
+		!check_edge("2-D", 500.0f, 450.0f, corner->kp, corner->ki, corner->kd) ||
+		!check_edge("2-D", 400.0f, 200.0f, right->kp, right->ki, right->kd) ||
+		!check_edge("2-D", 450.0f, 200.0f, right->kp, right->ki, right->kd) ||
+		!check_edge("2-D", 100.0f, 400.0f, bottom->kp, bottom->ki, bottom->kd) ||
+		!check_edge("2-D", 100.0f, 999.0f, bottom->kp, bottom->ki, bottom->kd) ||
+		!check_edge("2-D", -50.0f, -50.0f, origin->kp, origin->ki, origin->kd))
+	{
+		return 1;
+	}
+	printf("edges: ok\n");
+
+	t0 = now_ns();
+	for (int i = 0; i < ROUNDS; i++)
+	{
+		float v = sweep(i);
+		GainSchedule_Lookup(v, 400.0f - v, &gains);
+		sink += gains.kp + gains.ki + gains.kd;
+	}
+	t1 = now_ns();
+	report("2-D, bilinear in the grid cell", t0, t1);
+
+	return 0;
+}
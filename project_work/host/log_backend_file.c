@@ -0,0 +1,41 @@
+/**
+ * @file log_backend_file.c
+ * @brief Plain file backend for the data logger in host builds.
+ */
+
+#include "log_backend_file.h"
+#include <stdio.h>
+
+static const char *file_path;
+static FILE *file = NULL;
+
+static int file_open(void)
+{
+	file = fopen(file_path, "wb");
+	return file != NULL ? XST_SUCCESS : XST_FAILURE;
+}
+
+static int file_write(const void *block, u32 len)
+{
+	return fwrite(block, 1, len, file) == len ? XST_SUCCESS : XST_FAILURE;
+}
+
+static int file_close(void)
+{
+	int status = fclose(file) == 0 ? XST_SUCCESS : XST_FAILURE;
+	file = NULL;
+	return status;
+}
+
+static const LogBackend_t file_backend = {
+	"file",
+	file_open,
+	file_write,
+	file_close
+};
+
+const LogBackend_t *LogBackendFile_Create(const char *path)
+{
+	file_path = path;
+	return &file_backend;
+}
@@ -0,0 +1,14 @@
+/**
+ * @file log_backend_file.h
+ * @brief Plain file backend for the data logger in host builds.
+ */
+
+#ifndef LOG_BACKEND_FILE_H
+#define LOG_BACKEND_FILE_H
+
+#include "data_logger.h"
+
+/// @brief Backend that writes the blocks to path, truncated on DataLogger_Start.
+const LogBackend_t *LogBackendFile_Create(const char *path);
+
+#endif
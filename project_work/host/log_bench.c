@@ -0,0 +1,217 @@
+/**
+ * @file log_bench.c
+ * @brief Data logger throughput: closed-loop samples at a fixed rate into a file.
+ *
+ * Usage:
+ *   log_bench [-o file] [-t seconds] [-r rate_hz] [-n noise_v]
+ *
+ * A producer thread runs PID_controller and the plant model and records every
+ * sample at rate_hz (0: as fast as possible), a second thread plays log_task and
+ * flushes every 10 ms. Prints the compression, the producer cost per sample, the
+ * write time per block, then reads the file back with log_reader and compares it
+ * to what was recorded.
+ */
+
+#include "data_logger.h"
+#include "log_reader.h"
+#include "log_backend_file.h"
+#include "pid_controller.h"
+#include "plant_model.h"
+#include "xtime_l.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+
+#define FLUSH_PERIOD_NS		10000000L
+
+static long sample_count;
+static double rate;
+static float noise;
+static LogSample_t *recorded;
+static double record_ns_total;
+static double record_ns_max;
+
+static double now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/// @brief Uniform noise in [-noise, noise], fixed seed so runs compare.
+static float next_noise(void)
+{
+	static u32 lcg = 12345;
+	lcg = lcg * 1664525u + 1013904223u;
+	return noise * ((float)(lcg >> 8) / (1 << 23) - 1.0f);
+}
+
+static void *producer_thread(void *arg)
+{
+	PIDControllerState_t pid = { 0 };
+	float plant[PLANT_STATE_SIZE] = { 0 };
+	float u_meas = 0;
+	struct timespec next;
+	const long period_ns = rate > 0 ? (long)(1e9 / rate) : 0;
+
+	(void)arg;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+
+	for (long n = 0; n < sample_count; n++)
+	{
+		// Set point steps every 1000 samples, like an operator stepping the target.
+		float u_ref = ((n / 1000) & 1) ? 300.0f : 100.0f;
+		float u_out = PID_controller(u_meas, u_ref, 0.01f, 6.0f, 4.5f, 0, &pid);
+		u_meas = PlantModel_Step(plant, u_out) + next_noise();
+
+		LogSample_t sample = { (u32)n * 10, u_ref, u_meas, u_out };
+		recorded[n] = sample;
+
+		double t0 = now_ns();
+		DataLogger_Record(&sample);
+		double dt = now_ns() - t0;
+		record_ns_total += dt;
+		record_ns_max = fmax(record_ns_max, dt);
+
+		if (period_ns > 0)
+		{
+			next.tv_nsec += period_ns;
+			if (next.tv_nsec >= 1000000000L)
+			{
+				next.tv_nsec -= 1000000000L;
+				next.tv_sec++;
+			}
+			clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+		}
+	}
+
+	// The next call after the stop request closes the partial block.
+	LogSample_t last = recorded[sample_count - 1];
+	DataLogger_Stop();
+	DataLogger_Record(&last);
+	return NULL;
+}
+
+static void *flush_thread(void *arg)
+{
+	const struct timespec period = { 0, FLUSH_PERIOD_NS };
+
+	(void)arg;
+	while (DataLogger_Active())
+	{
+		nanosleep(&period, NULL);
+		DataLogger_Flush();
+	}
+	return NULL;
+}
+
+/// @brief Reads the log back and compares it with what was recorded.
+static int verify(const char *path, long recorded_samples)
+{
+	static u8 block[LOG_BLOCK_SIZE];
+	static LogSample_t samples[LOG_MAX_BLOCK_SAMPLES];
+	LogReader_t reader;
+	FILE *file = fopen(path, "rb");
+	float max_error = 0;
+	long tick_errors = 0;
+
+	if (file == NULL)
+	{
+		perror(path);
+		return 1;
+	}
+	LogReader_Init(&reader);
+	while (fread(block, 1, sizeof(block), file) == sizeof(block))
+	{
+		int count = LogReader_Block(&reader, block, samples);
+		if (count < 0)
+		{
+			break;
+		}
+		for (int i = 0; i < count; i++)
+		{
+			// Dropped samples leave holes, the tick says which sample this was.
+			long n = samples[i].tick / 10;
+			if (n >= sample_count || samples[i].tick != recorded[n].tick)
+			{
+				tick_errors++;
+				continue;
+			}
+			max_error = fmaxf(max_error, fabsf(samples[i].u_ref - recorded[n].u_ref));
+			max_error = fmaxf(max_error, fabsf(samples[i].u_meas - recorded[n].u_meas));
+			max_error = fmaxf(max_error, fabsf(samples[i].u_out - recorded[n].u_out));
+		}
+	}
+	fclose(file);
+
+	printf("read back: %u blocks, %u samples, %u gaps, %u dropped, max error %.3f mV, %ld tick mismatches\n",
+		   reader.blocks, reader.samples, reader.gaps, reader.dropped, max_error * 1000, tick_errors);
+	return (reader.samples == recorded_samples && tick_errors == 0 && max_error <= 0.5f / LOG_VOLT_SCALE + 1e-4f) ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+	const char *path = "log_bench.bin";
+	double seconds = 5;
+	int opt;
+
+	rate = 10000;
+	noise = 0.05f;
+	while ((opt = getopt(argc, argv, "o:t:r:n:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'o': path = optarg; break;
+		case 't': seconds = atof(optarg); break;
+		case 'r': rate = atof(optarg); break;
+		case 'n': noise = atof(optarg); break;
+		default:
+			fprintf(stderr, "usage: %s [-o file] [-t seconds] [-r rate_hz] [-n noise_v]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	sample_count = (long)(seconds * (rate > 0 ? rate : 1e6));
+	if (sample_count < 1)
+	{
+		fprintf(stderr, "invalid arguments\n");
+		return 2;
+	}
+	recorded = malloc(sample_count * sizeof(LogSample_t));
+
+	if (DataLogger_Start(LogBackendFile_Create(path)) != XST_SUCCESS)
+	{
+		perror(path);
+		return 1;
+	}
+
+	pthread_t producer, flusher;
+	double t0 = now_ns();
+	pthread_create(&flusher, NULL, flush_thread, NULL);
+	pthread_create(&producer, NULL, producer_thread, NULL);
+	pthread_join(producer, NULL);
+	pthread_join(flusher, NULL);
+	double elapsed = (now_ns() - t0) / 1e9;
+
+	LogStats_t stats;
+	DataLogger_GetStats(&stats);
+	double bytes_per_sample = (double)stats.payload_bytes / stats.samples;
+	double file_bytes = (double)stats.blocks * LOG_BLOCK_SIZE;
+
+	printf("%u samples in %.2f s (%.0f samples/s), %u dropped, %u blocks, %u write errors\n",
+		   stats.samples, elapsed, stats.samples / elapsed, stats.dropped, stats.blocks, stats.write_errors);
+	printf("payload %.2f bytes/sample (%.1fx vs %u raw), file %.2f bytes/sample, %.1f KB/s at %.0f Hz\n",
+		   bytes_per_sample, sizeof(LogSample_t) / bytes_per_sample, (unsigned)sizeof(LogSample_t),
+		   file_bytes / stats.samples, file_bytes / stats.samples * (rate > 0 ? rate : stats.samples / elapsed) / 1024,
+		   rate > 0 ? rate : stats.samples / elapsed);
+	printf("DataLogger_Record: %.0f ns mean, %.0f ns max | backend write: %.1f us per block\n",
+		   record_ns_total / sample_count, record_ns_max,
+		   stats.blocks ? 1e6 * stats.flush_counts / COUNTS_PER_SECOND / stats.blocks : 0.0);
+
+	int status = verify(path, stats.samples);
+	free(recorded);
+	return status;
+}
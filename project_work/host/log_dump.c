@@ -0,0 +1,52 @@
+/**
+ * @file log_dump.c
+ * @brief Prints a data logger file (or SD card region image) as CSV.
+ *
+ * Usage:
+ *   log_dump log.bin > log.csv
+ *
+ * Output: tick,u_ref,u_meas,u_out per sample, volts. A summary goes to stderr.
+ */
+
+#include "log_reader.h"
+#include <stdio.h>
+
+int main(int argc, char **argv)
+{
+	static u8 block[LOG_BLOCK_SIZE];
+	static LogSample_t samples[LOG_MAX_BLOCK_SAMPLES];
+	LogReader_t reader;
+
+	if (argc != 2)
+	{
+		fprintf(stderr, "usage: %s log.bin\n", argv[0]);
+		return 2;
+	}
+
+	FILE *file = fopen(argv[1], "rb");
+	if (file == NULL)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+
+	LogReader_Init(&reader);
+	printf("tick,u_ref,u_meas,u_out\n");
+	while (fread(block, 1, sizeof(block), file) == sizeof(block))
+	{
+		int count = LogReader_Block(&reader, block, samples);
+		if (count < 0)
+		{
+			break;
+		}
+		for (int i = 0; i < count; i++)
+		{
+			printf("%u,%.4f,%.4f,%.4f\n", samples[i].tick, samples[i].u_ref, samples[i].u_meas, samples[i].u_out);
+		}
+	}
+	fclose(file);
+
+	fprintf(stderr, "session %08x: %u blocks, %u samples, %u block gaps, %u samples dropped\n",
+			reader.session, reader.blocks, reader.samples, reader.gaps, reader.dropped);
+	return 0;
+}
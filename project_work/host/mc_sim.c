@@ -0,0 +1,320 @@
+/**
+ * @file mc_sim.c
+ * @brief Monte-Carlo robustness of the voltage loop against perturbed plant models.
+ *
+ * Usage:
+ *   mc_sim [-n scenarios] [-t tolerance_%] [-g gain_drift_%] [-r u_ref] [-d ms] [-s seed] [-j threads] [-o csv]
+ *
+ * Every scenario multiplies each entry of A_matrix by its own factor within +-tolerance
+ * (component tolerances) and B_matrix by one factor within +-gain drift, then runs the
+ * unchanged PID_controller with the current gains on a 0 -> u_ref step. Scenarios run
+ * PLANT_BATCH_LANES at a time through plant_batch.c, batches are spread over all CPUs
+ * with work_pool.c. Scenario k always gets the same plant for a given seed, whatever
+ * the thread count.
+ *
+ * Prints the overshoot and settling time distributions of the stable scenarios and
+ * the share that diverged or didn't settle. -o writes one CSV line per scenario.
+ */
+
+#include "controller.h"
+#include "plant_batch.h"
+#include "work_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+
+#define SETTLE_BAND		0.02f		// Of u_ref
+#define DIVERGED_V		10000.0f	// Plant voltage taken as unstable
+
+typedef struct {
+	u32 scenarios;
+	float tolerance;	// Relative, per A entry
+	float gain_drift;	// Relative, on B
+	float u_ref;
+	u32 steps;
+	uint64_t seed;
+	float kp, ki, kd;
+	float a[PLANT_STATE_SIZE][PLANT_STATE_SIZE];
+	float b[PLANT_STATE_SIZE];
+
+	// Results per scenario
+	float *overshoot;	// % of u_ref
+	s32 *settled_ms;	// -1 if not settled at the end
+	u8 *diverged;
+} McRun_t;
+
+static double now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t splitmix64(uint64_t *s)
+{
+	uint64_t z = (*s += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+/// @brief Uniform in [-1, 1).
+static float uniform(uint64_t *s)
+{
+	return (float)(splitmix64(s) >> 40) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+static void perturb(const McRun_t *run, u32 scenario, float a[PLANT_STATE_SIZE][PLANT_STATE_SIZE], float b[PLANT_STATE_SIZE])
+{
+	uint64_t s = run->seed ^ ((uint64_t)scenario * 0xD1B54A32D192ED03ULL);
+	float drift = 1.0f + run->gain_drift * uniform(&s);
+
+	for (int i = 0; i < PLANT_STATE_SIZE; i++)
+	{
+		for (int j = 0; j < PLANT_STATE_SIZE; j++)
+		{
+			a[i][j] = run->a[i][j] * (1.0f + run->tolerance * uniform(&s));
+		}
+		b[i] = run->b[i] * drift;
+	}
+}
+
+/// @brief One work-pool task: PLANT_BATCH_LANES scenarios from batch * PLANT_BATCH_LANES on.
+static void run_batch(uint32_t batch_index, uint32_t worker, void *context)
+{
+	McRun_t *run = context;
+	PlantBatch_t batch;
+	PIDControllerState_t pid[PLANT_BATCH_LANES] = {0};
+	float u_in[PLANT_BATCH_LANES];
+	float u_meas[PLANT_BATCH_LANES] = {0};
+	float peak[PLANT_BATCH_LANES] = {0};
+	s32 last_outside[PLANT_BATCH_LANES];
+	u8 diverged[PLANT_BATCH_LANES] = {0};
+	const u32 first = batch_index * PLANT_BATCH_LANES;
+	const float band = SETTLE_BAND * run->u_ref;
+
+	(void)worker;
+	for (int l = 0; l < PLANT_BATCH_LANES; l++)
+	{
+		float a[PLANT_STATE_SIZE][PLANT_STATE_SIZE];
+		float b[PLANT_STATE_SIZE];
+
+		// Lanes past the last scenario run the nominal plant and are not reported.
+		if (first + l < run->scenarios)
+		{
+			perturb(run, first + l, a, b);
+			PlantBatch_SetLane(&batch, l, a, b);
+		}
+		else
+		{
+			PlantBatch_SetLane(&batch, l, run->a, run->b);
+		}
+		last_outside[l] = 0;
+	}
+
+	for (u32 k = 0; k < run->steps; k++)
+	{
+		for (int l = 0; l < PLANT_BATCH_LANES; l++)
+		{
+			u_in[l] = diverged[l] ? 0 : PID_controller(u_meas[l], run->u_ref, run->kd, run->ki, run->kp, 0, &pid[l]);
+		}
+		PlantBatch_Step(&batch, u_in, u_meas);
+		for (int l = 0; l < PLANT_BATCH_LANES; l++)
+		{
+			if (diverged[l])
+			{
+				continue;
+			}
+			if (!(fabsf(u_meas[l]) < DIVERGED_V))
+			{
+				// Keep the lane at zero from here on, inf / NaN would only slow the batch down.
+				diverged[l] = 1;
+				PlantBatch_ResetLane(&batch, l);
+				u_meas[l] = 0;
+				continue;
+			}
+			peak[l] = fmaxf(peak[l], u_meas[l]);
+			if (fabsf(u_meas[l] - run->u_ref) > band)
+			{
+				last_outside[l] = (s32)k + 1;
+			}
+		}
+	}
+
+	for (int l = 0; l < PLANT_BATCH_LANES && first + l < run->scenarios; l++)
+	{
+		u32 n = first + l;
+		run->diverged[n] = diverged[l];
+		run->overshoot[n] = (peak[l] - run->u_ref) / run->u_ref * 100.0f;
+		run->settled_ms[n] = (last_outside[l] < (s32)run->steps) ? last_outside[l] * PID_SAMPLE_TIME_MS : -1;
+	}
+}
+
+/// @brief Largest difference between lane 0 of a nominal batch and PlantModel_Step in the same loop.
+static float nominal_check(const McRun_t *run)
+{
+	PlantBatch_t batch;
+	PIDControllerState_t pid_batch[PLANT_BATCH_LANES] = {0};
+	PIDControllerState_t pid_ref = {0};
+	float state[PLANT_STATE_SIZE] = {0};
+	float u_in[PLANT_BATCH_LANES];
+	float u_meas[PLANT_BATCH_LANES] = {0};
+	float u_ref_meas = 0;
+	float worst = 0;
+
+	for (int l = 0; l < PLANT_BATCH_LANES; l++)
+	{
+		PlantBatch_SetLane(&batch, l, run->a, run->b);
+	}
+	for (u32 k = 0; k < run->steps; k++)
+	{
+		for (int l = 0; l < PLANT_BATCH_LANES; l++)
+		{
+			u_in[l] = PID_controller(u_meas[l], run->u_ref, run->kd, run->ki, run->kp, 0, &pid_batch[l]);
+		}
+		PlantBatch_Step(&batch, u_in, u_meas);
+		u_ref_meas = PlantModel_Step(state, PID_controller(u_ref_meas, run->u_ref, run->kd, run->ki, run->kp, 0, &pid_ref));
+		worst = fmaxf(worst, fabsf(u_meas[0] - u_ref_meas));
+	}
+	return worst;
+}
+
+static int compare_float(const void *a, const void *b)
+{
+	float x = *(const float *)a;
+	float y = *(const float *)b;
+	return (x > y) - (x < y);
+}
+
+static void print_distribution(const char *name, float *values, u32 count, const char *unit)
+{
+	if (count == 0)
+	{
+		printf("%-10s -\n", name);
+		return;
+	}
+	qsort(values, count, sizeof(float), compare_float);
+	printf("%-10s p5 %8.2f | p50 %8.2f | p95 %8.2f | p99 %8.2f | max %8.2f %s\n", name,
+		   values[(u64)count * 5 / 100], values[count / 2], values[(u64)count * 95 / 100],
+		   values[(u64)count * 99 / 100], values[count - 1], unit);
+}
+
+int main(int argc, char **argv)
+{
+	McRun_t run = { 100000, 0.01f, 0.10f, 200.0f, 5000, 1 };
+	uint32_t threads = 0;
+	const char *csv_path = NULL;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:t:g:r:d:s:j:o:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'n': run.scenarios = (u32)atol(optarg); break;
+		case 't': run.tolerance = atof(optarg) / 100.0f; break;
+		case 'g': run.gain_drift = atof(optarg) / 100.0f; break;
+		case 'r': run.u_ref = atof(optarg); break;
+		case 'd': run.steps = (u32)atol(optarg) / PID_SAMPLE_TIME_MS; break;
+		case 's': run.seed = strtoull(optarg, NULL, 0); break;
+		case 'j': threads = (uint32_t)atoi(optarg); break;
+		case 'o': csv_path = optarg; break;
+		default:
+			fprintf(stderr, "usage: %s [-n scenarios] [-t tolerance_%%] [-g gain_drift_%%] [-r u_ref] [-d ms] [-s seed] [-j threads] [-o csv]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (run.scenarios == 0 || run.steps == 0 || !(run.u_ref > 0) || run.tolerance < 0 || run.gain_drift < 0)
+	{
+		fprintf(stderr, "invalid arguments\n");
+		return 2;
+	}
+
+	getParameters(&run.kp, &run.ki, &run.kd);
+	PlantModel_GetMatrices(run.a, run.b);
+	run.overshoot = malloc(run.scenarios * sizeof(float));
+	run.settled_ms = malloc(run.scenarios * sizeof(s32));
+	run.diverged = malloc(run.scenarios);
+	if (run.overshoot == NULL || run.settled_ms == NULL || run.diverged == NULL)
+	{
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+
+	printf("%u scenarios, A +-%.1f %%, B +-%.1f %%, 0 -> %.0f V for %u ms, Kp %.2f Ki %.2f Kd %.3f\n",
+		   run.scenarios, run.tolerance * 100, run.gain_drift * 100, run.u_ref, run.steps * PID_SAMPLE_TIME_MS,
+		   run.kp, run.ki, run.kd);
+	printf("batched plant vs PlantModel_Step on the nominal model: max %.2e V apart\n", nominal_check(&run));
+
+	WorkPoolStats_t stats;
+	u32 batches = (run.scenarios + PLANT_BATCH_LANES - 1) / PLANT_BATCH_LANES;
+	double t0 = now_ns();
+	if (WorkPool_Run(batches, threads, run_batch, &run, &stats) != 0)
+	{
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+	double elapsed = (now_ns() - t0) / 1e9;
+
+	if (csv_path != NULL)
+	{
+		FILE *csv = fopen(csv_path, "w");
+		if (csv == NULL)
+		{
+			perror(csv_path);
+			return 1;
+		}
+		fprintf(csv, "scenario,diverged,overshoot_pct,settled_ms\n");
+		for (u32 n = 0; n < run.scenarios; n++)
+		{
+			fprintf(csv, "%u,%u,%.3f,%d\n", n, run.diverged[n], run.overshoot[n], (int)run.settled_ms[n]);
+		}
+		fclose(csv);
+	}
+
+	// Distributions over the scenarios that stayed bounded and settled.
+	float *overshoot = malloc(run.scenarios * sizeof(float));
+	float *settling = malloc(run.scenarios * sizeof(float));
+	u32 diverged = 0;
+	u32 unsettled = 0;
+	u32 settled = 0;
+
+	if (overshoot == NULL || settling == NULL)
+	{
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+
+	for (u32 n = 0; n < run.scenarios; n++)
+	{
+		if (run.diverged[n])
+		{
+			diverged++;
+		}
+		else if (run.settled_ms[n] < 0)
+		{
+			unsettled++;
+		}
+		else
+		{
+			overshoot[settled] = run.overshoot[n];
+			settling[settled] = (float)run.settled_ms[n];
+			settled++;
+		}
+	}
+	print_distribution("overshoot", overshoot, settled, "%");
+	print_distribution("settling", settling, settled, "ms");
+	printf("diverged %.3f %% | not settled %.3f %%\n",
+		   100.0 * diverged / run.scenarios, 100.0 * unsettled / run.scenarios);
+	printf("%.2f s on %u threads (%llu steals): %.0f scenarios/s, %.1f M plant steps/s\n",
+		   elapsed, stats.threads, (unsigned long long)stats.steals, run.scenarios / elapsed,
+		   (double)batches * PLANT_BATCH_LANES * run.steps / elapsed / 1e6);
+
+	free(overshoot);
+	free(settling);
+	free(run.overshoot);
+	free(run.settled_ms);
+	free(run.diverged);
+	return 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file meas_bench.c
+ * @brief Measurement front-end on a synthetic signal: accuracy, rejection and cost.
+ *
+ * Runs a noisy DC level, a sine in the pass band and a sine above the output
+ * Nyquist frequency through the front-end and prints what reaches the controller,
+ * plus the raw / decimated sample rates and the filtering time per output sample.
+ */
+
+#include "meas_source_synth.h"
+#include "xtime_l.h"
+#include <stdio.h>
+#include <math.h>
+
+#define SECONDS		4
+
+/// @brief Peak deviation of the published voltage from dc over the last second.
+static float run(const char *name, const SynthSignal_t *signal, float *mean)
+{
+	const u32 per_ms = MEAS_DECIMATION;
+	float peak = 0;
+	float sum = 0;
+	u32 count = 0;
+
+	MeasSourceSynth_SetSignal(signal);
+	MeasFrontend_Start(&MeasSourceSynth);
+
+	for (u32 ms = 0; ms < SECONDS * 1000; ms++)
+	{
+		float v;
+
+		MeasSourceSynth_Run(per_ms);
+		if (ms >= (SECONDS - 1) * 1000 && MeasFrontend_GetLatest(&v))
+		{
+			peak = fmaxf(peak, fabsf(v - signal->dc));
+			sum += v;
+			count++;
+		}
+	}
+
+	MeasStats_t stats;
+	MeasFrontend_GetStats(&stats);
+	MeasFrontend_Stop();
+
+	*mean = count ? sum / count : 0;
+	printf("%-30s mean %8.3f V  peak dev %7.3f V  in %u / out %u samples, %u dropped, %.1f ns filter per output\n",
+		   name, *mean, peak, stats.raw_samples, stats.out_samples, stats.dropped_blocks,
+		   1e9 * stats.busy_counts / COUNTS_PER_SECOND / stats.out_samples);
+	return peak;
+}
+
+int main(void)
+{
+	float mean;
+	const float out_nyquist = MeasSourceSynth.sample_rate / MEAS_DECIMATION / 2;
+
+	SynthSignal_t dc = { 200.0f, 0.0f, 0.0f, 2.0f };
+	SynthSignal_t pass = { 200.0f, 10.0f, 20.0f, 0.0f };
+	SynthSignal_t alias = { 200.0f, 10.0f, 2.5f * out_nyquist, 0.0f };
+
+	printf("raw rate %.0f Hz, output rate %.0f Hz, %d taps\n",
+		   MeasSourceSynth.sample_rate, MeasSourceSynth.sample_rate / MEAS_DECIMATION, MEAS_FIR_TAPS);
+	run("200 V + 2 V noise", &dc, &mean);
+	run("200 V + 10 V at 20 Hz", &pass, &mean);
+	run("200 V + 10 V above Nyquist", &alias, &mean);
+	return 0;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file meas_source_synth.c
+ * @brief Synthetic signal source for the measurement front-end in host builds.
+ */
+
+#include "meas_source_synth.h"
+#include "system_params.h"
+#include <math.h>
+#include <stdlib.h>
+
+#define SYNTH_FULL_SCALE	400.0f
+
+static SynthSignal_t synth = { 200.0f, 0.0f, 0.0f, 0.0f };
+static bool running = false;
+static u32 n = 0;
+
+static int synth_start(void)
+{
+	running = true;
+	n = 0;
+	return XST_SUCCESS;
+}
+
+static void synth_stop(void)
+{
+	running = false;
+}
+
+const MeasSource_t MeasSourceSynth = {
+	"synth",
+	MEAS_DECIMATION * 1000.0f / controller_interval,
+	SYNTH_FULL_SCALE / 65536.0f,
+	synth_start,
+	synth_stop
+};
+
+void MeasSourceSynth_SetSignal(const SynthSignal_t *signal)
+{
+	synth = *signal;
+}
+
+u32 MeasSourceSynth_Run(u32 samples)
+{
+	u32 processed = 0;
+
+	for (u32 i = 0; i < samples && running; i++, n++)
+	{
+		float t = n / MeasSourceSynth.sample_rate;
+		float v = synth.dc + synth.amplitude * sinf(2.0f * (float)M_PI * synth.freq * t) +
+				  synth.noise * (2.0f * rand() / (float)RAND_MAX - 1.0f);
+		float code = v / MeasSourceSynth.volts_per_lsb;
+
+		// 12-bit converter, MSB aligned like the XADC registers.
+		code = (code < 0) ? 0 : (code > 65535.0f) ? 65535.0f : code;
+		if (MeasFrontend_CaptureSample((u16)code & 0xFFF0))
+		{
+			processed += MeasFrontend_Process();
+		}
+	}
+	return processed;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file meas_source_synth.h
+ * @brief Synthetic signal source for the measurement front-end in host builds.
+ *
+ * Stands in for the XADC: produces 16-bit codes of a DC level plus a sine plus
+ * uniform noise at the same rate and scale as MeasSourceXadc.
+ */
+
+#ifndef MEAS_SOURCE_SYNTH_H
+#define MEAS_SOURCE_SYNTH_H
+
+#include "meas_frontend.h"
+
+typedef struct {
+	float dc;			// V
+	float amplitude;	// V
+	float freq;			// Hz
+	float noise;		// Peak V, uniform
+} SynthSignal_t;
+
+extern const MeasSource_t MeasSourceSynth;
+
+void MeasSourceSynth_SetSignal(const SynthSignal_t *signal);
+
+/// @brief Generates samples like the sample clock ISR would. Runs the front-end
+/// processing whenever a block completes, like meas_task.
+/// @return Number of blocks processed.
+u32 MeasSourceSynth_Run(u32 samples);
+
+#endif
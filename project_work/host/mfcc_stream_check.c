@@ -0,0 +1,150 @@
+/**
+ * @file mfcc_stream_check.c
+ * @brief Checks the streaming MFCC of the linked CMSIS-DSP build against arm_mfcc_f32 frame by frame.
+ *
+ * Usage:
+ *   mfcc_stream_check
+ *
+ * 256 and 1024 sample frames with the DCT matrix (40 Mel filters) and the fast DCT
+ * (32 and 64), several hops, 1 and 2 channels, 1 to 16 frames per batch: a stream fed
+ * in blocks of random size must give, for every frame, the arm_mfcc_f32 of that frame
+ * within MAX_ERROR (relative RMS), and as many frames. Exits 1 on the first failure.
+ */
+
+#include "arm_math.h"
+#include "check_util.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LEN			1024
+#define MAX_FILTERS		64
+#define MAX_CHANNELS	2
+#define MAX_BATCH		16
+#define SIGNAL_LEN		(8 * MAX_LEN)	// Samples per channel
+
+static float32_t x[SIGNAL_LEN * MAX_CHANNELS];
+static float32_t out[(3 * MAX_LEN + 1) * MAX_CHANNELS * MAX_FILTERS];	// Block of 3 * n, hop 1 at worst
+static float32_t state[3 * MAX_LEN * MAX_CHANNELS + 2 * MAX_BATCH * MAX_CHANNELS * (MAX_LEN / 2 + 1)];
+static float32_t window[MAX_LEN], frame[MAX_LEN], tmp[2 * MAX_LEN], ref[MAX_FILTERS];
+static float32_t dct_coefs[MAX_FILTERS * MAX_FILTERS], filter_coefs[MAX_FILTERS * 64], dct_twiddle[3 * MAX_FILTERS];
+static uint32_t filter_pos[MAX_FILTERS], filter_lengths[MAX_FILTERS];
+#if defined(ARM_FFT_RUNTIME_TABLES)
+static uint64_t tables_pool[128 * 1024 / sizeof(uint64_t)];
+#endif
+
+/// @brief Triangular filters spread over the bins below n/2, the DCT matrix of the scripts, a Hamming window.
+static void make_mfcc(arm_mfcc_instance_f32 *M, arm_dct_instance_f32 *D, uint32_t n, uint32_t filters, uint32_t outputs, int fast)
+{
+	const uint32_t width = 2 * (n / 2) / (filters + 1);
+	uint32_t count = 0;
+
+	for (uint32_t i = 0; i < filters; i++)
+	{
+		filter_pos[i] = i * (n / 2 - width) / filters + 1;
+		filter_lengths[i] = width;
+		for (uint32_t j = 0; j < width; j++)
+		{
+			filter_coefs[count++] = 1.0f - fabsf(2.0f * (j + 0.5f) / width - 1.0f);
+		}
+	}
+	for (uint32_t i = 0; i < outputs; i++)
+	{
+		for (uint32_t j = 0; j < filters; j++)
+		{
+			dct_coefs[i * filters + j] = (float32_t)(cos(i * M_PI * (j + 0.5) / filters) * sqrt(2.0 / filters));
+		}
+	}
+	arm_hamming_f32(window, n);
+	arm_mfcc_init_f32(M, n, filters, outputs, dct_coefs, filter_pos, filter_lengths, filter_coefs, window);
+	if (fast)
+	{
+		arm_dct_init_f32(D, filters, dct_twiddle);
+		arm_mfcc_init_dct_f32(M, D);
+	}
+}
+
+static int check_stream(uint32_t n, uint32_t filters, uint32_t outputs, int fast, uint32_t hop, uint32_t channels, uint32_t batch)
+{
+	arm_mfcc_instance_f32 M;
+	arm_dct_instance_f32 D;
+	arm_mfcc_stream_instance_f32 S;
+	uint32_t frames = 0, done = 0;
+
+	make_mfcc(&M, &D, n, filters, outputs, fast);
+	if (arm_mfcc_stream_init_f32(&S, &M, hop, channels, batch, state) != ARM_MATH_SUCCESS)
+	{
+		fprintf(stderr, "arm_mfcc_stream_init_f32: n %u, hop %u, %u channels, %u frames rejected\n", n, hop, channels, batch);
+		return 0;
+	}
+	for (uint32_t i = 0; i < SIGNAL_LEN * channels; i++)
+	{
+		x[i] = random_value();
+	}
+
+	while (done < SIGNAL_LEN)
+	{
+		uint32_t block = (uint32_t)(random_bits() % (3 * n + 1));
+		uint32_t count;
+
+		block = (block < SIGNAL_LEN - done) ? block : SIGNAL_LEN - done;
+		count = arm_mfcc_stream_f32(&S, x + done * channels, block, out);
+		done += block;
+
+		checks++;
+		if (frames + count != (done >= n ? (done - n) / hop + 1 : 0))
+		{
+			fprintf(stderr, "arm_mfcc_stream_f32: n %u, hop %u: %u frames after %u samples\n", n, hop, frames + count, done);
+			return 0;
+		}
+
+		for (uint32_t f = 0; f < count; f++)
+		{
+			for (uint32_t c = 0; c < channels; c++)
+			{
+				for (uint32_t j = 0; j < n; j++)
+				{
+					frame[j] = x[((frames + f) * hop + j) * channels + c];
+				}
+				arm_mfcc_f32(&M, frame, ref, tmp);
+				if (!report(fast ? "arm_mfcc_stream_f32 fast DCT" : "arm_mfcc_stream_f32",
+							relative_error_f32(out + (f * channels + c) * outputs, ref, outputs), MAX_ERROR,
+							"n %u, hop %u, %u channels, batch %u: frame %u channel %u", n, hop, channels, batch, frames + f, c))
+				{
+					return 0;
+				}
+			}
+		}
+		frames += count;
+	}
+	return 1;
+}
+
+int main(void)
+{
+	// n, Mel filters, DCT outputs, fast DCT, hop
+	static const uint32_t configs[][5] = {
+		{ 256, 40, 13, 0, 128 }, { 256, 32, 13, 1, 100 }, { 1024, 40, 13, 0, 256 },
+		{ 1024, 64, 64, 1, 160 }, { 256, 40, 40, 0, 256 }, { 256, 32, 32, 1, 1 },
+	};
+	static const uint32_t batches[] = { 1, 5, MAX_BATCH };
+	int ok = 1;
+
+#if defined(ARM_FFT_RUNTIME_TABLES)
+	arm_fft_tables_pool_f32(tables_pool, sizeof(tables_pool));
+#endif
+	for (uint32_t k = 0; k < sizeof(configs) / sizeof(configs[0]) && ok; k++)
+	{
+		for (uint32_t channels = 1; channels <= MAX_CHANNELS && ok; channels++)
+		{
+			for (uint32_t b = 0; b < sizeof(batches) / sizeof(batches[0]) && ok; b++)
+			{
+				ok = check_stream(configs[k][0], configs[k][1], configs[k][2], (int)configs[k][3], configs[k][4], channels, batches[b]);
+			}
+		}
+	}
+
+	printf("%s: %u checks\n", ok ? "ok" : "FAILED", checks);
+	return ok ? 0 : 1;
+}
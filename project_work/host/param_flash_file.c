@@ -0,0 +1,122 @@
+/**
+ * @file param_flash_file.c
+ * @brief File-backed stand-in for the QSPI flash of the parameter store.
+ */
+
+#include "param_flash_file.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEAR_NONE 0xFFFFFFFF
+
+static FILE *image = NULL;
+static ParamFlash_t file_flash;
+static u32 tear_after = TEAR_NONE;
+
+static int file_read(u32 offset, void *buf, u32 len)
+{
+	if (fseek(image, offset, SEEK_SET) != 0 || fread(buf, 1, len, image) != len)
+	{
+		return XST_FAILURE;
+	}
+	return XST_SUCCESS;
+}
+
+static int file_program(u32 offset, const void *buf, u32 len)
+{
+	u8 cells[256];
+	const u8 *data = (const u8 *)buf;
+	int status = XST_SUCCESS;
+
+	if (len > sizeof(cells) || file_read(offset, cells, len) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+
+	if (tear_after != TEAR_NONE)
+	{
+		// Power cut: only the start of the data made it.
+		if (tear_after < len)
+		{
+			len = tear_after;
+		}
+		tear_after = TEAR_NONE;
+		status = XST_FAILURE;
+	}
+
+	// NOR flash can only turn ones into zeros.
+	for (u32 i = 0; i < len; i++)
+	{
+		cells[i] &= data[i];
+	}
+
+	if (fseek(image, offset, SEEK_SET) != 0 || fwrite(cells, 1, len, image) != len)
+	{
+		return XST_FAILURE;
+	}
+	fflush(image);
+	return status;
+}
+
+static int file_erase(u32 offset)
+{
+	u8 erased[256];
+
+	memset(erased, 0xFF, sizeof(erased));
+	if (fseek(image, offset, SEEK_SET) != 0)
+	{
+		return XST_FAILURE;
+	}
+	for (u32 i = 0; i < PARAM_STORE_SECTOR_SIZE; i += sizeof(erased))
+	{
+		if (fwrite(erased, 1, sizeof(erased), image) != sizeof(erased))
+		{
+			return XST_FAILURE;
+		}
+	}
+	fflush(image);
+	return XST_SUCCESS;
+}
+
+const ParamFlash_t *ParamFlashFile_Open(const char *path)
+{
+	image = fopen(path, "r+b");
+	if (image == NULL)
+	{
+		// New image: a fully erased flash.
+		image = fopen(path, "w+b");
+		if (image == NULL)
+		{
+			return NULL;
+		}
+		for (u32 s = 0; s < PARAM_STORE_SECTOR_COUNT; s++)
+		{
+			if (file_erase(s * PARAM_STORE_SECTOR_SIZE) != XST_SUCCESS)
+			{
+				fclose(image);
+				return NULL;
+			}
+		}
+	}
+
+	file_flash.sector_size = PARAM_STORE_SECTOR_SIZE;
+	file_flash.sector_count = PARAM_STORE_SECTOR_COUNT;
+	file_flash.read = file_read;
+	file_flash.program = file_program;
+	file_flash.erase = file_erase;
+	return &file_flash;
+}
+
+void ParamFlashFile_Close(void)
+{
+	if (image != NULL)
+	{
+		fclose(image);
+		image = NULL;
+	}
+}
+
+void ParamFlashFile_TearNextProgram(u32 bytes)
+{
+	tear_after = bytes;
+}
@@ -0,0 +1,24 @@
+/**
+ * @file param_flash_file.h
+ * @brief File-backed stand-in for the QSPI flash of the parameter store.
+ *
+ * Behaves like NOR flash: program can only clear bits and erase sets a sector
+ * back to 0xFF. A torn write (power loss mid program) can be injected.
+ */
+
+#ifndef PARAM_FLASH_FILE_H
+#define PARAM_FLASH_FILE_H
+
+#include "param_store.h"
+
+/// @brief Opens (or creates an erased) flash image file.
+/// @return Backend for ParamStore_Init, NULL on error.
+const ParamFlash_t *ParamFlashFile_Open(const char *path);
+
+void ParamFlashFile_Close(void);
+
+/// @brief The next program only writes the first bytes bytes and then fails,
+/// like a power cut in the middle of a page program.
+void ParamFlashFile_TearNextProgram(u32 bytes);
+
+#endif
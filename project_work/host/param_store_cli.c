@@ -0,0 +1,119 @@
+/**
+ * @file param_store_cli.c
+ * @brief Runs the parameter store against a flash image file on a PC.
+ *
+ * Usage:
+ *   param_store_cli <image> load
+ *   param_store_cli <image> save <kp> <ki> <kd> <u_ref> <mode>
+ *   param_store_cli <image> tear <bytes> <kp> <ki> <kd> <u_ref> <mode>
+ *   param_store_cli <image> retry <bytes> <kp> <ki> <kd> <u_ref> <mode>
+ *   param_store_cli <image> fill <count>
+ *
+ * tear simulates a power cut after <bytes> bytes of the record were programmed.
+ * retry is tear followed by a second save of the same values in the same boot, as the
+ * firmware does after a failed save; after a fill of a whole sector (2048 records) the
+ * torn record is the first of the next sector.
+ * fill appends <count> records, e.g. to run the log over several sectors.
+ * Every invocation is a fresh "boot", so load after tear shows the recovery.
+ */
+
+#include "param_store.h"
+#include "param_flash_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static int parse_values(char **argv, ParamValues_t *values)
+{
+	values->kp = (float)atof(argv[0]);
+	values->ki = (float)atof(argv[1]);
+	values->kd = (float)atof(argv[2]);
+	values->u_ref = (float)atof(argv[3]);
+	values->mode = (u32)atoi(argv[4]);
+	return 0;
+}
+
+static void print_values(const ParamValues_t *values)
+{
+	printf("kp %g ki %g kd %g u_ref %g mode %u\n",
+			values->kp, values->ki, values->kd, values->u_ref, values->mode);
+}
+
+int main(int argc, char **argv)
+{
+	ParamValues_t values;
+	const ParamFlash_t *flash;
+	struct timespec t0, t1;
+	int status = XST_SUCCESS;
+
+	if (argc < 3)
+	{
+		fprintf(stderr, "usage: %s <image> load | save kp ki kd u_ref mode | tear|retry bytes kp ki kd u_ref mode | fill count\n", argv[0]);
+		return 2;
+	}
+
+	flash = ParamFlashFile_Open(argv[1]);
+	if (flash == NULL)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	status = ParamStore_Init(flash);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	if (status != XST_SUCCESS)
+	{
+		fprintf(stderr, "init failed\n");
+		return 1;
+	}
+	printf("init: %.1f us\n", (t1.tv_sec - t0.tv_sec) * 1e6 + (t1.tv_nsec - t0.tv_nsec) / 1e3);
+
+	if (strcmp(argv[2], "load") == 0)
+	{
+		if (ParamStore_Load(&values) == XST_SUCCESS)
+		{
+			print_values(&values);
+		}
+		else
+		{
+			printf("empty\n");
+		}
+	}
+	else if (strcmp(argv[2], "save") == 0 && argc == 8)
+	{
+		parse_values(&argv[3], &values);
+		status = ParamStore_Save(&values);
+	}
+	else if ((strcmp(argv[2], "tear") == 0 || strcmp(argv[2], "retry") == 0) && argc == 9)
+	{
+		parse_values(&argv[4], &values);
+		ParamFlashFile_TearNextProgram((u32)atoi(argv[3]));
+		status = ParamStore_Save(&values);
+		printf("torn save: %s\n", status == XST_SUCCESS ? "ok" : "failed (expected)");
+		status = XST_SUCCESS;
+		if (strcmp(argv[2], "retry") == 0)
+		{
+			status = ParamStore_Save(&values);
+			printf("retry: %s\n", status == XST_SUCCESS ? "ok" : "failed");
+		}
+	}
+	else if (strcmp(argv[2], "fill") == 0 && argc == 4)
+	{
+		int count = atoi(argv[3]);
+		for (int i = 0; i < count && status == XST_SUCCESS; i++)
+		{
+			values = (ParamValues_t){ 4.5f, 6.0f, 0.01f, (float)(i % 400), 2 };
+			status = ParamStore_Save(&values);
+		}
+	}
+	else
+	{
+		fprintf(stderr, "bad command\n");
+		status = XST_FAILURE;
+	}
+
+	ParamFlashFile_Close();
+	return status == XST_SUCCESS ? 0 : 1;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file plant_batch.c
+ * @brief Batched plant model. See plant_batch.h.
+ */
+
+#include "plant_batch.h"
+
+void PlantBatch_SetLane(PlantBatch_t *batch, int lane,
+						const float a[PLANT_STATE_SIZE][PLANT_STATE_SIZE], const float b[PLANT_STATE_SIZE])
+{
+	for (int i = 0; i < PLANT_STATE_SIZE; i++)
+	{
+		for (int j = 0; j < PLANT_STATE_SIZE; j++)
+		{
+			batch->a[i][j][lane] = a[i][j];
+		}
+		batch->b[i][lane] = b[i];
+	}
+	PlantBatch_ResetLane(batch, lane);
+}
+
+void PlantBatch_ResetLane(PlantBatch_t *batch, int lane)
+{
+	for (int i = 0; i < PLANT_STATE_SIZE; i++)
+	{
+		batch->x[i][lane] = 0;
+	}
+}
+
+void PlantBatch_Step(PlantBatch_t *batch, const float *u_in, float *u_out)
+{
+	float next[PLANT_STATE_SIZE][PLANT_BATCH_LANES];
+
+	for (int i = 0; i < PLANT_STATE_SIZE; i++)
+	{
+		for (int l = 0; l < PLANT_BATCH_LANES; l++)
+		{
+			next[i][l] = batch->b[i][l] * u_in[l];
+		}
+		for (int j = 0; j < PLANT_STATE_SIZE; j++)
+		{
+			for (int l = 0; l < PLANT_BATCH_LANES; l++)
+			{
+				next[i][l] += batch->a[i][j][l] * batch->x[j][l];
+			}
+		}
+	}
+	for (int i = 0; i < PLANT_STATE_SIZE; i++)
+	{
+		for (int l = 0; l < PLANT_BATCH_LANES; l++)
+		{
+			batch->x[i][l] = next[i][l];
+		}
+	}
+	for (int l = 0; l < PLANT_BATCH_LANES; l++)
+	{
+		u_out[l] = batch->x[PLANT_STATE_SIZE - 1][l];
+	}
+}
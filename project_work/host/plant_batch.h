@@ -0,0 +1,36 @@
+/**
+ * @file plant_batch.h
+ * @brief Steps PLANT_BATCH_LANES variants of the plant model at once.
+ *
+ * Same update as PlantModel_Step, state = A * state + B * u, but every lane has its
+ * own A and B. Everything is stored lane-minor (structure of arrays), so the inner
+ * loop runs over the lanes with the same coefficient position and the compiler turns
+ * it into SIMD, instead of one 6x6 product per call and scenario.
+ */
+
+#ifndef PLANT_BATCH_H
+#define PLANT_BATCH_H
+
+#include "plant_model.h"
+
+#define PLANT_BATCH_LANES	16
+
+typedef struct {
+	float a[PLANT_STATE_SIZE][PLANT_STATE_SIZE][PLANT_BATCH_LANES];
+	float b[PLANT_STATE_SIZE][PLANT_BATCH_LANES];
+	float x[PLANT_STATE_SIZE][PLANT_BATCH_LANES];
+} PlantBatch_t;
+
+/// @brief Loads one lane's model and clears its state.
+void PlantBatch_SetLane(PlantBatch_t *batch, int lane,
+						const float a[PLANT_STATE_SIZE][PLANT_STATE_SIZE], const float b[PLANT_STATE_SIZE]);
+
+/// @brief Clears one lane's state, e.g. after it diverged.
+void PlantBatch_ResetLane(PlantBatch_t *batch, int lane);
+
+/// @brief One step of every lane.
+/// @param u_in PLANT_BATCH_LANES inputs.
+/// @param u_out PLANT_BATCH_LANES outputs, the last state.
+void PlantBatch_Step(PlantBatch_t *batch, const float *u_in, float *u_out);
+
+#endif
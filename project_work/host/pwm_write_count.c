@@ -0,0 +1,52 @@
+/**
+ * @file pwm_write_count.c
+ * @brief Counts the PWM register writes of the shadowed output stage on a PC.
+ *
+ * Feeds a plant-like voltage trace (first order steps between set points, 1 ms
+ * steps like plant_model_task) through updatePWMBrightness's channel mapping
+ * and prints how many bus writes were issued versus the old write-every-step code.
+ */
+
+#include "pwm_output.h"
+#include <stdio.h>
+
+#define STEPS			60000	// 60 s of 1 ms plant steps
+#define STEP_PERIOD		2000	// New set point every 2 s
+#define TAU_STEPS		50.0f	// Plant time constant in steps
+#define MAX_OUT_PLANT	400.0f
+
+static void run(const char *name, bool dither, u32 refresh)
+{
+	const float targets[] = { 0.0f, 400.0f, 250.0f, 260.0f, 100.0f, 0.0f };
+	const int n_targets = sizeof(targets) / sizeof(targets[0]);
+	float u = 0.0f;
+	PwmOutputStats_t stats;
+
+	PWM_OutputInit();
+	PWM_OutputSetDithering(dither);
+	PWM_OutputSetRefreshInterval(refresh);
+
+	for (int k = 0; k < STEPS; k++)
+	{
+		float target = targets[(k / STEP_PERIOD) % n_targets];
+		u += (target - u) / TAU_STEPS;
+
+		float duty = u / MAX_OUT_PLANT;
+		PWM_OutputSetDuty(PWM_TTC0_1, duty);
+		PWM_OutputSetDuty(PWM_TTC0_2, duty / 2);
+		PWM_OutputCommit();
+	}
+
+	PWM_OutputGetStats(&stats);
+	printf("%-28s commits %6u  requested %6u  written %6u  (%.1f %% of requested)\n",
+			name, stats.commits, stats.requested, stats.written,
+			100.0 * stats.written / stats.requested);
+}
+
+int main(void)
+{
+	run("shadowed", false, 0);
+	run("shadowed + 1 s refresh", false, PWM_DEFAULT_REFRESH_INTERVAL);
+	run("shadowed + dithering", true, PWM_DEFAULT_REFRESH_INTERVAL);
+	return 0;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file replay.c
+ * @brief Replays a field capture through the native build of controller.c / plant.c.
+ *
+ * Usage:
+ *   replay [-s snapshot.hex] [-o final.hex] [-c] capture.csv
+ *
+ * capture.csv has one sample per line: u_ref,u_meas
+ *   -s  start from a warm-restart snapshot (hex, as printed by the UART 'snapshot' command)
+ *   -o  write the snapshot at the end of the replay
+ *   -c  closed loop: ignore u_meas and feed the controller from the plant model
+ *
+ * Prints k,u_ref,u_meas,u_out per sample.
+ */
+
+#include "controller.h"
+#include "plant.h"
+#include "state_snapshot.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static int read_hex_blob(const char *path, u8 *blob, u32 size)
+{
+	FILE *f = fopen(path, "r");
+	u32 n = 0;
+	unsigned int byte;
+
+	if (f == NULL)
+	{
+		return -1;
+	}
+	while (n < size && fscanf(f, "%2x", &byte) == 1)
+	{
+		blob[n++] = (u8)byte;
+	}
+	fclose(f);
+	return (int)n;
+}
+
+static int write_hex_blob(const char *path, const u8 *blob, u32 size)
+{
+	FILE *f = fopen(path, "w");
+
+	if (f == NULL)
+	{
+		return -1;
+	}
+	for (u32 i = 0; i < size; i++)
+	{
+		fprintf(f, "%02X", blob[i]);
+	}
+	fprintf(f, "\n");
+	fclose(f);
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	const char *snapshot_in = NULL;
+	const char *snapshot_out = NULL;
+	int closed_loop = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "s:o:c")) != -1)
+	{
+		switch (opt)
+		{
+		case 's': snapshot_in = optarg; break;
+		case 'o': snapshot_out = optarg; break;
+		case 'c': closed_loop = 1; break;
+		default:
+			fprintf(stderr, "usage: %s [-s snapshot.hex] [-o final.hex] [-c] capture.csv\n", argv[0]);
+			return 2;
+		}
+	}
+	if (optind >= argc)
+	{
+		fprintf(stderr, "usage: %s [-s snapshot.hex] [-o final.hex] [-c] capture.csv\n", argv[0]);
+		return 2;
+	}
+
+	ControlSnapshot_t snap;
+	u8 blob[SNAPSHOT_BLOB_SIZE];
+
+	if (snapshot_in != NULL)
+	{
+		int len = read_hex_blob(snapshot_in, blob, sizeof(blob));
+		if (len < 0 || Snapshot_Decode(blob, (u32)len, &snap) != XST_SUCCESS)
+		{
+			fprintf(stderr, "%s: not a valid snapshot\n", snapshot_in);
+			return 1;
+		}
+		Snapshot_Apply(&snap);
+	}
+
+	// Start from whatever the controller holds now: compiled defaults or the snapshot.
+	Snapshot_Capture(&snap);
+	PIDControllerState_t state = snap.pid;
+	float u_out = snap.u_out;
+	float u_plant = snap.plant_state[5];
+
+	FILE *capture = fopen(argv[optind], "r");
+	if (capture == NULL)
+	{
+		perror(argv[optind]);
+		return 1;
+	}
+
+	char line[128];
+	long k = 0;
+	float u_ref = 0;
+	float u_meas = 0;
+
+	printf("k,u_ref,u_meas,u_out\n");
+	while (fgets(line, sizeof(line), capture) != NULL)
+	{
+		if (sscanf(line, "%f,%f", &u_ref, &u_meas) < 1)
+		{
+			continue;	// header or empty line
+		}
+		if (closed_loop)
+		{
+			u_meas = u_plant;
+		}
+
+		u_out = PID_controller(u_meas, u_ref, snap.kd, snap.ki, snap.kp, 0, &state);
+
+		if (closed_loop)
+		{
+			u_plant = plantModelStep(u_out);
+		}
+		printf("%ld,%g,%g,%g\n", k++, u_ref, u_meas, u_out);
+	}
+	fclose(capture);
+
+	if (snapshot_out != NULL)
+	{
+		snap.pid = state;
+		snap.u_ref = u_ref;
+		snap.u_out = u_out;
+		getPlantState(snap.plant_state);
+		Snapshot_Encode(&snap, blob, sizeof(blob));
+		if (write_hex_blob(snapshot_out, blob, sizeof(blob)) != 0)
+		{
+			perror(snapshot_out);
+			return 1;
+		}
+	}
+	return 0;
+}
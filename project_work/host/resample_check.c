@@ -0,0 +1,294 @@
+/**
+ * @file resample_check.c
+ * @brief Checks the rational and Farrow resamplers of the linked CMSIS-DSP build against references in double.
+ *
+ * Usage:
+ *   resample_check
+ *
+ * Rational factors L / M from 3 / 1000 to 320 / 147, fed in blocks of random sizes, must
+ * give the expected number of outputs, match the polyphase sum in double within
+ * MAX_ERROR (relative RMS) and, for L up to 255, every M-th output of
+ * arm_fir_interpolate_f32 with the same coefficients. The Farrow resampler, with random
+ * filters and cubic Lagrange interpolation, must match its definition in double at
+ * the 32.32 positions, across a change of ratio in the middle of the stream, and
+ * delay by exactly 2 samples at ratio 1 with Lagrange. Unsupported arguments must be
+ * rejected. Exits 1 on the first failure.
+ */
+
+#include "arm_math.h"
+#include "check_util.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_TAPS		4096
+#define MAX_LEN			8192	// Input samples
+#define MAX_OUT			(16 * MAX_LEN)
+#define MAX_BLOCK		256		// Internal block size
+
+static float32_t coeffs[MAX_TAPS], x[MAX_LEN], y[MAX_OUT];
+static float32_t state[MAX_TAPS + MAX_BLOCK], interp_out[MAX_LEN * UINT8_MAX];
+static double ref[MAX_OUT];
+
+/// Cubic Lagrange interpolation between the second and third of 4 samples.
+static const float32_t lagrange[4 * 4] = {
+	0.0f, 1.0f, 0.0f, 0.0f,
+	-1.0f / 3.0f, -0.5f, 1.0f, -1.0f / 6.0f,
+	0.5f, -1.0f, 0.5f, 0.0f,
+	-1.0f / 6.0f, 0.5f, -0.5f, 1.0f / 6.0f,
+};
+
+/// @brief Random block size from 0 to 3 * limit.
+static uint32_t random_block(uint32_t limit)
+{
+	return (uint32_t)((random_value() + 0.5f) * (float32_t)(3 * limit + 1));
+}
+
+static int check_count(const char *what, const char *config, uint32_t count, uint32_t expected)
+{
+	checks++;
+	if (count != expected)
+	{
+		fprintf(stderr, "%s: %s: %u outputs, expected %u\n", what, config, count, expected);
+		return 0;
+	}
+	return 1;
+}
+
+/// @brief Output m of the L / M resampler in double: upsampled sample M * m of the interpolator.
+static double rational_reference(uint32_t m, uint32_t L, uint32_t M, uint32_t taps)
+{
+	const uint64_t n = (uint64_t)M * m;
+	const uint32_t q = (uint32_t)(n / L), r = (uint32_t)(n % L);
+	double sum = 0;
+
+	for (uint32_t i = 0; r + L * i < taps && i <= q; i++)
+	{
+		sum += (double)coeffs[taps - 1 - (r + L * i)] * x[q - i];
+	}
+	return sum;
+}
+
+static int check_rational(uint16_t L, uint16_t M, uint32_t phase_length, uint32_t block)
+{
+	const uint32_t taps = L * phase_length;
+	const uint32_t len = MAX_LEN;
+	const uint32_t expected = (uint32_t)(((uint64_t)len * L - 1) / M) + 1;	// M * m < L * len
+	arm_resample_instance_f32 S;
+	char config[64];
+	uint32_t count = 0;
+	int ok;
+
+	snprintf(config, sizeof(config), "L %u, M %u, %u taps, block %u", L, M, taps, block);
+	for (uint32_t k = 0; k < taps; k++)
+	{
+		coeffs[k] = random_value();
+	}
+	for (uint32_t i = 0; i < len; i++)
+	{
+		x[i] = random_value();
+	}
+	if (!check_status("arm_resample_init_f32", arm_resample_init_f32(&S, L, M, taps, coeffs, state, block),
+					  ARM_MATH_SUCCESS, "%s", config))
+	{
+		return 0;
+	}
+
+	for (uint32_t done = 0; done < len;)
+	{
+		uint32_t n = random_block(block);
+
+		n = n > len - done ? len - done : n;
+		count += arm_resample_f32(&S, x + done, y + count, n);
+		done += n;
+	}
+	if (!check_count("arm_resample_f32", config, count, expected))
+	{
+		return 0;
+	}
+
+	for (uint32_t m = 0; m < count; m++)
+	{
+		ref[m] = rational_reference(m, L, M, taps);
+	}
+	ok = report("arm_resample_f32", relative_error(y, ref, count), MAX_ERROR, "%s", config);
+
+	// Same coefficients, same outputs as the interpolator
+	if (ok && L <= UINT8_MAX && taps <= UINT16_MAX)
+	{
+		arm_fir_interpolate_instance_f32 I;
+		static float32_t interp_state[MAX_TAPS + MAX_LEN];
+
+		ok = check_status("arm_fir_interpolate_init_f32", arm_fir_interpolate_init_f32(&I, (uint8_t)L, (uint16_t)taps, coeffs, interp_state, len),
+						  ARM_MATH_SUCCESS,
+						  "%s", config);
+		if (ok)
+		{
+			arm_fir_interpolate_f32(&I, x, interp_out, len);
+			for (uint32_t m = 0; m < count; m++)
+			{
+				ref[m] = interp_out[(uint64_t)M * m];
+			}
+			ok = report("arm_resample_f32 against arm_fir_interpolate_f32", relative_error(y, ref, count), MAX_ERROR, "%s", config);
+		}
+	}
+	return ok;
+}
+
+/// @brief Output at position pos (32.32) of the Farrow resampler in double.
+static double farrow_reference(uint64_t pos, const float32_t *pCoeffs, uint32_t taps, uint32_t order)
+{
+	const int64_t n = (int64_t)(pos >> 32);
+	const double mu = (double)(uint32_t)pos / 4294967296.0;
+	double sum = 0, power = 1;
+
+	for (uint32_t k = 0; k <= order; k++, power *= mu)
+	{
+		double dot = 0;
+
+		for (uint32_t t = 0; t < taps; t++)
+		{
+			const int64_t i = n - (int64_t)taps + 1 + t;
+
+			dot += i >= 0 ? (double)pCoeffs[k * taps + t] * x[i] : 0.0;
+		}
+		sum += power * dot;
+	}
+	return sum;
+}
+
+static int check_farrow(const float32_t *pCoeffs, uint16_t taps, uint16_t order, double ratio, double ratio2, uint32_t block)
+{
+	const uint32_t len = MAX_LEN;
+	arm_resample_farrow_instance_f32 S;
+	char config[96];
+	uint32_t count = 0, change = 0;
+	uint64_t step, step2, pos = 0;
+	int ok;
+
+	snprintf(config, sizeof(config), "%u taps, order %u, ratio %.9g then %.9g, block %u", taps, order, ratio, ratio2, block);
+	for (uint32_t i = 0; i < len; i++)
+	{
+		x[i] = random_value();
+	}
+	if (!check_status("arm_resample_farrow_init_f32", arm_resample_farrow_init_f32(&S, taps, order, pCoeffs, ratio, state, block),
+					  ARM_MATH_SUCCESS, "%s", config))
+	{
+		return 0;
+	}
+	step = S.step;
+
+	for (uint32_t done = 0; done < len;)
+	{
+		uint32_t n = random_block(block);
+
+		n = n > len - done ? len - done : n;
+		count += arm_resample_farrow_f32(&S, x + done, y + count, n);
+		done += n;
+
+		// Change of ratio after the first half
+		if (change == 0 && done >= len / 2)
+		{
+			change = count;
+			if (!check_status("arm_resample_farrow_set_ratio_f32", arm_resample_farrow_set_ratio_f32(&S, ratio2),
+							  ARM_MATH_SUCCESS, "%s", config))
+			{
+				return 0;
+			}
+		}
+	}
+	step2 = S.step;
+
+	// Outputs at the positions before len, the step changing at output change
+	for (uint32_t m = 0;; m++)
+	{
+		if ((pos >> 32) >= len || m >= MAX_OUT)
+		{
+			if (!check_count("arm_resample_farrow_f32", config, count, m))
+			{
+				return 0;
+			}
+			break;
+		}
+		ref[m] = farrow_reference(pos, pCoeffs, taps, order);
+		pos += m < change ? step : step2;
+	}
+	ok = report("arm_resample_farrow_f32", relative_error(y, ref, count), MAX_ERROR, "%s", config);
+	return ok;
+}
+
+int main(void)
+{
+	static const struct { uint16_t L, M; uint32_t phase_length, block; } rational[] = {
+		{ 1, 1, 4, 64 }, { 2, 1, 8, 1 }, { 1, 2, 8, 7 }, { 3, 2, 8, 64 }, { 2, 3, 8, 256 },
+		{ 4, 1, 6, 33 }, { 1, 4, 12, 64 }, { 5, 5, 3, 16 }, { 6, 4, 5, 100 }, { 7, 3, 1, 64 },
+		{ 160, 147, 16, 256 }, { 147, 160, 16, 64 }, { 320, 147, 12, 50 }, { 3, 1000, 16, 256 },
+	};
+	static const struct { double ratio, ratio2; uint32_t block; } farrow[] = {
+		{ 1.0, 1.0001, 64 }, { 44100.0 / 48000.0, 44100.0 / 48000.0 * 0.9999, 256 },
+		{ 48000.0 / 44100.0, 48000.0 / 44100.0 * 1.0001, 7 }, { 0.5, 0.25, 64 },
+		{ 2.37, 1.9, 1 }, { 1.0 / 3.0, 3.0, 100 },
+	};
+	float32_t farrow_coeffs[8 * 3];
+	arm_resample_instance_f32 R;
+	arm_resample_farrow_instance_f32 F;
+	int ok = 1;
+
+	for (uint32_t k = 0; k < sizeof(rational) / sizeof(rational[0]) && ok; k++)
+	{
+		ok = check_rational(rational[k].L, rational[k].M, rational[k].phase_length, rational[k].block);
+	}
+
+	for (uint32_t k = 0; k < sizeof(farrow_coeffs) / sizeof(farrow_coeffs[0]); k++)
+	{
+		farrow_coeffs[k] = random_value();
+	}
+	for (uint32_t k = 0; k < sizeof(farrow) / sizeof(farrow[0]) && ok; k++)
+	{
+		ok = check_farrow(lagrange, 4, 3, farrow[k].ratio, farrow[k].ratio2, farrow[k].block)
+			&& check_farrow(farrow_coeffs, 8, 2, farrow[k].ratio, farrow[k].ratio2, farrow[k].block)
+			&& check_farrow(farrow_coeffs, 1, 0, farrow[k].ratio, farrow[k].ratio2, farrow[k].block);
+	}
+
+	// Lagrange at ratio 1 is a delay of exactly 2 samples
+	if (ok)
+	{
+		uint32_t count;
+
+		for (uint32_t i = 0; i < MAX_LEN; i++)
+		{
+			x[i] = random_value();
+		}
+		arm_resample_farrow_init_f32(&F, 4, 3, lagrange, 1.0, state, 100);
+		count = arm_resample_farrow_f32(&F, x, y, MAX_LEN);
+		ok = check_count("arm_resample_farrow_f32", "Lagrange, ratio 1", count, MAX_LEN);
+		for (uint32_t i = 2; i < MAX_LEN && ok; i++)
+		{
+			ok = y[i] == x[i - 2];
+		}
+		checks++;
+		if (!ok)
+		{
+			fprintf(stderr, "arm_resample_farrow_f32: Lagrange, ratio 1: not a delay of 2 samples\n");
+		}
+	}
+
+	ok = ok && check_status("arm_resample_init_f32", arm_resample_init_f32(&R, 3, 2, 10, coeffs, state, 64),
+							ARM_MATH_LENGTH_ERROR, "numTaps not a multiple of L");
+	ok = ok && check_status("arm_resample_init_f32", arm_resample_init_f32(&R, 0, 2, 10, coeffs, state, 64),
+							ARM_MATH_ARGUMENT_ERROR, "L 0");
+	ok = ok && check_status("arm_resample_init_f32", arm_resample_init_f32(&R, 2, 0, 10, coeffs, state, 64),
+							ARM_MATH_ARGUMENT_ERROR, "M 0");
+	ok = ok && check_status("arm_resample_init_f32", arm_resample_init_f32(&R, 2, 3, 10, coeffs, state, 0),
+							ARM_MATH_ARGUMENT_ERROR, "blockSize 0");
+	ok = ok && check_status("arm_resample_farrow_init_f32", arm_resample_farrow_init_f32(&F, 4, 3, lagrange, 0.0, state, 64),
+							ARM_MATH_ARGUMENT_ERROR, "ratio 0");
+	ok = ok && check_status("arm_resample_farrow_init_f32", arm_resample_farrow_init_f32(&F, 4, 3, lagrange, NAN, state, 64),
+							ARM_MATH_ARGUMENT_ERROR, "ratio NaN");
+	ok = ok && check_status("arm_resample_farrow_init_f32", arm_resample_farrow_init_f32(&F, 0, 3, lagrange, 1.0, state, 64),
+							ARM_MATH_ARGUMENT_ERROR, "numTaps 0");
+
+	printf("%s: %u checks\n", ok ? "ok" : "FAILED", checks);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file host_shim.c
+ * @brief Minimal stand-ins for the FreeRTOS / Xilinx calls used by the
+ * control modules, so controller.c and plant.c build and run natively.
+ *
+ * Everything runs in one thread: mutexes always succeed, critical sections are
+ * no-ops, the tick counter advances by the requested delay in vTaskDelay / vTaskDelayUntil.
+ */
+
+#include "host_shim.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "xtime_l.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <time.h>
+
+// Normally created in main.c
+SemaphoreHandle_t control_out_MUTEX = (SemaphoreHandle_t)1;
+SemaphoreHandle_t u_out_plant_MUTEX = (SemaphoreHandle_t)1;
+SemaphoreHandle_t controller_params_MUTEX = (SemaphoreHandle_t)1;
+SemaphoreHandle_t sys_mode_MUTEX = (SemaphoreHandle_t)1;
+TaskHandle_t log_task_handle = NULL;
+
+static SystemMode_t host_mode = MODE_MODULATION;
+static TickType_t host_ticks = 0;
+
+void HostShim_SetSystemMode(SystemMode_t mode)
+{
+	host_mode = mode;
+}
+
+// Normally in ui_control.c
+SystemMode_t getSystemMode(void)
+{
+	return host_mode;
+}
+
+BaseType_t xQueueSemaphoreTake(QueueHandle_t xQueue, TickType_t xTicksToWait)
+{
+	(void)xQueue;
+	(void)xTicksToWait;
+	return pdTRUE;
+}
+
+BaseType_t xQueueGenericSend(QueueHandle_t xQueue, const void * const pvItemToQueue, TickType_t xTicksToWait, const BaseType_t xCopyPosition)
+{
+	(void)xQueue;
+	(void)pvItemToQueue;
+	(void)xTicksToWait;
+	(void)xCopyPosition;
+	return pdTRUE;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+	return host_ticks;
+}
+
+void vTaskDelayUntil(TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement)
+{
+	*pxPreviousWakeTime += xTimeIncrement;
+	host_ticks = *pxPreviousWakeTime;
+}
+
+void vTaskDelay(const TickType_t xTicksToDelay)
+{
+	host_ticks += xTicksToDelay;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait)
+{
+	(void)xClearCountOnExit;
+	(void)xTicksToWait;
+	return 1;
+}
+
+BaseType_t xTaskGenericNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue)
+{
+	(void)xTaskToNotify;
+	(void)ulValue;
+	(void)eAction;
+	(void)pulPreviousNotificationValue;
+	return pdPASS;
+}
+
+void XTime_GetTime(XTime *Xtime_Global)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	*Xtime_Global = (XTime)ts.tv_sec * COUNTS_PER_SECOND + (XTime)ts.tv_nsec * (COUNTS_PER_SECOND / 1000000) / 1000;
+}
+
+void vPortEnterCritical(void)
+{
+}
+
+void vPortExitCritical(void)
+{
+}
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list args;
+
+	va_start(args, ctrl1);
+	vfprintf(stderr, ctrl1, args);
+	va_end(args);
+}
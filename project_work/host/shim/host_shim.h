@@ -0,0 +1,14 @@
+/**
+ * @file host_shim.h
+ * @brief Controls for the FreeRTOS / Xilinx stand-ins of host builds.
+ */
+
+#ifndef HOST_SHIM_H
+#define HOST_SHIM_H
+
+#include "system_params.h"
+
+/// @brief Mode returned by getSystemMode() in host builds. Defaults to MODE_MODULATION.
+void HostShim_SetSystemMode(SystemMode_t mode);
+
+#endif
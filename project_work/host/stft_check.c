@@ -0,0 +1,158 @@
+/**
+ * @file stft_check.c
+ * @brief Checks the streaming STFT of the linked CMSIS-DSP build against a per-frame reference.
+ *
+ * Usage:
+ *   stft_check
+ *
+ * Frames of 256 and 1024 samples with several hops, 1, 3 and 8 channels and the three
+ * output types: a stream fed in blocks of random size (0 to 3 frames) must give the
+ * frames of the whole signal, each one windowed and transformed by arm_rfft_fast_f32,
+ * within MAX_ERROR (relative RMS), and as many of them. Bad arguments must be rejected.
+ * Exits 1 on the first failure.
+ */
+
+#include "arm_math.h"
+#include "check_util.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LEN			1024
+#define MAX_CHANNELS	8
+#define SIGNAL_LEN		(8 * MAX_LEN)	// Samples per channel
+#define MAX_OUT			((3 * 256 + 1) * 256 * MAX_CHANNELS)	// Most frames of a block: 3 * n samples, hop 1
+
+static float32_t x[SIGNAL_LEN * MAX_CHANNELS];
+static float32_t out[MAX_OUT];
+static float32_t state[3 * MAX_LEN * MAX_CHANNELS];
+static float32_t window[MAX_LEN], frame[MAX_LEN], spectrum[MAX_LEN], ref[MAX_LEN];
+#if defined(ARM_FFT_RUNTIME_TABLES)
+static uint64_t tables_pool[128 * 1024 / sizeof(uint64_t)];
+#endif
+
+/// @brief Frame f of channel c, windowed, through arm_rfft_fast_f32 and to the output type, into ref.
+static uint32_t reference(arm_rfft_fast_instance_f32 *R, uint32_t n, uint32_t hop, uint32_t channels,
+						  arm_stft_output type, uint32_t f, uint32_t c)
+{
+	for (uint32_t j = 0; j < n; j++)
+	{
+		frame[j] = x[(f * hop + j) * channels + c] * window[j];
+	}
+	arm_rfft_fast_f32(R, frame, spectrum, 0);
+	if (type == ARM_STFT_COMPLEX)
+	{
+		memcpy(ref, spectrum, n * sizeof(float32_t));
+		return n;
+	}
+
+	ref[0] = spectrum[0] * spectrum[0];
+	ref[n / 2] = spectrum[1] * spectrum[1];
+	for (uint32_t k = 1; k < n / 2; k++)
+	{
+		ref[k] = spectrum[2 * k] * spectrum[2 * k] + spectrum[2 * k + 1] * spectrum[2 * k + 1];
+	}
+	if (type == ARM_STFT_MAGNITUDE)
+	{
+		for (uint32_t k = 0; k <= n / 2; k++)
+		{
+			ref[k] = sqrtf(ref[k]);
+		}
+	}
+	return n / 2 + 1;
+}
+
+static int check_stream(uint32_t n, uint32_t hop, uint32_t channels, arm_stft_output type)
+{
+	static const char *names[] = { "complex", "magnitude", "power" };
+	arm_stft_instance_f32 S;
+	arm_rfft_fast_instance_f32 R;
+	uint32_t frames = 0, done = 0, size;
+
+	arm_hanning_f32(window, n);
+	if (arm_stft_init_f32(&S, n, hop, channels, type, window, state) != ARM_MATH_SUCCESS)
+	{
+		fprintf(stderr, "arm_stft_init_f32: n %u, hop %u, %u channels rejected\n", n, hop, channels);
+		return 0;
+	}
+	arm_rfft_fast_init_f32(&R, n);
+	for (uint32_t i = 0; i < SIGNAL_LEN * channels; i++)
+	{
+		x[i] = random_value();
+	}
+	size = channels * ((type == ARM_STFT_COMPLEX) ? n : n / 2 + 1);
+
+	while (done < SIGNAL_LEN)
+	{
+		uint32_t block = (uint32_t)(random_bits() % (3 * n + 1));
+		uint32_t count;
+
+		block = (block < SIGNAL_LEN - done) ? block : SIGNAL_LEN - done;
+		count = arm_stft_f32(&S, x + done * channels, block, out);
+		done += block;
+
+		checks++;
+		if (count > block / hop + 1 || frames + count != (done >= n ? (done - n) / hop + 1 : 0))
+		{
+			fprintf(stderr, "arm_stft_f32 %s: n %u, hop %u: %u frames after %u samples\n",
+					names[type], n, hop, frames + count, done);
+			return 0;
+		}
+
+		for (uint32_t f = 0; f < count; f++)
+		{
+			for (uint32_t c = 0; c < channels; c++)
+			{
+				uint32_t len = reference(&R, n, hop, channels, type, frames + f, c);
+				if (!report("arm_stft_f32", relative_error_f32(out + f * size + c * len, ref, len), MAX_ERROR,
+							"%s, n %u, hop %u, %u channels: frame %u channel %u", names[type], n, hop, channels, frames + f, c))
+				{
+					return 0;
+				}
+			}
+		}
+		frames += count;
+	}
+	return 1;
+}
+
+static int check_rejected(uint32_t n, uint32_t hop, uint32_t channels)
+{
+	arm_stft_instance_f32 S;
+
+	checks++;
+	if (arm_stft_init_f32(&S, n, hop, channels, ARM_STFT_POWER, window, state) != ARM_MATH_ARGUMENT_ERROR)
+	{
+		fprintf(stderr, "arm_stft_init_f32: n %u, hop %u, %u channels accepted\n", n, hop, channels);
+		return 0;
+	}
+	return 1;
+}
+
+int main(void)
+{
+	static const uint32_t channel_counts[] = { 1, 3, MAX_CHANNELS };
+	static const uint32_t hops[][2] = { { 256, 64 }, { 256, 100 }, { 256, 256 }, { 256, 1 }, { 1024, 256 }, { 1024, 1000 } };
+	int ok = 1;
+
+#if defined(ARM_FFT_RUNTIME_TABLES)
+	arm_fft_tables_pool_f32(tables_pool, sizeof(tables_pool));
+#endif
+	ok = check_rejected(256, 0, 1) && check_rejected(256, 257, 1) && check_rejected(256, 64, 0)
+		&& check_rejected(100, 50, 1) && check_rejected(16, 8, 1);
+
+	for (uint32_t h = 0; h < sizeof(hops) / sizeof(hops[0]) && ok; h++)
+	{
+		for (uint32_t k = 0; k < sizeof(channel_counts) / sizeof(channel_counts[0]) && ok; k++)
+		{
+			for (uint32_t type = ARM_STFT_COMPLEX; type <= ARM_STFT_POWER && ok; type++)
+			{
+				ok = check_stream(hops[h][0], hops[h][1], channel_counts[k], (arm_stft_output)type);
+			}
+		}
+	}
+
+	printf("%s: %u checks\n", ok ? "ok" : "FAILED", checks);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file traj_sim.c
+ * @brief Steps against shaped reference trajectories on the plant model.
+ *
+ * Usage:
+ *   traj_sim [-t target] [-g gain_scale] [-r rate] [-a accel] [-j jerk]
+ *
+ * Closes the loop with PID_controller and the plant model at the 1 ms control rate and
+ * moves the reference from 0 V to the target three ways: as a step, as a rate limited
+ * ramp and as an S-curve with the given limits. Prints, per run, how long the controller
+ * sat at its 0 / 400 V limits, the peak output, the overshoot and the settling time.
+ * -g scales Kp and Ki to see which gains the shaped references allow.
+ */
+
+#include "controller.h"
+#include "plant_model.h"
+#include "trajectory.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+
+#define RUN_MS			10000
+#define SETTLE_BAND		0.01f	// Of the target
+
+typedef struct {
+	const char *name;
+	TrajLimits_t limits;
+} Run_t;
+
+static double now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void simulate(const Run_t *run, float target, float kp, float ki, float kd)
+{
+	float plant_state[PLANT_STATE_SIZE] = {0};
+	PIDControllerState_t state = {0};
+	float u_meas = 0;
+	float peak_out = 0;
+	float peak_meas = 0;
+	int saturated_ms = 0;
+	int settled_ms = -1;
+	double sample_ns = 0;
+
+	Trajectory_SetLimits(&run->limits);
+	Trajectory_Sample(0);
+	if (Trajectory_Enabled() && Trajectory_Replace(0, target, 0) != XST_SUCCESS)
+	{
+		printf("%-8s move doesn't fit the tables\n", run->name);
+		return;
+	}
+
+	for (int k = 0; k < RUN_MS; k++)
+	{
+		double t0 = now_ns();
+		float u_ref = Trajectory_Sample(target);
+		sample_ns += now_ns() - t0;
+
+		float u_out = PID_controller(u_meas, u_ref, kd, ki, kp, 0, &state);
+		u_meas = PlantModel_Step(plant_state, u_out);
+
+		if (u_out >= 400.0f || u_out <= 0.0f)
+		{
+			saturated_ms++;
+		}
+		peak_out = fmaxf(peak_out, u_out);
+		peak_meas = fmaxf(peak_meas, u_meas);
+
+		if (fabsf(u_meas - target) > SETTLE_BAND * target)
+		{
+			settled_ms = -1;
+		}
+		else if (settled_ms < 0)
+		{
+			settled_ms = k;
+		}
+	}
+
+	printf("%-8s saturated %5d ms | peak out %6.1f V | overshoot %5.1f %% | settled %5d ms | sample %.1f ns\n",
+		   run->name, saturated_ms, peak_out, (peak_meas - target) / target * 100.0f,
+		   settled_ms, sample_ns / RUN_MS);
+}
+
+int main(int argc, char **argv)
+{
+	float target = 300.0f;
+	float gain_scale = 1.0f;
+	float rate = 500.0f;
+	float accel = 5000.0f;
+	float jerk = 100000.0f;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "t:g:r:a:j:")) != -1)
+	{
+		switch (opt)
+		{
+		case 't': target = atof(optarg); break;
+		case 'g': gain_scale = atof(optarg); break;
+		case 'r': rate = atof(optarg); break;
+		case 'a': accel = atof(optarg); break;
+		case 'j': jerk = atof(optarg); break;
+		default:
+			fprintf(stderr, "usage: %s [-t target] [-g gain_scale] [-r rate] [-a accel] [-j jerk]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (!(target > 0) || target > 400 || !(rate > 0))
+	{
+		fprintf(stderr, "target must be within (0, 400] V and rate positive\n");
+		return 2;
+	}
+
+	float kp, ki, kd;
+	getParameters(&kp, &ki, &kd);
+	kp *= gain_scale;
+	ki *= gain_scale;
+	printf("0 -> %.0f V, Kp %.2f Ki %.2f Kd %.3f\n", target, kp, ki, kd);
+
+	const Run_t runs[] = {
+		{ "step",    { 0, 0, 0 } },
+		{ "ramp",    { rate, 0, 0 } },
+		{ "s-curve", { rate, accel, jerk } },
+	};
+	for (size_t i = 0; i < sizeof(runs) / sizeof(runs[0]); i++)
+	{
+		simulate(&runs[i], target, kp, ki, kd);
+	}
+	return 0;
+}
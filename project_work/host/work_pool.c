@@ -0,0 +1,172 @@
+/**
+ * @file work_pool.c
+ * @brief Work-stealing thread pool. See work_pool.h.
+ */
+
+#include "work_pool.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Range of one worker: next task in the low half, end in the high half.
+typedef struct {
+	volatile uint64_t range __attribute__((aligned(64)));
+} Deque_t;
+
+typedef struct {
+	Deque_t *deques;
+	uint32_t threads;
+	WorkPoolTask_t task;
+	void *context;
+	volatile uint64_t steals;
+} Pool_t;
+
+typedef struct {
+	Pool_t *pool;
+	uint32_t worker;
+} Worker_t;
+
+static uint64_t pack(uint32_t next, uint32_t end)
+{
+	return ((uint64_t)end << 32) | next;
+}
+
+/// @brief Owner side: first task of the own range.
+static int take(Deque_t *deque, uint32_t *task)
+{
+	uint64_t range = __atomic_load_n(&deque->range, __ATOMIC_ACQUIRE);
+
+	for (;;)
+	{
+		uint32_t next = (uint32_t)range;
+		uint32_t end = (uint32_t)(range >> 32);
+
+		if (next >= end)
+		{
+			return 0;
+		}
+		if (__atomic_compare_exchange_n(&deque->range, &range, pack(next + 1, end), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			*task = next;
+			return 1;
+		}
+	}
+}
+
+/// @brief Thief side: moves the back half of the fullest other range into the own, empty one.
+static int steal(Pool_t *pool, uint32_t worker)
+{
+	for (;;)
+	{
+		uint32_t victim = worker;
+		uint32_t most = 0;
+		uint64_t range = 0;
+
+		for (uint32_t i = 0; i < pool->threads; i++)
+		{
+			uint64_t r = __atomic_load_n(&pool->deques[i].range, __ATOMIC_ACQUIRE);
+			uint32_t left = (uint32_t)(r >> 32) - (uint32_t)r;
+
+			if (i != worker && (uint32_t)r < (uint32_t)(r >> 32) && left > most)
+			{
+				victim = i;
+				most = left;
+				range = r;
+			}
+		}
+		if (victim == worker)
+		{
+			return 0;
+		}
+
+		uint32_t next = (uint32_t)range;
+		uint32_t end = (uint32_t)(range >> 32);
+		uint32_t split = next + (end - next) / 2;	// A single task is taken whole
+
+		if (split == end)
+		{
+			return 0;
+		}
+		if (__atomic_compare_exchange_n(&pool->deques[victim].range, &range, pack(next, split), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			// Nobody else writes an empty range, the owner publishes its new one.
+			__atomic_store_n(&pool->deques[worker].range, pack(split, end), __ATOMIC_RELEASE);
+			__atomic_fetch_add(&pool->steals, 1, __ATOMIC_RELAXED);
+			return 1;
+		}
+		// The victim or another thief got there first, look again.
+	}
+}
+
+static void *worker_thread(void *arg)
+{
+	Worker_t *self = arg;
+	Pool_t *pool = self->pool;
+	Deque_t *own = &pool->deques[self->worker];
+	uint32_t task;
+
+	do
+	{
+		while (take(own, &task))
+		{
+			pool->task(task, self->worker, pool->context);
+		}
+	} while (steal(pool, self->worker));
+	return NULL;
+}
+
+int WorkPool_Run(uint32_t count, uint32_t threads, WorkPoolTask_t task, void *context, WorkPoolStats_t *stats)
+{
+	if (threads == 0)
+	{
+		long online = sysconf(_SC_NPROCESSORS_ONLN);
+		threads = (online > 0) ? (uint32_t)online : 1;
+	}
+
+	Pool_t pool = { NULL, threads, task, context, 0 };
+	pool.deques = aligned_alloc(64, threads * sizeof(Deque_t));
+	pthread_t *ids = malloc(threads * sizeof(pthread_t));
+	Worker_t *workers = malloc(threads * sizeof(Worker_t));
+	int status = 0;
+
+	if (pool.deques == NULL || ids == NULL || workers == NULL)
+	{
+		status = -1;
+		goto out;
+	}
+
+	for (uint32_t i = 0; i < threads; i++)
+	{
+		pool.deques[i].range = pack((uint32_t)((uint64_t)count * i / threads),
+									(uint32_t)((uint64_t)count * (i + 1) / threads));
+		workers[i].pool = &pool;
+		workers[i].worker = i;
+	}
+
+	// Worker 0 is the calling thread.
+	uint32_t started = 1;
+	for (; started < threads; started++)
+	{
+		if (pthread_create(&ids[started], NULL, worker_thread, &workers[started]) != 0)
+		{
+			// The range of a worker that didn't start is stolen by the others.
+			break;
+		}
+	}
+	worker_thread(&workers[0]);
+	for (uint32_t i = 1; i < started; i++)
+	{
+		pthread_join(ids[i], NULL);
+	}
+
+	if (stats != NULL)
+	{
+		stats->threads = started;
+		stats->steals = pool.steals;
+	}
+out:
+	free(pool.deques);
+	free(ids);
+	free(workers);
+	return status;
+}
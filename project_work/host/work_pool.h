@@ -0,0 +1,31 @@
+/**
+ * @file work_pool.h
+ * @brief Work-stealing thread pool for host tools with many independent tasks.
+ *
+ * Tasks are numbered 0..count-1 and split into one contiguous range per worker.
+ * A worker takes tasks from the front of its own range; when that is empty it steals
+ * the back half of the fullest other range. Each range is one 64-bit word updated
+ * with compare-and-swap, so there are no locks and tasks that run long on one worker
+ * (e.g. slowly diverging scenarios) are picked up by the others.
+ */
+
+#ifndef WORK_POOL_H
+#define WORK_POOL_H
+
+#include <stdint.h>
+
+/// @brief Called once per task, from any worker.
+/// @param worker 0..threads-1, e.g. to index per-worker scratch space.
+typedef void (*WorkPoolTask_t)(uint32_t task, uint32_t worker, void *context);
+
+typedef struct {
+	uint32_t threads;
+	uint64_t steals;		// Successful steals over the run
+} WorkPoolStats_t;
+
+/// @brief Runs all tasks and returns when they are done.
+/// @param threads Worker count, 0 for one per online CPU.
+/// @return 0, or -1 if out of memory. Fewer threads than asked for still run all tasks.
+int WorkPool_Run(uint32_t count, uint32_t threads, WorkPoolTask_t task, void *context, WorkPoolStats_t *stats);
+
+#endif
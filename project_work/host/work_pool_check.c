@@ -0,0 +1,107 @@
+/**
+ * @file work_pool_check.c
+ * @brief Checks that work_pool.c runs every task exactly once with few steals.
+ *
+ * Usage:
+ *   work_pool_check
+ *
+ * Task counts that the thread count doesn't divide, a long task left at the end of
+ * one range, and workers whose pthread_create fails (linked with
+ * -Wl,--wrap=pthread_create): every task must run once, the run must end, and there
+ * must be at most one steal per task. A hang is reported by alarm() after 10 s.
+ * Exits 1 on the first failure.
+ */
+
+#include "work_pool.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAX_TASKS		4096
+#define LONG_TASK_MS	100
+
+typedef struct {
+	uint32_t long_task;		// Sleeps LONG_TASK_MS, MAX_TASKS for none
+} Scenario_t;
+
+static uint32_t runs[MAX_TASKS];
+static uint32_t creates_left;	// pthread_create calls that succeed, then EAGAIN
+
+int __real_pthread_create(pthread_t *thread, const pthread_attr_t *attr, void *(*start)(void *), void *arg);
+
+/// @brief pthread_create, failing once creates_left calls have succeeded.
+int __wrap_pthread_create(pthread_t *thread, const pthread_attr_t *attr, void *(*start)(void *), void *arg)
+{
+	if (creates_left == 0)
+	{
+		return EAGAIN;
+	}
+	creates_left--;
+	return __real_pthread_create(thread, attr, start, arg);
+}
+
+static void run_task(uint32_t task, uint32_t worker, void *context)
+{
+	const Scenario_t *scenario = context;
+	(void)worker;
+
+	__atomic_fetch_add(&runs[task], 1, __ATOMIC_RELAXED);
+	if (task == scenario->long_task)
+	{
+		struct timespec ts = { 0, LONG_TASK_MS * 1000000L };
+		nanosleep(&ts, NULL);
+	}
+}
+
+/// @brief One pool run of count tasks on threads workers, of which only started start.
+static int check(const char *what, uint32_t count, uint32_t threads, uint32_t started, uint32_t long_task)
+{
+	Scenario_t scenario = { long_task };
+	WorkPoolStats_t stats;
+
+	memset(runs, 0, sizeof(runs));
+	creates_left = started - 1;
+	if (WorkPool_Run(count, threads, run_task, &scenario, &stats) != 0)
+	{
+		fprintf(stderr, "%s: out of memory\n", what);
+		return 0;
+	}
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (runs[i] != 1)
+		{
+			fprintf(stderr, "%s: %u tasks on %u threads: task %u ran %u times\n", what, count, threads, i, runs[i]);
+			return 0;
+		}
+	}
+	if (stats.threads != started || stats.steals > count)
+	{
+		fprintf(stderr, "%s: %u tasks on %u threads: %u started, %llu steals\n",
+				what, count, threads, stats.threads, (unsigned long long)stats.steals);
+		return 0;
+	}
+	printf("%s: %u tasks on %u threads, %u started: %llu steals\n",
+		   what, count, threads, stats.threads, (unsigned long long)stats.steals);
+	return 1;
+}
+
+int main(void)
+{
+	int ok;
+
+	alarm(10);
+	ok = check("uneven split", 1003, 4, 4, MAX_TASKS)
+		&& check("long last task", 8, 4, 4, 1)
+		&& check("long first task", 8, 4, 4, 0)
+		&& check("one worker not started", 1003, 4, 3, MAX_TASKS)
+		&& check("last task of a worker not started", 7, 4, 3, MAX_TASKS)
+		&& check("only the caller", 1001, 8, 1, 500)
+		&& check("more threads than tasks", 3, 8, 8, 0);
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file bench_basic.c
+ * @brief BasicMathFunctions kernels for dsp_bench.
+ */
+
+#include "dsp_bench.h"
+
+#define GROUP "BasicMath"
+#define SIZES dsp_bench_basic_sizes
+
+DSP_BENCH(arm_abs_f32, GROUP, "f32", SIZES) { arm_abs_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_abs_q31, GROUP, "q31", SIZES) { arm_abs_q31(d->q31[0], d->q31[2], n); }
+DSP_BENCH(arm_abs_q15, GROUP, "q15", SIZES) { arm_abs_q15(d->q15[0], d->q15[2], n); }
+
+DSP_BENCH(arm_add_f32, GROUP, "f32", SIZES) { arm_add_f32(d->f32[0], d->f32[1], d->f32[2], n); }
+DSP_BENCH(arm_add_q31, GROUP, "q31", SIZES) { arm_add_q31(d->q31[0], d->q31[1], d->q31[2], n); }
+DSP_BENCH(arm_add_q15, GROUP, "q15", SIZES) { arm_add_q15(d->q15[0], d->q15[1], d->q15[2], n); }
+
+DSP_BENCH(arm_clip_f32, GROUP, "f32", SIZES) { arm_clip_f32(d->f32[0], d->f32[2], -0.25f, 0.25f, n); }
+DSP_BENCH(arm_clip_q31, GROUP, "q31", SIZES) { arm_clip_q31(d->q31[0], d->q31[2], -0x20000000, 0x20000000, n); }
+DSP_BENCH(arm_clip_q15, GROUP, "q15", SIZES) { arm_clip_q15(d->q15[0], d->q15[2], -0x2000, 0x2000, n); }
+
+DSP_BENCH(arm_dot_prod_f32, GROUP, "f32", SIZES)
+{
+	float32_t result;
+	arm_dot_prod_f32(d->f32[0], d->f32[1], n, &result);
+	d->sink = result;
+}
+DSP_BENCH(arm_dot_prod_q31, GROUP, "q31", SIZES)
+{
+	q63_t result;
+	arm_dot_prod_q31(d->q31[0], d->q31[1], n, &result);
+	d->sink = (float)result;
+}
+DSP_BENCH(arm_dot_prod_q15, GROUP, "q15", SIZES)
+{
+	q63_t result;
+	arm_dot_prod_q15(d->q15[0], d->q15[1], n, &result);
+	d->sink = (float)result;
+}
+
+DSP_BENCH(arm_mult_f32, GROUP, "f32", SIZES) { arm_mult_f32(d->f32[0], d->f32[1], d->f32[2], n); }
+DSP_BENCH(arm_mult_q31, GROUP, "q31", SIZES) { arm_mult_q31(d->q31[0], d->q31[1], d->q31[2], n); }
+DSP_BENCH(arm_mult_q15, GROUP, "q15", SIZES) { arm_mult_q15(d->q15[0], d->q15[1], d->q15[2], n); }
+
+DSP_BENCH(arm_negate_f32, GROUP, "f32", SIZES) { arm_negate_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_negate_q31, GROUP, "q31", SIZES) { arm_negate_q31(d->q31[0], d->q31[2], n); }
+DSP_BENCH(arm_negate_q15, GROUP, "q15", SIZES) { arm_negate_q15(d->q15[0], d->q15[2], n); }
+
+DSP_BENCH(arm_offset_f32, GROUP, "f32", SIZES) { arm_offset_f32(d->f32[0], 0.125f, d->f32[2], n); }
+DSP_BENCH(arm_offset_q31, GROUP, "q31", SIZES) { arm_offset_q31(d->q31[0], 0x10000000, d->q31[2], n); }
+DSP_BENCH(arm_offset_q15, GROUP, "q15", SIZES) { arm_offset_q15(d->q15[0], 0x1000, d->q15[2], n); }
+
+DSP_BENCH(arm_scale_f32, GROUP, "f32", SIZES) { arm_scale_f32(d->f32[0], 0.75f, d->f32[2], n); }
+DSP_BENCH(arm_scale_q31, GROUP, "q31", SIZES) { arm_scale_q31(d->q31[0], 0x60000000, 0, d->q31[2], n); }
+DSP_BENCH(arm_scale_q15, GROUP, "q15", SIZES) { arm_scale_q15(d->q15[0], 0x6000, 0, d->q15[2], n); }
+
+DSP_BENCH(arm_shift_q31, GROUP, "q31", SIZES) { arm_shift_q31(d->q31[0], -3, d->q31[2], n); }
+DSP_BENCH(arm_shift_q15, GROUP, "q15", SIZES) { arm_shift_q15(d->q15[0], -3, d->q15[2], n); }
+
+DSP_BENCH(arm_sub_f32, GROUP, "f32", SIZES) { arm_sub_f32(d->f32[0], d->f32[1], d->f32[2], n); }
+DSP_BENCH(arm_sub_q31, GROUP, "q31", SIZES) { arm_sub_q31(d->q31[0], d->q31[1], d->q31[2], n); }
+DSP_BENCH(arm_sub_q15, GROUP, "q15", SIZES) { arm_sub_q15(d->q15[0], d->q15[1], d->q15[2], n); }
@@ -0,0 +1,48 @@
+/**
+ * @file bench_complex.c
+ * @brief ComplexMathFunctions kernels for dsp_bench. n is the number of complex samples.
+ */
+
+#include "dsp_bench.h"
+
+#define GROUP "ComplexMath"
+#define SIZES dsp_bench_vector_sizes
+
+DSP_BENCH(arm_cmplx_conj_f32, GROUP, "f32", SIZES) { arm_cmplx_conj_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_cmplx_conj_q31, GROUP, "q31", SIZES) { arm_cmplx_conj_q31(d->q31[0], d->q31[2], n); }
+DSP_BENCH(arm_cmplx_conj_q15, GROUP, "q15", SIZES) { arm_cmplx_conj_q15(d->q15[0], d->q15[2], n); }
+
+DSP_BENCH(arm_cmplx_dot_prod_f32, GROUP, "f32", SIZES)
+{
+	float32_t re, im;
+	arm_cmplx_dot_prod_f32(d->f32[0], d->f32[1], n, &re, &im);
+	d->sink = re + im;
+}
+DSP_BENCH(arm_cmplx_dot_prod_q31, GROUP, "q31", SIZES)
+{
+	q63_t re, im;
+	arm_cmplx_dot_prod_q31(d->q31[0], d->q31[1], n, &re, &im);
+	d->sink = (float)(re + im);
+}
+DSP_BENCH(arm_cmplx_dot_prod_q15, GROUP, "q15", SIZES)
+{
+	q31_t re, im;
+	arm_cmplx_dot_prod_q15(d->q15[0], d->q15[1], n, &re, &im);
+	d->sink = (float)(re + im);
+}
+
+DSP_BENCH(arm_cmplx_mag_f32, GROUP, "f32", SIZES) { arm_cmplx_mag_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_cmplx_mag_q31, GROUP, "q31", SIZES) { arm_cmplx_mag_q31(d->q31[0], d->q31[2], n); }
+DSP_BENCH(arm_cmplx_mag_q15, GROUP, "q15", SIZES) { arm_cmplx_mag_q15(d->q15[0], d->q15[2], n); }
+
+DSP_BENCH(arm_cmplx_mag_squared_f32, GROUP, "f32", SIZES) { arm_cmplx_mag_squared_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_cmplx_mag_squared_q31, GROUP, "q31", SIZES) { arm_cmplx_mag_squared_q31(d->q31[0], d->q31[2], n); }
+DSP_BENCH(arm_cmplx_mag_squared_q15, GROUP, "q15", SIZES) { arm_cmplx_mag_squared_q15(d->q15[0], d->q15[2], n); }
+
+DSP_BENCH(arm_cmplx_mult_cmplx_f32, GROUP, "f32", SIZES) { arm_cmplx_mult_cmplx_f32(d->f32[0], d->f32[1], d->f32[2], n); }
+DSP_BENCH(arm_cmplx_mult_cmplx_q31, GROUP, "q31", SIZES) { arm_cmplx_mult_cmplx_q31(d->q31[0], d->q31[1], d->q31[2], n); }
+DSP_BENCH(arm_cmplx_mult_cmplx_q15, GROUP, "q15", SIZES) { arm_cmplx_mult_cmplx_q15(d->q15[0], d->q15[1], d->q15[2], n); }
+
+DSP_BENCH(arm_cmplx_mult_real_f32, GROUP, "f32", SIZES) { arm_cmplx_mult_real_f32(d->f32[0], d->f32[1], d->f32[2], n); }
+DSP_BENCH(arm_cmplx_mult_real_q31, GROUP, "q31", SIZES) { arm_cmplx_mult_real_q31(d->q31[0], d->q31[1], d->q31[2], n); }
+DSP_BENCH(arm_cmplx_mult_real_q15, GROUP, "q15", SIZES) { arm_cmplx_mult_real_q15(d->q15[0], d->q15[1], d->q15[2], n); }
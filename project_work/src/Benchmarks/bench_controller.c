@@ -0,0 +1,176 @@
+/**
+ * @file bench_controller.c
+ * @brief ControllerFunctions and InterpolationFunctions kernels for dsp_bench.
+ *
+ * The PID, sin/cos and interpolation kernels handle one sample per call, so a run is
+ * n calls over the input buffer, as in a control loop.
+ */
+
+#include "dsp_bench.h"
+
+#define GROUP_CONTROLLER	"Controller"
+#define GROUP_INTERPOLATION	"Interpolation"
+#define SIZES				dsp_bench_scalar_sizes
+
+#define TABLE_LEN	64		// Interpolation table entries and spline knots
+
+static arm_pid_instance_f32 pid_f32;
+static arm_pid_instance_q31 pid_q31;
+static arm_pid_instance_q15 pid_q15;
+static arm_linear_interp_instance_f32 linear_f32;
+static arm_bilinear_interp_instance_f32 bilinear_f32;
+static arm_spline_instance_f32 spline_f32;
+static float32_t spline_x[TABLE_LEN];
+static float32_t spline_coeffs[3 * (TABLE_LEN - 1)];
+
+static int setup_pid_f32(DspBenchData_t *d, uint32_t n)
+{
+	pid_f32.Kp = 0.5f;
+	pid_f32.Ki = 0.01f;
+	pid_f32.Kd = 0.1f;
+	arm_pid_init_f32(&pid_f32, 1);
+	return 1;
+}
+DSP_BENCH_FULL(arm_pid_f32, GROUP_CONTROLLER, "f32", SIZES, setup_pid_f32, NULL)
+{
+	float32_t out = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		out = arm_pid_f32(&pid_f32, d->f32[0][i]);
+	}
+	d->sink = out;
+}
+
+static int setup_pid_q31(DspBenchData_t *d, uint32_t n)
+{
+	pid_q31.Kp = 0x40000000;
+	pid_q31.Ki = 0x01000000;
+	pid_q31.Kd = 0x0CCCCCCC;
+	arm_pid_init_q31(&pid_q31, 1);
+	return 1;
+}
+DSP_BENCH_FULL(arm_pid_q31, GROUP_CONTROLLER, "q31", SIZES, setup_pid_q31, NULL)
+{
+	q31_t out = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		out = arm_pid_q31(&pid_q31, d->q31[0][i]);
+	}
+	d->sink = (float)out;
+}
+
+static int setup_pid_q15(DspBenchData_t *d, uint32_t n)
+{
+	pid_q15.Kp = 0x4000;
+	pid_q15.Ki = 0x0100;
+	pid_q15.Kd = 0x0CCC;
+	arm_pid_init_q15(&pid_q15, 1);
+	return 1;
+}
+DSP_BENCH_FULL(arm_pid_q15, GROUP_CONTROLLER, "q15", SIZES, setup_pid_q15, NULL)
+{
+	q15_t out = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		out = arm_pid_q15(&pid_q15, d->q15[0][i]);
+	}
+	d->sink = (float)out;
+}
+
+DSP_BENCH(arm_sin_cos_f32, GROUP_CONTROLLER, "f32", SIZES)
+{
+	float32_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		float32_t s, c;
+		arm_sin_cos_f32(d->f32[0][i] * 360.0f, &s, &c);	// Degrees
+		sum += s + c;
+	}
+	d->sink = sum;
+}
+DSP_BENCH(arm_sin_cos_q31, GROUP_CONTROLLER, "q31", SIZES)
+{
+	q31_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		q31_t s, c;
+		arm_sin_cos_q31(d->q31[0][i], &s, &c);
+		sum += (s >> 10) + (c >> 10);
+	}
+	d->sink = (float)sum;
+}
+
+static int setup_interpolation(DspBenchData_t *d, uint32_t n)
+{
+	linear_f32.nValues = TABLE_LEN;
+	linear_f32.x1 = 0.0f;
+	linear_f32.xSpacing = 1.0f;
+	linear_f32.pYData = d->f32[3];
+
+	// 8 x 8 table
+	bilinear_f32.numRows = 8;
+	bilinear_f32.numCols = 8;
+	bilinear_f32.pData = d->f32[3];
+
+	for (uint32_t k = 0; k < TABLE_LEN; k++)
+	{
+		spline_x[k] = (float32_t)k;
+	}
+	arm_spline_init_f32(&spline_f32, ARM_SPLINE_NATURAL, spline_x, d->f32[3], TABLE_LEN, spline_coeffs, d->scratch);
+	return 1;
+}
+
+// Query points inside the tables: the random data mapped from [-0.5, 0.5) to [0, TABLE_LEN - 1)
+#define QUERY(d, i, len)	(((d)->f32[0][i] + 0.5f) * ((len) - 1))
+
+DSP_BENCH_FULL(arm_linear_interp_f32, GROUP_INTERPOLATION, "f32", SIZES, setup_interpolation, NULL)
+{
+	float32_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		sum += arm_linear_interp_f32(&linear_f32, QUERY(d, i, TABLE_LEN));
+	}
+	d->sink = sum;
+}
+DSP_BENCH(arm_linear_interp_q31, GROUP_INTERPOLATION, "q31", SIZES)
+{
+	q31_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		// 12.20 format index into the table
+		sum += arm_linear_interp_q31(d->q31[3], (d->q31[0][i] & 0x7FFFFFFF) >> 6, TABLE_LEN) >> 10;
+	}
+	d->sink = (float)sum;
+}
+DSP_BENCH(arm_linear_interp_q15, GROUP_INTERPOLATION, "q15", SIZES)
+{
+	q31_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		sum += arm_linear_interp_q15(d->q15[3], (d->q31[0][i] & 0x7FFFFFFF) >> 6, TABLE_LEN);
+	}
+	d->sink = (float)sum;
+}
+DSP_BENCH_FULL(arm_bilinear_interp_f32, GROUP_INTERPOLATION, "f32", SIZES, setup_interpolation, NULL)
+{
+	float32_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		sum += arm_bilinear_interp_f32(&bilinear_f32, QUERY(d, i, 8), QUERY(d, i + 1, 8));
+	}
+	d->sink = sum;
+}
+
+// The spline takes a block of query points, sorted
+static int setup_spline(DspBenchData_t *d, uint32_t n)
+{
+	float32_t *xq = d->f32[2];
+
+	setup_interpolation(d, n);
+	for (uint32_t i = 0; i < n; i++)
+	{
+		xq[i] = (float32_t)i * (TABLE_LEN - 1) / n;
+	}
+	return 1;
+}
+DSP_BENCH_FULL(arm_spline_f32, GROUP_INTERPOLATION, "f32", dsp_bench_vector_sizes, setup_spline, NULL) { arm_spline_f32(&spline_f32, d->f32[2], (float32_t *)d->scratch + 2 * TABLE_LEN, n); }
@@ -0,0 +1,74 @@
+/**
+ * @file bench_distance.c
+ * @brief DistanceFunctions and WindowFunctions kernels for dsp_bench.
+ */
+
+#include "dsp_bench.h"
+#include <string.h>
+
+#define GROUP_DISTANCE	"Distance"
+#define GROUP_WINDOW	"Window"
+#define SIZES			dsp_bench_vector_sizes
+
+#define BENCH_DISTANCE(kernel, a, b)											\
+	DSP_BENCH(kernel, GROUP_DISTANCE, "f32", SIZES) { d->sink = kernel(a, b, n); }
+
+BENCH_DISTANCE(arm_braycurtis_distance_f32, d->f32_positive, d->f32_positive + DSP_BENCH_MAX_N)
+BENCH_DISTANCE(arm_canberra_distance_f32, d->f32[0], d->f32[1])
+BENCH_DISTANCE(arm_chebyshev_distance_f32, d->f32[0], d->f32[1])
+BENCH_DISTANCE(arm_cityblock_distance_f32, d->f32[0], d->f32[1])
+BENCH_DISTANCE(arm_cosine_distance_f32, d->f32[0], d->f32[1])
+BENCH_DISTANCE(arm_euclidean_distance_f32, d->f32[0], d->f32[1])
+BENCH_DISTANCE(arm_jensenshannon_distance_f32, d->f32_positive, d->f32_positive + DSP_BENCH_MAX_N)
+
+// Centres its inputs in place, so it runs on copies
+static int setup_correlation(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(d->scratch, d->f32[0], n * sizeof(float32_t));
+	memcpy((float32_t *)d->scratch + n, d->f32[1], n * sizeof(float32_t));
+	return 1;
+}
+DSP_BENCH_FULL(arm_correlation_distance_f32, GROUP_DISTANCE, "f32", SIZES, setup_correlation, NULL)
+{
+	d->sink = arm_correlation_distance_f32(d->scratch, (float32_t *)d->scratch + n, n);
+}
+
+DSP_BENCH(arm_minkowski_distance_f32, GROUP_DISTANCE, "f32", SIZES) { d->sink = arm_minkowski_distance_f32(d->f32[0], d->f32[1], 3, n); }
+
+// n is the number of booleans, packed 32 per word
+#define BENCH_BOOLEAN(kernel)	\
+	DSP_BENCH(kernel, GROUP_DISTANCE, "u32", SIZES) { d->sink = kernel((const uint32_t *)d->q31[0], (const uint32_t *)d->q31[1], n); }
+
+BENCH_BOOLEAN(arm_dice_distance)
+BENCH_BOOLEAN(arm_hamming_distance)
+BENCH_BOOLEAN(arm_jaccard_distance)
+BENCH_BOOLEAN(arm_kulsinski_distance)
+BENCH_BOOLEAN(arm_rogerstanimoto_distance)
+BENCH_BOOLEAN(arm_russellrao_distance)
+BENCH_BOOLEAN(arm_sokalmichener_distance)
+BENCH_BOOLEAN(arm_sokalsneath_distance)
+BENCH_BOOLEAN(arm_yule_distance)
+
+#define BENCH_WINDOW(kernel)	\
+	DSP_BENCH(kernel, GROUP_WINDOW, "f32", SIZES) { kernel(d->f32[2], n); }
+
+BENCH_WINDOW(arm_bartlett_f32)
+BENCH_WINDOW(arm_blackman_harris_92db_f32)
+BENCH_WINDOW(arm_hamming_f32)
+BENCH_WINDOW(arm_hanning_f32)
+BENCH_WINDOW(arm_hft116d_f32)
+BENCH_WINDOW(arm_hft144d_f32)
+BENCH_WINDOW(arm_hft169d_f32)
+BENCH_WINDOW(arm_hft196d_f32)
+BENCH_WINDOW(arm_hft223d_f32)
+BENCH_WINDOW(arm_hft248d_f32)
+BENCH_WINDOW(arm_hft90d_f32)
+BENCH_WINDOW(arm_hft95_f32)
+BENCH_WINDOW(arm_nuttall3_f32)
+BENCH_WINDOW(arm_nuttall3a_f32)
+BENCH_WINDOW(arm_nuttall3b_f32)
+BENCH_WINDOW(arm_nuttall4_f32)
+BENCH_WINDOW(arm_nuttall4a_f32)
+BENCH_WINDOW(arm_nuttall4b_f32)
+BENCH_WINDOW(arm_nuttall4c_f32)
+BENCH_WINDOW(arm_welch_f32)
@@ -0,0 +1,112 @@
+/**
+ * @file bench_fastmath.c
+ * @brief FastMathFunctions kernels for dsp_bench. The one-sample kernels run n times per run.
+ */
+
+#include "dsp_bench.h"
+
+#define GROUP "FastMath"
+
+DSP_BENCH(arm_sin_f32, GROUP, "f32", dsp_bench_scalar_sizes)
+{
+	float32_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		sum += arm_sin_f32(d->f32[0][i] * 12.0f);
+	}
+	d->sink = sum;
+}
+DSP_BENCH(arm_sin_q31, GROUP, "q31", dsp_bench_scalar_sizes)
+{
+	q31_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		sum += arm_sin_q31(d->q31[0][i] & 0x7FFFFFFF) >> 10;
+	}
+	d->sink = (float)sum;
+}
+DSP_BENCH(arm_sin_q15, GROUP, "q15", dsp_bench_scalar_sizes)
+{
+	q31_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		sum += arm_sin_q15(d->q15[0][i] & 0x7FFF);
+	}
+	d->sink = (float)sum;
+}
+DSP_BENCH(arm_cos_f32, GROUP, "f32", dsp_bench_scalar_sizes)
+{
+	float32_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		sum += arm_cos_f32(d->f32[0][i] * 12.0f);
+	}
+	d->sink = sum;
+}
+DSP_BENCH(arm_cos_q31, GROUP, "q31", dsp_bench_scalar_sizes)
+{
+	q31_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		sum += arm_cos_q31(d->q31[0][i] & 0x7FFFFFFF) >> 10;
+	}
+	d->sink = (float)sum;
+}
+DSP_BENCH(arm_cos_q15, GROUP, "q15", dsp_bench_scalar_sizes)
+{
+	q31_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		sum += arm_cos_q15(d->q15[0][i] & 0x7FFF);
+	}
+	d->sink = (float)sum;
+}
+DSP_BENCH(arm_sqrt_f32, GROUP, "f32", dsp_bench_scalar_sizes)
+{
+	float32_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		float32_t out;
+		arm_sqrt_f32(d->f32_positive[i], &out);
+		sum += out;
+	}
+	d->sink = sum;
+}
+DSP_BENCH(arm_sqrt_q31, GROUP, "q31", dsp_bench_scalar_sizes)
+{
+	q31_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		q31_t out;
+		arm_sqrt_q31(d->q31[0][i] & 0x7FFFFFFF, &out);
+		sum += out >> 10;
+	}
+	d->sink = (float)sum;
+}
+DSP_BENCH(arm_sqrt_q15, GROUP, "q15", dsp_bench_scalar_sizes)
+{
+	q31_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		q15_t out;
+		arm_sqrt_q15(d->q15[0][i] & 0x7FFF, &out);
+		sum += out;
+	}
+	d->sink = (float)sum;
+}
+DSP_BENCH(arm_atan2_f32, GROUP, "f32", dsp_bench_scalar_sizes)
+{
+	float32_t sum = 0;
+	for (uint32_t i = 0; i < n; i++)
+	{
+		float32_t out;
+		arm_atan2_f32(d->f32[0][i], d->f32[1][i], &out);
+		sum += out;
+	}
+	d->sink = sum;
+}
+
+DSP_BENCH(arm_vexp_f32, GROUP, "f32", dsp_bench_vector_sizes) { arm_vexp_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_vlog_f32, GROUP, "f32", dsp_bench_vector_sizes) { arm_vlog_f32(d->f32_positive, d->f32[2], n); }
+DSP_BENCH(arm_vlog_q31, GROUP, "q31", dsp_bench_vector_sizes) { arm_vlog_q31(d->q31[0], d->q31[2], n); }
+DSP_BENCH(arm_vlog_q15, GROUP, "q15", dsp_bench_vector_sizes) { arm_vlog_q15(d->q15[0], d->q15[2], n); }
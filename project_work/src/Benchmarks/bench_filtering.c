@@ -0,0 +1,440 @@
+/**
+ * @file bench_filtering.c
+ * @brief FilteringFunctions kernels for dsp_bench. n is the block size, the template length
+ *        of the long correlations and the number of taps of the long FIRs.
+ *
+ * Filter state lives in the scratch buffer and is set up once per size, so the
+ * timed calls run on a warm filter like the control and measurement code does.
+ */
+
+#include "dsp_bench.h"
+#include <string.h>
+#include <time.h>
+
+#define GROUP "Filtering"
+#define SIZES dsp_bench_block_sizes
+
+#define FIR_TAPS		32
+#define BIQUAD_STAGES	4
+#define LATTICE_STAGES	8
+#define RATE_FACTOR		4		// Decimation and interpolation factor
+#define CONV_LEN		32		// Length of the second sequence of conv and correlate
+#define CAPTURE_LEN		4096	// Length of the first sequence of the long correlations
+#define LONG_FIR_BLOCK	1024	// Samples per call of the long FIRs
+#define RESAMPLE_L		147		// 48 kHz to 44.1 kHz
+#define RESAMPLE_M		160
+#define RESAMPLE_TAPS	(RESAMPLE_L * 16)
+#define LMS_MU			0.01f
+
+#define Q31(x)	((q31_t)((x) * 2147483648.0))
+#define Q15(x)	((q15_t)((x) * 32768.0))
+
+static const uint32_t levinson_sizes[] = { 8, 16, 32, 0 };
+static const uint32_t resample_sizes[] = { 160, 1600, 4800, 0 };	// Multiples of RESAMPLE_M, for the chain
+
+// Stable section: b = 0.2 0.4 0.2, poles at |z| = 0.45
+static float32_t biquad_f32[5 * BIQUAD_STAGES];
+// Fixed point sections use postShift 1, so the coefficients are halved
+static q31_t biquad_q31[5 * BIQUAD_STAGES];
+static q15_t biquad_q15[6 * BIQUAD_STAGES];
+static float32_t lattice_k[LATTICE_STAGES];
+static float32_t lattice_v[LATTICE_STAGES + 1];
+static int32_t sparse_delays[FIR_TAPS];
+
+static arm_fir_instance_f32 fir_f32;
+static arm_fir_instance_q31 fir_q31;
+static arm_fir_instance_q15 fir_q15;
+static arm_fir_decimate_instance_f32 decimate_f32;
+static arm_fir_decimate_instance_q31 decimate_q31;
+static arm_fir_decimate_instance_q15 decimate_q15;
+static arm_fir_interpolate_instance_f32 interpolate_f32;
+static arm_fir_lattice_instance_f32 fir_lattice_f32;
+static arm_fir_sparse_instance_f32 sparse_f32;
+static arm_iir_lattice_instance_f32 iir_lattice_f32;
+static arm_biquad_casd_df1_inst_f32 df1_f32;
+static arm_biquad_casd_df1_inst_q31 df1_q31;
+static arm_biquad_casd_df1_inst_q15 df1_q15;
+static arm_biquad_cascade_df2T_instance_f32 df2T_f32;
+static arm_biquad_cascade_stereo_df2T_instance_f32 stereo_df2T_f32;
+static arm_lms_instance_f32 lms_f32;
+static arm_lms_instance_q31 lms_q31;
+static arm_lms_instance_q15 lms_q15;
+static arm_lms_norm_instance_f32 lms_norm_f32;
+
+__attribute__((constructor)) static void init_coefficients(void)
+{
+	const double b[3] = { 0.2, 0.4, 0.2 };
+	const double a[2] = { 0.5, -0.2 };
+
+	for (int s = 0; s < BIQUAD_STAGES; s++)
+	{
+		float32_t *f = &biquad_f32[5 * s];
+		q31_t *q = &biquad_q31[5 * s];
+		q15_t *h = &biquad_q15[6 * s];
+
+		f[0] = b[0]; f[1] = b[1]; f[2] = b[2]; f[3] = a[0]; f[4] = a[1];
+		q[0] = Q31(b[0] / 2); q[1] = Q31(b[1] / 2); q[2] = Q31(b[2] / 2); q[3] = Q31(a[0] / 2); q[4] = Q31(a[1] / 2);
+		h[0] = Q15(b[0] / 2); h[1] = 0; h[2] = Q15(b[1] / 2); h[3] = Q15(b[2] / 2); h[4] = Q15(a[0] / 2); h[5] = Q15(a[1] / 2);
+	}
+	for (int s = 0; s < LATTICE_STAGES; s++)
+	{
+		lattice_k[s] = 0.3f;
+		lattice_v[s] = 0.1f;
+	}
+	lattice_v[LATTICE_STAGES] = 0.1f;
+	for (int t = 0; t < FIR_TAPS; t++)
+	{
+		sparse_delays[t] = t * RATE_FACTOR;
+	}
+}
+
+static int setup_fir_f32(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, (FIR_TAPS + n) * sizeof(float32_t));
+	arm_fir_init_f32(&fir_f32, FIR_TAPS, d->f32[3], d->scratch, n);
+	return 1;
+}
+DSP_BENCH_FULL(arm_fir_f32, GROUP, "f32", SIZES, setup_fir_f32, NULL) { arm_fir_f32(&fir_f32, d->f32[0], d->f32[2], n); }
+
+static int setup_fir_q31(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, (FIR_TAPS + n) * sizeof(q31_t));
+	arm_fir_init_q31(&fir_q31, FIR_TAPS, d->q31[3], d->scratch, n);
+	return 1;
+}
+DSP_BENCH_FULL(arm_fir_q31, GROUP, "q31", SIZES, setup_fir_q31, NULL) { arm_fir_q31(&fir_q31, d->q31[0], d->q31[2], n); }
+DSP_BENCH_FULL(arm_fir_fast_q31, GROUP, "q31", SIZES, setup_fir_q31, NULL) { arm_fir_fast_q31(&fir_q31, d->q31[0], d->q31[2], n); }
+
+static int setup_fir_q15(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, (FIR_TAPS + n) * sizeof(q15_t));
+	return arm_fir_init_q15(&fir_q15, FIR_TAPS, d->q15[3], d->scratch, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_fir_q15, GROUP, "q15", SIZES, setup_fir_q15, NULL) { arm_fir_q15(&fir_q15, d->q15[0], d->q15[2], n); }
+DSP_BENCH_FULL(arm_fir_fast_q15, GROUP, "q15", SIZES, setup_fir_q15, NULL) { arm_fir_fast_q15(&fir_q15, d->q15[0], d->q15[2], n); }
+
+static int setup_decimate_f32(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, (FIR_TAPS + n) * sizeof(float32_t));
+	return arm_fir_decimate_init_f32(&decimate_f32, FIR_TAPS, RATE_FACTOR, d->f32[3], d->scratch, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_fir_decimate_f32, GROUP, "f32", SIZES, setup_decimate_f32, NULL) { arm_fir_decimate_f32(&decimate_f32, d->f32[0], d->f32[2], n); }
+
+static int setup_decimate_q31(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, (FIR_TAPS + n) * sizeof(q31_t));
+	return arm_fir_decimate_init_q31(&decimate_q31, FIR_TAPS, RATE_FACTOR, d->q31[3], d->scratch, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_fir_decimate_q31, GROUP, "q31", SIZES, setup_decimate_q31, NULL) { arm_fir_decimate_q31(&decimate_q31, d->q31[0], d->q31[2], n); }
+
+static int setup_decimate_q15(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, (FIR_TAPS + n) * sizeof(q15_t));
+	return arm_fir_decimate_init_q15(&decimate_q15, FIR_TAPS, RATE_FACTOR, d->q15[3], d->scratch, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_fir_decimate_q15, GROUP, "q15", SIZES, setup_decimate_q15, NULL) { arm_fir_decimate_q15(&decimate_q15, d->q15[0], d->q15[2], n); }
+
+static int setup_interpolate_f32(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, (FIR_TAPS / RATE_FACTOR + n) * sizeof(float32_t));
+	return arm_fir_interpolate_init_f32(&interpolate_f32, RATE_FACTOR, FIR_TAPS, d->f32[3], d->scratch, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_fir_interpolate_f32, GROUP, "f32", SIZES, setup_interpolate_f32, NULL) { arm_fir_interpolate_f32(&interpolate_f32, d->f32[0], d->f32[2], n); }
+
+static int setup_fir_lattice_f32(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, LATTICE_STAGES * sizeof(float32_t));
+	arm_fir_lattice_init_f32(&fir_lattice_f32, LATTICE_STAGES, lattice_k, d->scratch);
+	return 1;
+}
+DSP_BENCH_FULL(arm_fir_lattice_f32, GROUP, "f32", SIZES, setup_fir_lattice_f32, NULL) { arm_fir_lattice_f32(&fir_lattice_f32, d->f32[0], d->f32[2], n); }
+
+static int setup_sparse_f32(DspBenchData_t *d, uint32_t n)
+{
+	const uint16_t max_delay = (FIR_TAPS - 1) * RATE_FACTOR;
+
+	memset(d->scratch, 0, (max_delay + n) * sizeof(float32_t));
+	arm_fir_sparse_init_f32(&sparse_f32, FIR_TAPS, d->f32[3], d->scratch, sparse_delays, max_delay, n);
+	return 1;
+}
+DSP_BENCH_FULL(arm_fir_sparse_f32, GROUP, "f32", SIZES, setup_sparse_f32, NULL)
+{
+	float32_t *scratch_in = (float32_t *)d->scratch + (FIR_TAPS - 1) * RATE_FACTOR + n;
+	arm_fir_sparse_f32(&sparse_f32, d->f32[0], d->f32[2], scratch_in, n);
+}
+
+static int setup_iir_lattice_f32(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, (LATTICE_STAGES + n) * sizeof(float32_t));
+	arm_iir_lattice_init_f32(&iir_lattice_f32, LATTICE_STAGES, lattice_k, lattice_v, d->scratch, n);
+	return 1;
+}
+DSP_BENCH_FULL(arm_iir_lattice_f32, GROUP, "f32", SIZES, setup_iir_lattice_f32, NULL) { arm_iir_lattice_f32(&iir_lattice_f32, d->f32[0], d->f32[2], n); }
+
+static int setup_df1_f32(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, 4 * BIQUAD_STAGES * sizeof(float32_t));
+	arm_biquad_cascade_df1_init_f32(&df1_f32, BIQUAD_STAGES, biquad_f32, d->scratch);
+	return 1;
+}
+DSP_BENCH_FULL(arm_biquad_cascade_df1_f32, GROUP, "f32", SIZES, setup_df1_f32, NULL) { arm_biquad_cascade_df1_f32(&df1_f32, d->f32[0], d->f32[2], n); }
+
+static int setup_df1_q31(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, 4 * BIQUAD_STAGES * sizeof(q31_t));
+	arm_biquad_cascade_df1_init_q31(&df1_q31, BIQUAD_STAGES, biquad_q31, d->scratch, 1);
+	return 1;
+}
+DSP_BENCH_FULL(arm_biquad_cascade_df1_q31, GROUP, "q31", SIZES, setup_df1_q31, NULL) { arm_biquad_cascade_df1_q31(&df1_q31, d->q31[0], d->q31[2], n); }
+DSP_BENCH_FULL(arm_biquad_cascade_df1_fast_q31, GROUP, "q31", SIZES, setup_df1_q31, NULL) { arm_biquad_cascade_df1_fast_q31(&df1_q31, d->q31[0], d->q31[2], n); }
+
+static int setup_df1_q15(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, 4 * BIQUAD_STAGES * sizeof(q15_t));
+	arm_biquad_cascade_df1_init_q15(&df1_q15, BIQUAD_STAGES, biquad_q15, d->scratch, 1);
+	return 1;
+}
+DSP_BENCH_FULL(arm_biquad_cascade_df1_q15, GROUP, "q15", SIZES, setup_df1_q15, NULL) { arm_biquad_cascade_df1_q15(&df1_q15, d->q15[0], d->q15[2], n); }
+DSP_BENCH_FULL(arm_biquad_cascade_df1_fast_q15, GROUP, "q15", SIZES, setup_df1_q15, NULL) { arm_biquad_cascade_df1_fast_q15(&df1_q15, d->q15[0], d->q15[2], n); }
+
+static int setup_df2T_f32(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, 2 * BIQUAD_STAGES * sizeof(float32_t));
+	arm_biquad_cascade_df2T_init_f32(&df2T_f32, BIQUAD_STAGES, biquad_f32, d->scratch);
+	return 1;
+}
+DSP_BENCH_FULL(arm_biquad_cascade_df2T_f32, GROUP, "f32", SIZES, setup_df2T_f32, NULL) { arm_biquad_cascade_df2T_f32(&df2T_f32, d->f32[0], d->f32[2], n); }
+
+static int setup_stereo_df2T_f32(DspBenchData_t *d, uint32_t n)
+{
+	memset(d->scratch, 0, 4 * BIQUAD_STAGES * sizeof(float32_t));
+	arm_biquad_cascade_stereo_df2T_init_f32(&stereo_df2T_f32, BIQUAD_STAGES, biquad_f32, d->scratch);
+	return 1;
+}
+// n stereo frames, i.e. 2 * n samples
+DSP_BENCH_FULL(arm_biquad_cascade_stereo_df2T_f32, GROUP, "f32", SIZES, setup_stereo_df2T_f32, NULL) { arm_biquad_cascade_stereo_df2T_f32(&stereo_df2T_f32, d->f32[0], d->f32[2], n); }
+
+DSP_BENCH(arm_conv_f32, GROUP, "f32", SIZES) { arm_conv_f32(d->f32[0], n, d->f32[1], CONV_LEN, d->f32[2]); }
+DSP_BENCH(arm_conv_q31, GROUP, "q31", SIZES) { arm_conv_q31(d->q31[0], n, d->q31[1], CONV_LEN, d->q31[2]); }
+DSP_BENCH(arm_conv_q15, GROUP, "q15", SIZES) { arm_conv_q15(d->q15[0], n, d->q15[1], CONV_LEN, d->q15[2]); }
+DSP_BENCH(arm_conv_partial_f32, GROUP, "f32", SIZES) { arm_conv_partial_f32(d->f32[0], n, d->f32[1], CONV_LEN, d->f32[2], 0, n); }
+DSP_BENCH(arm_correlate_f32, GROUP, "f32", SIZES) { arm_correlate_f32(d->f32[0], n, d->f32[1], CONV_LEN, d->f32[2]); }
+DSP_BENCH(arm_correlate_q31, GROUP, "q31", SIZES) { arm_correlate_q31(d->q31[0], n, d->q31[1], CONV_LEN, d->q31[2]); }
+DSP_BENCH(arm_correlate_q15, GROUP, "q15", SIZES) { arm_correlate_q15(d->q15[0], n, d->q15[1], CONV_LEN, d->q15[2]); }
+
+#if !defined(ARM_MATH_NEON)
+// A capture of CAPTURE_LEN samples against a template of n, direct, through the FFT and
+// picked by length. Elements are the n * CAPTURE_LEN multiply-accumulates of the direct
+// versions, so Melem/s compares them directly.
+static uint64_t capture_macs(uint32_t n)
+{
+	return (uint64_t)n * CAPTURE_LEN;
+}
+static uint32_t capture_clock(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+// The auto versions with the ratio of this build
+static int setup_capture_auto(DspBenchData_t *d, uint32_t n)
+{
+	(void)n;
+	arm_conv_fft_calibrate_f32(capture_clock, d->scratch);
+	return 1;
+}
+DSP_BENCH_FULL(conv_direct_f32, GROUP, "f32", dsp_bench_template_sizes, NULL, capture_macs)
+{
+	arm_conv_f32(d->f32[0], CAPTURE_LEN, d->f32[1], n, d->f32[2]);
+}
+DSP_BENCH_FULL(arm_conv_fft_f32, GROUP, "f32", dsp_bench_template_sizes, NULL, capture_macs)
+{
+	arm_conv_fft_f32(d->f32[0], CAPTURE_LEN, d->f32[1], n, d->f32[2], d->scratch);
+}
+DSP_BENCH_FULL(arm_conv_auto_f32, GROUP, "f32", dsp_bench_template_sizes, setup_capture_auto, capture_macs)
+{
+	arm_conv_auto_f32(d->f32[0], CAPTURE_LEN, d->f32[1], n, d->f32[2], d->scratch);
+}
+DSP_BENCH_FULL(correlate_direct_f32, GROUP, "f32", dsp_bench_template_sizes, NULL, capture_macs)
+{
+	arm_correlate_f32(d->f32[0], CAPTURE_LEN, d->f32[1], n, d->f32[2]);
+}
+DSP_BENCH_FULL(arm_correlate_fft_f32, GROUP, "f32", dsp_bench_template_sizes, NULL, capture_macs)
+{
+	arm_correlate_fft_f32(d->f32[0], CAPTURE_LEN, d->f32[1], n, d->f32[2], d->scratch);
+}
+DSP_BENCH_FULL(arm_correlate_auto_f32, GROUP, "f32", dsp_bench_template_sizes, setup_capture_auto, capture_macs)
+{
+	arm_correlate_auto_f32(d->f32[0], CAPTURE_LEN, d->f32[1], n, d->f32[2], d->scratch);
+}
+#endif
+
+#if !defined(ARM_MATH_NEON)
+// FIRs of n taps on blocks of LONG_FIR_BLOCK samples: arm_fir_f32 against the partitioned
+// FFT FIR with partitions of 256 and, for a latency of 64 samples, of 64.
+static arm_fir_instance_f32 long_fir_f32;
+static arm_fir_partitioned_filter_f32 partitioned_filter_f32;
+static arm_fir_partitioned_instance_f32 partitioned_f32;
+
+static uint64_t long_fir_samples(uint32_t n)
+{
+	(void)n;
+	return LONG_FIR_BLOCK;
+}
+static int setup_long_fir_f32(DspBenchData_t *d, uint32_t n)
+{
+	arm_fir_init_f32(&long_fir_f32, n, d->f32[1], d->scratch, LONG_FIR_BLOCK);
+	return 1;
+}
+DSP_BENCH_FULL(fir_direct_f32, GROUP, "f32", dsp_bench_fir_tap_sizes, setup_long_fir_f32, long_fir_samples)
+{
+	arm_fir_f32(&long_fir_f32, d->f32[0], d->f32[2], LONG_FIR_BLOCK);
+}
+
+// Spectra, then the state, then the scratch of the filter init in the scratch buffer
+static int setup_partitioned(DspBenchData_t *d, uint32_t n, uint16_t partition)
+{
+	float32_t *spectra = d->scratch;
+	float32_t *state = spectra + 2 * (n + partition);
+
+	if (arm_fir_partitioned_filter_init_f32(&partitioned_filter_f32, n, d->f32[1], partition, spectra,
+											state + 2 * (n + 4 * partition)) != ARM_MATH_SUCCESS)
+	{
+		return 0;
+	}
+	arm_fir_partitioned_init_f32(&partitioned_f32, &partitioned_filter_f32, state);
+	return 1;
+}
+static int setup_partitioned_256(DspBenchData_t *d, uint32_t n)
+{
+	return setup_partitioned(d, n, 256);
+}
+static int setup_partitioned_64(DspBenchData_t *d, uint32_t n)
+{
+	return setup_partitioned(d, n, 64);
+}
+DSP_BENCH_FULL(arm_fir_partitioned_f32, GROUP, "f32", dsp_bench_fir_tap_sizes, setup_partitioned_256, long_fir_samples)
+{
+	arm_fir_partitioned_f32(&partitioned_f32, d->f32[0], d->f32[2], LONG_FIR_BLOCK);
+}
+DSP_BENCH_FULL(fir_partitioned_64_f32, GROUP, "f32", dsp_bench_fir_tap_sizes, setup_partitioned_64, long_fir_samples)
+{
+	arm_fir_partitioned_f32(&partitioned_f32, d->f32[0], d->f32[2], LONG_FIR_BLOCK);
+}
+#endif
+
+// 48 kHz to 44.1 kHz, n input samples: arm_fir_interpolate_f32 by 147 then arm_fir_decimate_f32
+// by 160 with a single tap, the cheapest chain, against the polyphase resampler, both with
+// RESAMPLE_TAPS coefficients, and the Farrow resampler with cubic Lagrange interpolation at
+// the same ratio plus 50 ppm of drift. Multiply-accumulates per input sample: 2352 + 0.92
+// for the chain, 2352 / 160 = 14.7 for arm_resample_f32, 16 * 0.92 = 14.7 for Lagrange.
+static arm_fir_interpolate_instance_f32 chain_interpolate_f32;
+static arm_fir_decimate_instance_f32 chain_decimate_f32;
+static arm_resample_instance_f32 resample_f32;
+static arm_resample_farrow_instance_f32 resample_farrow_f32;
+static const float32_t lagrange_f32[4 * 4] = {
+	0.0f, 1.0f, 0.0f, 0.0f,
+	-1.0f / 3.0f, -0.5f, 1.0f, -1.0f / 6.0f,
+	0.5f, -1.0f, 0.5f, 0.0f,
+	-1.0f / 6.0f, 0.5f, -0.5f, 1.0f / 6.0f,
+};
+
+// Interpolator state, upsampled block, decimator state in the scratch buffer
+static int setup_resample_chain_f32(DspBenchData_t *d, uint32_t n)
+{
+	float32_t *state = d->scratch;
+	float32_t *upsampled = state + RESAMPLE_TAPS / RESAMPLE_L + n;
+
+	return arm_fir_interpolate_init_f32(&chain_interpolate_f32, RESAMPLE_L, RESAMPLE_TAPS, d->f32[3], state, n) == ARM_MATH_SUCCESS
+		&& arm_fir_decimate_init_f32(&chain_decimate_f32, 1, RESAMPLE_M, d->f32[3], upsampled + n * RESAMPLE_L,
+									 n * RESAMPLE_L) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(resample_chain_f32, GROUP, "f32", resample_sizes, setup_resample_chain_f32, NULL)
+{
+	float32_t *upsampled = (float32_t *)d->scratch + RESAMPLE_TAPS / RESAMPLE_L + n;
+
+	arm_fir_interpolate_f32(&chain_interpolate_f32, d->f32[0], upsampled, n);
+	arm_fir_decimate_f32(&chain_decimate_f32, upsampled, d->f32[2], n * RESAMPLE_L);
+}
+
+static int setup_resample_f32(DspBenchData_t *d, uint32_t n)
+{
+	return arm_resample_init_f32(&resample_f32, RESAMPLE_L, RESAMPLE_M, RESAMPLE_TAPS, d->f32[3], d->scratch, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_resample_f32, GROUP, "f32", resample_sizes, setup_resample_f32, NULL)
+{
+	d->sink = (float32_t)arm_resample_f32(&resample_f32, d->f32[0], d->f32[2], n);
+}
+
+static int setup_resample_farrow_f32(DspBenchData_t *d, uint32_t n)
+{
+	return arm_resample_farrow_init_f32(&resample_farrow_f32, 4, 3, lagrange_f32,
+										(double)RESAMPLE_L / RESAMPLE_M * 1.00005, d->scratch, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_resample_farrow_f32, GROUP, "f32", resample_sizes, setup_resample_farrow_f32, NULL)
+{
+	d->sink = (float32_t)arm_resample_farrow_f32(&resample_farrow_f32, d->f32[0], d->f32[2], n);
+}
+
+// The LMS coefficients adapt, they live in the scratch buffer in front of the state, the
+// error output behind it. The input buffers stay untouched for the other kernels.
+#define LMS_ERR(type, d, n)	((type *)(d)->scratch + 2 * FIR_TAPS + (n))
+static int setup_lms_f32(DspBenchData_t *d, uint32_t n)
+{
+	float32_t *coeffs = d->scratch;
+
+	memset(coeffs, 0, (2 * FIR_TAPS + n) * sizeof(float32_t));
+	arm_lms_init_f32(&lms_f32, FIR_TAPS, coeffs, coeffs + FIR_TAPS, LMS_MU, n);
+	return 1;
+}
+DSP_BENCH_FULL(arm_lms_f32, GROUP, "f32", SIZES, setup_lms_f32, NULL) { arm_lms_f32(&lms_f32, d->f32[0], d->f32[1], d->f32[2], LMS_ERR(float32_t, d, n), n); }
+
+static int setup_lms_q31(DspBenchData_t *d, uint32_t n)
+{
+	q31_t *coeffs = d->scratch;
+
+	memset(coeffs, 0, (2 * FIR_TAPS + n) * sizeof(q31_t));
+	arm_lms_init_q31(&lms_q31, FIR_TAPS, coeffs, coeffs + FIR_TAPS, Q31(LMS_MU), n, 0);
+	return 1;
+}
+DSP_BENCH_FULL(arm_lms_q31, GROUP, "q31", SIZES, setup_lms_q31, NULL) { arm_lms_q31(&lms_q31, d->q31[0], d->q31[1], d->q31[2], LMS_ERR(q31_t, d, n), n); }
+
+static int setup_lms_q15(DspBenchData_t *d, uint32_t n)
+{
+	q15_t *coeffs = d->scratch;
+
+	memset(coeffs, 0, (2 * FIR_TAPS + n) * sizeof(q15_t));
+	arm_lms_init_q15(&lms_q15, FIR_TAPS, coeffs, coeffs + FIR_TAPS, Q15(LMS_MU), n, 0);
+	return 1;
+}
+DSP_BENCH_FULL(arm_lms_q15, GROUP, "q15", SIZES, setup_lms_q15, NULL) { arm_lms_q15(&lms_q15, d->q15[0], d->q15[1], d->q15[2], LMS_ERR(q15_t, d, n), n); }
+
+static int setup_lms_norm_f32(DspBenchData_t *d, uint32_t n)
+{
+	float32_t *coeffs = d->scratch;
+
+	memset(coeffs, 0, (2 * FIR_TAPS + n) * sizeof(float32_t));
+	arm_lms_norm_init_f32(&lms_norm_f32, FIR_TAPS, coeffs, coeffs + FIR_TAPS, 0.1f, n);
+	return 1;
+}
+DSP_BENCH_FULL(arm_lms_norm_f32, GROUP, "f32", SIZES, setup_lms_norm_f32, NULL) { arm_lms_norm_f32(&lms_norm_f32, d->f32[0], d->f32[1], d->f32[2], LMS_ERR(float32_t, d, n), n); }
+
+// n is the predictor order. The autocorrelation of an AR(1) process, so the recursion is well posed.
+static int setup_levinson_f32(DspBenchData_t *d, uint32_t n)
+{
+	float32_t *phi = d->scratch;
+
+	phi[0] = 1.0f;
+	for (uint32_t k = 1; k <= n; k++)
+	{
+		phi[k] = phi[k - 1] * 0.9f;
+	}
+	return 1;
+}
+DSP_BENCH_FULL(arm_levinson_durbin_f32, GROUP, "f32", levinson_sizes, setup_levinson_f32, NULL)
+{
+	float32_t err;
+	arm_levinson_durbin_f32(d->scratch, d->f32[2], &err, n);
+	d->sink = err;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file bench_matrix.c
+ * @brief MatrixFunctions kernels for dsp_bench. n x n matrices, elements per run are n * n.
+ *
+ * The decompositions and the inverse work on a diagonally dominant symmetric matrix, so
+ * they succeed for every size. Kernels that overwrite their source (inverse, QR) copy it
+ * first; the copy is O(n^2) against the O(n^3) of the kernel.
+ */
+
+#include "dsp_bench.h"
+#include <string.h>
+
+#define GROUP "Matrix"
+#define SIZES dsp_bench_matrix_sizes
+#define MAX_DIM 64
+
+static float32_t spd[MAX_DIM * MAX_DIM];		// Symmetric positive definite
+static float32_t lower[MAX_DIM * MAX_DIM];		// Lower triangle of spd
+static float32_t upper[MAX_DIM * MAX_DIM];		// Upper triangle of spd
+static float32_t work[3][MAX_DIM * MAX_DIM];
+static uint16_t permutation[MAX_DIM];
+
+static arm_matrix_instance_f32 a_f32, b_f32, dst_f32, spd_f32, lower_f32, upper_f32, work_f32[3];
+static arm_matrix_instance_q31 a_q31, b_q31, dst_q31;
+static arm_matrix_instance_q15 a_q15, b_q15, dst_q15;
+
+static int setup_matrices(DspBenchData_t *d, uint32_t n)
+{
+	if (n > MAX_DIM)
+	{
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < n; i++)
+	{
+		for (uint32_t j = 0; j < n; j++)
+		{
+			float32_t v = 0.5f * (d->f32[3][i * n + j] + d->f32[3][j * n + i]);
+			if (i == j)
+			{
+				v += (float32_t)n;
+			}
+			spd[i * n + j] = v;
+			lower[i * n + j] = (j <= i) ? v : 0.0f;
+			upper[i * n + j] = (j >= i) ? v : 0.0f;
+		}
+	}
+
+	arm_mat_init_f32(&a_f32, n, n, d->f32[0]);
+	arm_mat_init_f32(&b_f32, n, n, d->f32[1]);
+	arm_mat_init_f32(&dst_f32, n, n, d->f32[2]);
+	arm_mat_init_f32(&spd_f32, n, n, spd);
+	arm_mat_init_f32(&lower_f32, n, n, lower);
+	arm_mat_init_f32(&upper_f32, n, n, upper);
+	for (int k = 0; k < 3; k++)
+	{
+		arm_mat_init_f32(&work_f32[k], n, n, work[k]);
+	}
+	arm_mat_init_q31(&a_q31, n, n, d->q31[0]);
+	arm_mat_init_q31(&b_q31, n, n, d->q31[1]);
+	arm_mat_init_q31(&dst_q31, n, n, d->q31[2]);
+	arm_mat_init_q15(&a_q15, n, n, d->q15[0]);
+	arm_mat_init_q15(&b_q15, n, n, d->q15[1]);
+	arm_mat_init_q15(&dst_q15, n, n, d->q15[2]);
+	return 1;
+}
+
+#define BENCH_MATRIX(kernel, type)	DSP_BENCH_FULL(kernel, GROUP, type, SIZES, setup_matrices, DspBench_Square)
+
+BENCH_MATRIX(arm_mat_add_f32, "f32") { arm_mat_add_f32(&a_f32, &b_f32, &dst_f32); }
+BENCH_MATRIX(arm_mat_add_q31, "q31") { arm_mat_add_q31(&a_q31, &b_q31, &dst_q31); }
+BENCH_MATRIX(arm_mat_add_q15, "q15") { arm_mat_add_q15(&a_q15, &b_q15, &dst_q15); }
+BENCH_MATRIX(arm_mat_sub_f32, "f32") { arm_mat_sub_f32(&a_f32, &b_f32, &dst_f32); }
+BENCH_MATRIX(arm_mat_sub_q31, "q31") { arm_mat_sub_q31(&a_q31, &b_q31, &dst_q31); }
+BENCH_MATRIX(arm_mat_sub_q15, "q15") { arm_mat_sub_q15(&a_q15, &b_q15, &dst_q15); }
+BENCH_MATRIX(arm_mat_scale_f32, "f32") { arm_mat_scale_f32(&a_f32, 0.75f, &dst_f32); }
+BENCH_MATRIX(arm_mat_scale_q31, "q31") { arm_mat_scale_q31(&a_q31, 0x60000000, 0, &dst_q31); }
+BENCH_MATRIX(arm_mat_scale_q15, "q15") { arm_mat_scale_q15(&a_q15, 0x6000, 0, &dst_q15); }
+BENCH_MATRIX(arm_mat_trans_f32, "f32") { arm_mat_trans_f32(&a_f32, &dst_f32); }
+BENCH_MATRIX(arm_mat_trans_q31, "q31") { arm_mat_trans_q31(&a_q31, &dst_q31); }
+BENCH_MATRIX(arm_mat_trans_q15, "q15") { arm_mat_trans_q15(&a_q15, &dst_q15); }
+
+BENCH_MATRIX(arm_mat_mult_f32, "f32") { arm_mat_mult_f32(&a_f32, &b_f32, &dst_f32); }
+BENCH_MATRIX(arm_mat_mult_q31, "q31") { arm_mat_mult_q31(&a_q31, &b_q31, &dst_q31); }
+BENCH_MATRIX(arm_mat_mult_fast_q31, "q31") { arm_mat_mult_fast_q31(&a_q31, &b_q31, &dst_q31); }
+BENCH_MATRIX(arm_mat_mult_opt_q31, "q31") { arm_mat_mult_opt_q31(&a_q31, &b_q31, &dst_q31, d->scratch); }
+BENCH_MATRIX(arm_mat_mult_q15, "q15") { arm_mat_mult_q15(&a_q15, &b_q15, &dst_q15, d->scratch); }
+BENCH_MATRIX(arm_mat_mult_fast_q15, "q15") { arm_mat_mult_fast_q15(&a_q15, &b_q15, &dst_q15, d->scratch); }
+
+BENCH_MATRIX(arm_mat_vec_mult_f32, "f32") { arm_mat_vec_mult_f32(&a_f32, d->f32[1], d->f32[2]); }
+BENCH_MATRIX(arm_mat_vec_mult_q31, "q31") { arm_mat_vec_mult_q31(&a_q31, d->q31[1], d->q31[2]); }
+BENCH_MATRIX(arm_mat_vec_mult_q15, "q15") { arm_mat_vec_mult_q15(&a_q15, d->q15[1], d->q15[2]); }
+
+// Complex matrices: n x n complex elements
+BENCH_MATRIX(arm_mat_cmplx_mult_f32, "f32") { arm_mat_cmplx_mult_f32(&a_f32, &b_f32, &dst_f32); }
+BENCH_MATRIX(arm_mat_cmplx_mult_q31, "q31") { arm_mat_cmplx_mult_q31(&a_q31, &b_q31, &dst_q31); }
+BENCH_MATRIX(arm_mat_cmplx_mult_q15, "q15") { arm_mat_cmplx_mult_q15(&a_q15, &b_q15, &dst_q15, d->scratch); }
+BENCH_MATRIX(arm_mat_cmplx_trans_f32, "f32") { arm_mat_cmplx_trans_f32(&a_f32, &dst_f32); }
+
+BENCH_MATRIX(arm_mat_inverse_f32, "f32")
+{
+	memcpy(work[0], spd, a_f32.numRows * a_f32.numCols * sizeof(float32_t));
+	arm_mat_inverse_f32(&work_f32[0], &dst_f32);
+}
+BENCH_MATRIX(arm_mat_cholesky_f32, "f32") { arm_mat_cholesky_f32(&spd_f32, &dst_f32); }
+BENCH_MATRIX(arm_mat_ldlt_f32, "f32") { arm_mat_ldlt_f32(&spd_f32, &work_f32[0], &dst_f32, permutation); }
+BENCH_MATRIX(arm_mat_solve_lower_triangular_f32, "f32") { arm_mat_solve_lower_triangular_f32(&lower_f32, &b_f32, &dst_f32); }
+BENCH_MATRIX(arm_mat_solve_upper_triangular_f32, "f32") { arm_mat_solve_upper_triangular_f32(&upper_f32, &b_f32, &dst_f32); }
+BENCH_MATRIX(arm_mat_qr_f32, "f32")
+{
+	float32_t *tmp = d->scratch;
+
+	memcpy(work[0], spd, a_f32.numRows * a_f32.numCols * sizeof(float32_t));
+	arm_mat_qr_f32(&work_f32[0], 1e-10f, &work_f32[1], &work_f32[2], tmp, tmp + MAX_DIM, tmp + 2 * MAX_DIM);
+}
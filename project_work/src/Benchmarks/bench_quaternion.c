@@ -0,0 +1,17 @@
+/**
+ * @file bench_quaternion.c
+ * @brief QuaternionMathFunctions kernels for dsp_bench. n is the number of quaternions.
+ */
+
+#include "dsp_bench.h"
+
+#define GROUP "Quaternion"
+#define SIZES dsp_bench_block_sizes
+
+DSP_BENCH(arm_quaternion_conjugate_f32, GROUP, "f32", SIZES) { arm_quaternion_conjugate_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_quaternion_inverse_f32, GROUP, "f32", SIZES) { arm_quaternion_inverse_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_quaternion_norm_f32, GROUP, "f32", SIZES) { arm_quaternion_norm_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_quaternion_normalize_f32, GROUP, "f32", SIZES) { arm_quaternion_normalize_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_quaternion_product_f32, GROUP, "f32", SIZES) { arm_quaternion_product_f32(d->f32[0], d->f32[1], d->f32[2], n); }
+DSP_BENCH(arm_quaternion2rotation_f32, GROUP, "f32", SIZES) { arm_quaternion2rotation_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_rotation2quaternion_f32, GROUP, "f32", SIZES) { arm_rotation2quaternion_f32(d->f32[0], d->f32[2], n); }
@@ -0,0 +1,82 @@
+/**
+ * @file bench_statistics.c
+ * @brief StatisticsFunctions kernels for dsp_bench.
+ */
+
+#include "dsp_bench.h"
+
+#define GROUP "Statistics"
+#define SIZES dsp_bench_vector_sizes
+
+// Kernels with a result and an index: arm_max_f32 etc.
+#define BENCH_INDEXED(kernel, type, buffer, result_t)		\
+	DSP_BENCH(kernel, GROUP, #type, SIZES)					\
+	{														\
+		result_t result;									\
+		uint32_t index;										\
+		kernel(d->buffer[0], n, &result, &index);			\
+		d->sink = (float)result + (float)index;				\
+	}
+
+// Kernels with a single result: arm_mean_f32 etc.
+#define BENCH_RESULT(kernel, type, buffer, result_t)		\
+	DSP_BENCH(kernel, GROUP, #type, SIZES)					\
+	{														\
+		result_t result;									\
+		kernel(d->buffer[0], n, &result);					\
+		d->sink = (float)result;							\
+	}
+
+BENCH_INDEXED(arm_absmax_f32, f32, f32, float32_t)
+BENCH_INDEXED(arm_absmax_q31, q31, q31, q31_t)
+BENCH_INDEXED(arm_absmax_q15, q15, q15, q15_t)
+BENCH_INDEXED(arm_absmin_f32, f32, f32, float32_t)
+BENCH_INDEXED(arm_absmin_q31, q31, q31, q31_t)
+BENCH_INDEXED(arm_absmin_q15, q15, q15, q15_t)
+BENCH_INDEXED(arm_max_f32, f32, f32, float32_t)
+BENCH_INDEXED(arm_max_q31, q31, q31, q31_t)
+BENCH_INDEXED(arm_max_q15, q15, q15, q15_t)
+BENCH_INDEXED(arm_min_f32, f32, f32, float32_t)
+BENCH_INDEXED(arm_min_q31, q31, q31, q31_t)
+BENCH_INDEXED(arm_min_q15, q15, q15, q15_t)
+
+BENCH_RESULT(arm_max_no_idx_f32, f32, f32, float32_t)
+BENCH_RESULT(arm_min_no_idx_f32, f32, f32, float32_t)
+BENCH_RESULT(arm_mean_f32, f32, f32, float32_t)
+BENCH_RESULT(arm_mean_q31, q31, q31, q31_t)
+BENCH_RESULT(arm_mean_q15, q15, q15, q15_t)
+BENCH_RESULT(arm_power_f32, f32, f32, float32_t)
+BENCH_RESULT(arm_power_q31, q31, q31, q63_t)
+BENCH_RESULT(arm_power_q15, q15, q15, q63_t)
+BENCH_RESULT(arm_rms_f32, f32, f32, float32_t)
+BENCH_RESULT(arm_rms_q31, q31, q31, q31_t)
+BENCH_RESULT(arm_rms_q15, q15, q15, q15_t)
+BENCH_RESULT(arm_std_f32, f32, f32, float32_t)
+BENCH_RESULT(arm_std_q31, q31, q31, q31_t)
+BENCH_RESULT(arm_std_q15, q15, q15, q15_t)
+BENCH_RESULT(arm_var_f32, f32, f32, float32_t)
+BENCH_RESULT(arm_var_q31, q31, q31, q31_t)
+BENCH_RESULT(arm_var_q15, q15, q15, q15_t)
+BENCH_RESULT(arm_accumulate_f32, f32, f32, float32_t)
+
+DSP_BENCH(arm_mse_f32, GROUP, "f32", SIZES)
+{
+	float32_t result;
+	arm_mse_f32(d->f32[0], d->f32[1], n, &result);
+	d->sink = result;
+}
+DSP_BENCH(arm_mse_q31, GROUP, "q31", SIZES)
+{
+	q31_t result;
+	arm_mse_q31(d->q31[0], d->q31[1], n, &result);
+	d->sink = (float)result;
+}
+DSP_BENCH(arm_mse_q15, GROUP, "q15", SIZES)
+{
+	q15_t result;
+	arm_mse_q15(d->q15[0], d->q15[1], n, &result);
+	d->sink = (float)result;
+}
+
+DSP_BENCH(arm_entropy_f32, GROUP, "f32", SIZES) { d->sink = arm_entropy_f32(d->f32_positive, n); }
+DSP_BENCH(arm_logsumexp_f32, GROUP, "f32", SIZES) { d->sink = arm_logsumexp_f32(d->f32[0], n); }
@@ -0,0 +1,26 @@
+/**
+ * @file bench_support.c
+ * @brief SupportFunctions kernels for dsp_bench.
+ */
+
+#include "dsp_bench.h"
+
+#define GROUP "Support"
+#define SIZES dsp_bench_vector_sizes
+
+DSP_BENCH(arm_copy_f32, GROUP, "f32", SIZES) { arm_copy_f32(d->f32[0], d->f32[2], n); }
+DSP_BENCH(arm_copy_q31, GROUP, "q31", SIZES) { arm_copy_q31(d->q31[0], d->q31[2], n); }
+DSP_BENCH(arm_copy_q15, GROUP, "q15", SIZES) { arm_copy_q15(d->q15[0], d->q15[2], n); }
+
+DSP_BENCH(arm_fill_f32, GROUP, "f32", SIZES) { arm_fill_f32(0.5f, d->f32[2], n); }
+DSP_BENCH(arm_fill_q31, GROUP, "q31", SIZES) { arm_fill_q31(0x40000000, d->q31[2], n); }
+DSP_BENCH(arm_fill_q15, GROUP, "q15", SIZES) { arm_fill_q15(0x4000, d->q15[2], n); }
+
+DSP_BENCH(arm_float_to_q31, GROUP, "f32", SIZES) { arm_float_to_q31(d->f32[0], d->q31[2], n); }
+DSP_BENCH(arm_float_to_q15, GROUP, "f32", SIZES) { arm_float_to_q15(d->f32[0], d->q15[2], n); }
+DSP_BENCH(arm_q31_to_float, GROUP, "q31", SIZES) { arm_q31_to_float(d->q31[0], d->f32[2], n); }
+DSP_BENCH(arm_q31_to_q15, GROUP, "q31", SIZES) { arm_q31_to_q15(d->q31[0], d->q15[2], n); }
+DSP_BENCH(arm_q15_to_float, GROUP, "q15", SIZES) { arm_q15_to_float(d->q15[0], d->f32[2], n); }
+DSP_BENCH(arm_q15_to_q31, GROUP, "q15", SIZES) { arm_q15_to_q31(d->q15[0], d->q31[2], n); }
+
+DSP_BENCH(arm_weighted_average_f32, GROUP, "f32", SIZES) { d->sink = arm_weighted_average_f32(d->f32[0], d->f32_positive, n); }
@@ -0,0 +1,571 @@
+/**
+ * @file bench_transform.c
+ * @brief TransformFunctions kernels for dsp_bench. n is the transform length.
+ *
+ * The in-place float transforms alternate forward and inverse on a copy of the input,
+ * so the data keeps its range however many calls a sample takes. The fixed point ones
+ * scale down by the length on every call; their timing doesn't depend on the values.
+ *
+ * The mixed-radix transforms run at the 3000 and 4800 sample frame lengths and at the
+ * 4096 and 8192 they would be zero-padded to: compare ns/call, not ns/elem.
+ *
+ * The four-step transforms run from 4096 to 1M points next to fft_radix2_naive_f32, a
+ * textbook in-place radix-2 FFT (bit reversal, then log2 n passes over the whole array)
+ * that shows what the blocking buys once the data is out of the caches.
+ *
+ * The streaming STFT runs next to stft_naive_f32, the same spectrogram frame by frame,
+ * the DCTs next to dct2_matrix_f32, the DCT-II as a matrix product, and the streaming
+ * MFCC next to mfcc_frames_f32, arm_mfcc_f32 frame by frame.
+ */
+
+#include "dsp_bench.h"
+#include <math.h>
+#include <string.h>
+
+#define GROUP "Transform"
+#define SIZES dsp_bench_fft_sizes
+
+static arm_cfft_instance_f32 cfft_f32;
+static arm_cfft_instance_q31 cfft_q31;
+static arm_cfft_instance_q15 cfft_q15;
+static arm_rfft_fast_instance_f32 rfft_fast_f32;
+static arm_rfft_instance_q31 rfft_q31;
+static arm_rfft_instance_q15 rfft_q15;
+static arm_cfft_mr_instance_f32 cfft_mr_f32;
+static arm_rfft_mr_instance_f32 rfft_mr_f32;
+static float32_t mr_twiddle[2 * 8192];
+static float32_t mr_scratch[2 * 8192];
+#if !defined(ARM_MATH_NEON)
+static arm_cfft_4step_instance_f32 cfft_4step_f32;
+static arm_rfft_4step_instance_f32 rfft_4step_f32;
+static float32_t large_twiddle[8 * 4096];
+#endif
+static float32_t radix2_twiddle[DSP_BENCH_MAX_N];
+#if !defined(ARM_MATH_NEON)
+// Run-time FFT tables of every length of dsp_bench_fft_sizes, see FFTTablesF32
+static uint64_t tables_pool[160 * 1024 / sizeof(uint64_t)];
+#endif
+static uint8_t inverse;
+
+// Working copy of the input in the first half of scratch, output and buffers in the second
+#define WORK(type, d)		((type *)(d)->scratch)
+#define WORK_OUT(type, d)	((type *)((char *)(d)->scratch + 4 * DSP_BENCH_BUFFER_LEN))
+
+static int setup_cfft_f32(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(WORK(float32_t, d), d->f32[0], 2 * n * sizeof(float32_t));
+	inverse = 0;
+	return arm_cfft_init_f32(&cfft_f32, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_cfft_f32, GROUP, "f32", SIZES, setup_cfft_f32, NULL)
+{
+#if defined(ARM_MATH_NEON)
+	if (inverse)
+	{
+		arm_cfft_f32(&cfft_f32, WORK_OUT(float32_t, d), WORK(float32_t, d), WORK_OUT(float32_t, d) + 2 * n, 1);
+	}
+	else
+	{
+		arm_cfft_f32(&cfft_f32, WORK(float32_t, d), WORK_OUT(float32_t, d), WORK_OUT(float32_t, d) + 2 * n, 0);
+	}
+#else
+	arm_cfft_f32(&cfft_f32, WORK(float32_t, d), inverse, 1);
+#endif
+	inverse ^= 1;
+}
+
+static int setup_cfft_mr_f32(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(WORK(float32_t, d), d->f32[0], 2 * n * sizeof(float32_t));
+	inverse = 0;
+	return arm_cfft_mr_init_f32(&cfft_mr_f32, n, mr_twiddle, mr_scratch) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_cfft_mr_f32, GROUP, "f32", dsp_bench_fft_mr_sizes, setup_cfft_mr_f32, NULL)
+{
+	arm_cfft_mr_f32(&cfft_mr_f32, WORK(float32_t, d), inverse);
+	inverse ^= 1;
+}
+
+#if !defined(ARM_MATH_NEON)
+static int setup_cfft_4step_f32(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(WORK(float32_t, d), d->f32[0], 2 * n * sizeof(float32_t));
+	inverse = 0;
+	return arm_cfft_4step_init_f32(&cfft_4step_f32, n, large_twiddle) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_cfft_4step_f32, GROUP, "f32", dsp_bench_fft_large_sizes, setup_cfft_4step_f32, NULL)
+{
+	float32_t *from = inverse ? WORK_OUT(float32_t, d) : WORK(float32_t, d);
+	float32_t *to = inverse ? WORK(float32_t, d) : WORK_OUT(float32_t, d);
+
+	arm_cfft_4step_f32(&cfft_4step_f32, from, to, inverse);
+	inverse ^= 1;
+}
+#endif
+
+static int setup_fft_radix2_naive_f32(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(WORK(float32_t, d), d->f32[0], 2 * n * sizeof(float32_t));
+	inverse = 0;
+	for (uint32_t k = 0; k < n / 2; k++)
+	{
+		radix2_twiddle[2 * k] = (float32_t)cos(2.0 * M_PI * k / n);
+		radix2_twiddle[2 * k + 1] = (float32_t)sin(2.0 * M_PI * k / n);
+	}
+	return 1;
+}
+DSP_BENCH_FULL(fft_radix2_naive_f32, GROUP, "f32", dsp_bench_fft_large_sizes, setup_fft_radix2_naive_f32, NULL)
+{
+	float32_t *x = WORK(float32_t, d);
+	float32_t dir = inverse ? 1.0f : -1.0f;
+
+	for (uint32_t i = 1, j = 0; i < n; i++)
+	{
+		uint32_t bit = n >> 1;
+		for (; j & bit; bit >>= 1)
+		{
+			j ^= bit;
+		}
+		j |= bit;
+		if (i < j)
+		{
+			float32_t re = x[2 * i], im = x[2 * i + 1];
+			x[2 * i] = x[2 * j];
+			x[2 * i + 1] = x[2 * j + 1];
+			x[2 * j] = re;
+			x[2 * j + 1] = im;
+		}
+	}
+	for (uint32_t len = 2; len <= n; len <<= 1)
+	{
+		uint32_t step = n / len;
+		for (uint32_t i = 0; i < n; i += len)
+		{
+			for (uint32_t k = 0; k < len / 2; k++)
+			{
+				float32_t wr = radix2_twiddle[2 * k * step], wi = dir * radix2_twiddle[2 * k * step + 1];
+				float32_t *a = x + 2 * (i + k), *b = a + len;
+				float32_t tr = b[0] * wr - b[1] * wi, ti = b[0] * wi + b[1] * wr;
+				b[0] = a[0] - tr;
+				b[1] = a[1] - ti;
+				a[0] += tr;
+				a[1] += ti;
+			}
+		}
+	}
+	if (inverse)
+	{
+		arm_scale_f32(x, 1.0f / n, x, 2 * n);
+	}
+	inverse ^= 1;
+}
+
+static int setup_cfft_q31(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(WORK(q31_t, d), d->q31[0], 2 * n * sizeof(q31_t));
+	return arm_cfft_init_q31(&cfft_q31, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_cfft_q31, GROUP, "q31", SIZES, setup_cfft_q31, NULL)
+{
+#if defined(ARM_MATH_NEON)
+	arm_cfft_q31(&cfft_q31, WORK(q31_t, d), WORK_OUT(q31_t, d), WORK_OUT(q31_t, d) + 2 * n, 0);
+#else
+	arm_cfft_q31(&cfft_q31, WORK(q31_t, d), 0, 1);
+#endif
+}
+
+static int setup_cfft_q15(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(WORK(q15_t, d), d->q15[0], 2 * n * sizeof(q15_t));
+	return arm_cfft_init_q15(&cfft_q15, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_cfft_q15, GROUP, "q15", SIZES, setup_cfft_q15, NULL)
+{
+#if defined(ARM_MATH_NEON)
+	arm_cfft_q15(&cfft_q15, WORK(q15_t, d), WORK_OUT(q15_t, d), WORK_OUT(q15_t, d) + 2 * n, 0);
+#else
+	arm_cfft_q15(&cfft_q15, WORK(q15_t, d), 0, 1);
+#endif
+}
+
+static int setup_rfft_fast_f32(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(WORK(float32_t, d), d->f32[0], n * sizeof(float32_t));
+	inverse = 0;
+	return arm_rfft_fast_init_f32(&rfft_fast_f32, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_rfft_fast_f32, GROUP, "f32", SIZES, setup_rfft_fast_f32, NULL)
+{
+	// Forward from the data to the spectrum, inverse back
+	float32_t *from = inverse ? WORK_OUT(float32_t, d) : WORK(float32_t, d);
+	float32_t *to = inverse ? WORK(float32_t, d) : WORK_OUT(float32_t, d);
+
+#if defined(ARM_MATH_NEON)
+	arm_rfft_fast_f32(&rfft_fast_f32, from, to, WORK_OUT(float32_t, d) + 2 * n, inverse);
+#else
+	arm_rfft_fast_f32(&rfft_fast_f32, from, to, inverse);
+#endif
+	inverse ^= 1;
+}
+
+#if !defined(ARM_MATH_NEON)
+// Before any setup: with ARM_FFT_RUNTIME_TABLES, arm_cfft_init_f32 and arm_rfft_fast_init_f32 take their tables from it
+__attribute__((constructor)) static void setup_tables_pool(void)
+{
+	arm_fft_tables_pool_f32(tables_pool, sizeof(tables_pool));
+}
+
+// Init cost of the run-time tables: computed every time, then found in the plan cache
+DSP_BENCH(arm_cfft_init_tables_f32, GROUP, "f32", SIZES)
+{
+	arm_cfft_init_tables_f32(&cfft_f32, n, WORK(float32_t, d), WORK_OUT(uint16_t, d));
+}
+
+DSP_BENCH(arm_rfft_fast_init_tables_f32, GROUP, "f32", SIZES)
+{
+	arm_rfft_fast_init_tables_f32(&rfft_fast_f32, n, WORK(float32_t, d), WORK_OUT(uint16_t, d));
+}
+
+static int setup_cfft_init_pooled_f32(DspBenchData_t *d, uint32_t n)
+{
+	return arm_cfft_init_pooled_f32(&cfft_f32, n) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_cfft_init_pooled_f32, GROUP, "f32", SIZES, setup_cfft_init_pooled_f32, NULL)
+{
+	arm_cfft_init_pooled_f32(&cfft_f32, n);
+}
+#endif
+
+#if !defined(ARM_MATH_NEON)
+/*
+ * Multi-channel FFTs: one kernel per FFT length, n is the number of channels, so
+ * Melem/s is millions of channels per second. The strided ones are a loop of
+ * single-channel transforms, the reference for the interleaved ones.
+ */
+#define BENCH_FFT_BATCH(LEN)																	\
+	static int setup_fft_batch_##LEN(DspBenchData_t *d, uint32_t n)								\
+	{																							\
+		memcpy(WORK(float32_t, d), d->f32[0], 2 * LEN * n * sizeof(float32_t));					\
+		inverse = 0;																			\
+		return arm_cfft_init_f32(&cfft_f32, LEN) == ARM_MATH_SUCCESS								\
+			&& arm_rfft_fast_init_f32(&rfft_fast_f32, LEN) == ARM_MATH_SUCCESS;					\
+	}																							\
+	DSP_BENCH_FULL(arm_cfft_batch_f32_##LEN, GROUP, "f32", dsp_bench_fft_channel_sizes, setup_fft_batch_##LEN, NULL) \
+	{																							\
+		arm_cfft_batch_f32(&cfft_f32, WORK(float32_t, d), n, inverse);							\
+		inverse ^= 1;																			\
+	}																							\
+	DSP_BENCH_FULL(arm_cfft_batch_strided_f32_##LEN, GROUP, "f32", dsp_bench_fft_channel_sizes, setup_fft_batch_##LEN, NULL) \
+	{																							\
+		arm_cfft_batch_strided_f32(&cfft_f32, WORK(float32_t, d), n, 2 * LEN, inverse);			\
+		inverse ^= 1;																			\
+	}																							\
+	DSP_BENCH_FULL(arm_rfft_fast_batch_f32_##LEN, GROUP, "f32", dsp_bench_fft_channel_sizes, setup_fft_batch_##LEN, NULL) \
+	{																							\
+		float32_t *from = inverse ? WORK_OUT(float32_t, d) : WORK(float32_t, d);				\
+		float32_t *to = inverse ? WORK(float32_t, d) : WORK_OUT(float32_t, d);					\
+																								\
+		arm_rfft_fast_batch_f32(&rfft_fast_f32, from, to, n, inverse);							\
+		inverse ^= 1;																			\
+	}																							\
+	DSP_BENCH_FULL(arm_rfft_fast_batch_strided_f32_##LEN, GROUP, "f32", dsp_bench_fft_channel_sizes, setup_fft_batch_##LEN, NULL) \
+	{																							\
+		float32_t *from = inverse ? WORK_OUT(float32_t, d) : WORK(float32_t, d);				\
+		float32_t *to = inverse ? WORK(float32_t, d) : WORK_OUT(float32_t, d);					\
+																								\
+		arm_rfft_fast_batch_strided_f32(&rfft_fast_f32, from, to, n, LEN, inverse);				\
+		inverse ^= 1;																			\
+	}
+
+BENCH_FFT_BATCH(256)
+BENCH_FFT_BATCH(1024)
+BENCH_FFT_BATCH(4096)
+#endif
+
+#if !defined(ARM_MATH_NEON)
+/*
+ * Streaming STFT, 1024 point frames, hop 256, power spectrum: one kernel per channel
+ * count, n is the block of samples per channel given per call, so Melem/s is millions
+ * of samples per second over all the channels. The input is read on along the random
+ * data as a stream. stft_naive_f32 is the per-frame version: samples deinterleaved one
+ * by one into a buffer per channel, shifted down by the hop after each frame, and the
+ * window recomputed by arm_hanning_f32 for every frame and channel.
+ */
+#define STFT_LEN	1024
+#define STFT_HOP	256
+
+static arm_stft_instance_f32 stft_f32;
+static float32_t stft_window[STFT_LEN];
+static float32_t stft_state[3 * STFT_LEN * 8];
+static float32_t naive_history[8][STFT_LEN], naive_window[STFT_LEN], naive_frame[STFT_LEN], naive_spectrum[STFT_LEN];
+static uint32_t naive_fill;
+static uint32_t stft_pos;
+
+static void stft_naive_f32(const float32_t *pSrc, uint32_t blockSize, uint32_t channels, float32_t *pDst)
+{
+	for (uint32_t j = 0; j < blockSize; j++)
+	{
+		for (uint32_t c = 0; c < channels; c++)
+		{
+			naive_history[c][naive_fill] = pSrc[j * channels + c];
+		}
+		if (++naive_fill < STFT_LEN)
+		{
+			continue;
+		}
+
+		for (uint32_t c = 0; c < channels; c++)
+		{
+			arm_hanning_f32(naive_window, STFT_LEN);
+			arm_mult_f32(naive_history[c], naive_window, naive_frame, STFT_LEN);
+			arm_rfft_fast_f32(&rfft_fast_f32, naive_frame, naive_spectrum, 0);
+			pDst[0] = naive_spectrum[0] * naive_spectrum[0];
+			pDst[STFT_LEN / 2] = naive_spectrum[1] * naive_spectrum[1];
+			arm_cmplx_mag_squared_f32(naive_spectrum + 2, pDst + 1, STFT_LEN / 2 - 1);
+			pDst += STFT_LEN / 2 + 1;
+			memmove(naive_history[c], naive_history[c] + STFT_HOP, (STFT_LEN - STFT_HOP) * sizeof(float32_t));
+		}
+		naive_fill -= STFT_HOP;
+	}
+}
+
+/// @brief The next n samples of each channel of the stream, from the start again at the end of the data.
+static const float32_t *stft_input(DspBenchData_t *d, uint32_t n, uint32_t channels)
+{
+	if ((stft_pos + n) * channels > DSP_BENCH_BUFFER_LEN)
+	{
+		stft_pos = 0;
+	}
+	stft_pos += n;
+	return d->f32[0] + (stft_pos - n) * channels;
+}
+
+#define BENCH_STFT(CH)																			\
+	static uint64_t stft_elements_##CH(uint32_t n)												\
+	{																							\
+		return (uint64_t)n * CH;																\
+	}																							\
+	static int setup_stft_##CH(DspBenchData_t *d, uint32_t n)									\
+	{																							\
+		stft_pos = 0;																			\
+		naive_fill = 0;																			\
+		arm_hanning_f32(stft_window, STFT_LEN);													\
+		return arm_stft_init_f32(&stft_f32, STFT_LEN, STFT_HOP, CH, ARM_STFT_POWER, stft_window,	\
+								 stft_state) == ARM_MATH_SUCCESS									\
+			&& arm_rfft_fast_init_f32(&rfft_fast_f32, STFT_LEN) == ARM_MATH_SUCCESS;				\
+	}																							\
+	DSP_BENCH_FULL(arm_stft_f32_##CH##ch, GROUP, "f32", dsp_bench_block_sizes, setup_stft_##CH, stft_elements_##CH) \
+	{																							\
+		arm_stft_f32(&stft_f32, stft_input(d, n, CH), n, WORK_OUT(float32_t, d));				\
+	}																							\
+	DSP_BENCH_FULL(stft_naive_f32_##CH##ch, GROUP, "f32", dsp_bench_block_sizes, setup_stft_##CH, stft_elements_##CH) \
+	{																							\
+		stft_naive_f32(stft_input(d, n, CH), n, CH, WORK_OUT(float32_t, d));					\
+	}
+
+BENCH_STFT(1)
+BENCH_STFT(8)
+#endif
+
+#if !defined(ARM_MATH_NEON)
+/*
+ * DCTs through the real FFT, against dct2_matrix_f32: the DCT-II as the N x N matrix
+ * product arm_mfcc_f32 does with its dctCoefs, up to 1024 points (4 MB of matrix).
+ */
+static arm_dct_instance_f32 dct_f32;
+static arm_dct_instance_q31 dct_q31;
+static float32_t dct_twiddle[3 * 4096];
+static q31_t dct_twiddle_q31[3 * 4096];
+
+static int setup_dct_f32(DspBenchData_t *d, uint32_t n)
+{
+	return arm_dct_init_f32(&dct_f32, n, dct_twiddle) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_dct2_f32, GROUP, "f32", SIZES, setup_dct_f32, NULL)
+{
+	arm_dct2_f32(&dct_f32, d->f32[0], WORK(float32_t, d), WORK_OUT(float32_t, d));
+}
+DSP_BENCH_FULL(arm_dct3_f32, GROUP, "f32", SIZES, setup_dct_f32, NULL)
+{
+	arm_dct3_f32(&dct_f32, d->f32[0], WORK(float32_t, d), WORK_OUT(float32_t, d));
+}
+DSP_BENCH_FULL(arm_dct4_f32, GROUP, "f32", SIZES, setup_dct_f32, NULL)
+{
+	arm_dct4_f32(&dct_f32, d->f32[0], WORK(float32_t, d), WORK_OUT(float32_t, d));
+}
+
+static int setup_dct_q31(DspBenchData_t *d, uint32_t n)
+{
+	return arm_dct_init_q31(&dct_q31, n, dct_twiddle_q31) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_dct2_q31, GROUP, "q31", SIZES, setup_dct_q31, NULL)
+{
+	arm_dct2_q31(&dct_q31, d->q31[0], WORK(q31_t, d), WORK_OUT(q31_t, d));
+}
+DSP_BENCH_FULL(arm_dct4_q31, GROUP, "q31", SIZES, setup_dct_q31, NULL)
+{
+	arm_dct4_q31(&dct_q31, d->q31[0], WORK(q31_t, d), WORK_OUT(q31_t, d));
+}
+
+static arm_matrix_instance_f32 dct_matrix;
+
+static int setup_dct2_matrix_f32(DspBenchData_t *d, uint32_t n)
+{
+	float32_t *coefs = WORK(float32_t, d);
+
+	if (n > 1024)
+	{
+		return 0;
+	}
+	for (uint32_t k = 0; k < n; k++)
+	{
+		for (uint32_t t = 0; t < n; t++)
+		{
+			coefs[k * n + t] = cosf(PI * (2 * t + 1) * k / (2.0f * n));
+		}
+	}
+	arm_mat_init_f32(&dct_matrix, n, n, coefs);
+	return 1;
+}
+DSP_BENCH_FULL(dct2_matrix_f32, GROUP, "f32", SIZES, setup_dct2_matrix_f32, NULL)
+{
+	arm_mat_vec_mult_f32(&dct_matrix, d->f32[0], WORK_OUT(float32_t, d));
+}
+#endif
+
+#if !defined(ARM_MATH_NEON)
+/*
+ * MFCC of 1024 sample frames, hop 256, 40 Mel filters, 13 coefficients: n is the
+ * number of frames per call, so Melem/s is millions of frames per second.
+ * arm_mfcc_stream_f32 gets the n * 256 samples as one block; mfcc_frames_f32 is the
+ * per-frame API on the same stream, each frame copied out (arm_mfcc_f32 modifies its
+ * input) and processed alone.
+ */
+#define MFCC_LEN		1024
+#define MFCC_FILTERS	40
+#define MFCC_OUTPUTS	13
+#define MFCC_BATCH		64
+
+static arm_mfcc_instance_f32 mfcc_f32;
+static arm_mfcc_stream_instance_f32 mfcc_stream_f32;
+static float32_t mfcc_window[MFCC_LEN], mfcc_frame[MFCC_LEN], mfcc_tmp[2 * MFCC_LEN];
+static float32_t mfcc_dct[MFCC_OUTPUTS * MFCC_FILTERS], mfcc_filter_coefs[MFCC_LEN];
+static uint32_t mfcc_filter_pos[MFCC_FILTERS], mfcc_filter_lengths[MFCC_FILTERS];
+static float32_t mfcc_state[3 * MFCC_LEN + 2 * MFCC_BATCH * (MFCC_LEN / 2 + 1)];
+
+static uint64_t mfcc_frames(uint32_t n)
+{
+	return n;
+}
+
+/// @brief Triangular filters of 24 bins over the first half of the spectrum and the DCT matrix of the scripts.
+static int setup_mfcc(DspBenchData_t *d, uint32_t n)
+{
+	uint32_t count = 0;
+
+	for (uint32_t i = 0; i < MFCC_FILTERS; i++)
+	{
+		mfcc_filter_pos[i] = 1 + i * (MFCC_LEN / 2 - 24) / MFCC_FILTERS;
+		mfcc_filter_lengths[i] = 24;
+		for (uint32_t j = 0; j < 24; j++)
+		{
+			mfcc_filter_coefs[count++] = 1.0f - fabsf((j + 0.5f) / 12.0f - 1.0f);
+		}
+	}
+	for (uint32_t i = 0; i < MFCC_OUTPUTS; i++)
+	{
+		for (uint32_t j = 0; j < MFCC_FILTERS; j++)
+		{
+			mfcc_dct[i * MFCC_FILTERS + j] = cosf(i * PI * (j + 0.5f) / MFCC_FILTERS) * sqrtf(2.0f / MFCC_FILTERS);
+		}
+	}
+	arm_hamming_f32(mfcc_window, MFCC_LEN);
+	stft_pos = 0;
+
+	return arm_mfcc_init_f32(&mfcc_f32, MFCC_LEN, MFCC_FILTERS, MFCC_OUTPUTS, mfcc_dct, mfcc_filter_pos,
+							 mfcc_filter_lengths, mfcc_filter_coefs, mfcc_window) == ARM_MATH_SUCCESS
+		&& arm_mfcc_stream_init_f32(&mfcc_stream_f32, &mfcc_f32, STFT_HOP, 1, MFCC_BATCH, mfcc_state) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_mfcc_stream_f32, GROUP, "f32", dsp_bench_frame_sizes, setup_mfcc, mfcc_frames)
+{
+	arm_mfcc_stream_f32(&mfcc_stream_f32, stft_input(d, n * STFT_HOP, 1), n * STFT_HOP, WORK_OUT(float32_t, d));
+}
+DSP_BENCH_FULL(mfcc_frames_f32, GROUP, "f32", dsp_bench_frame_sizes, setup_mfcc, mfcc_frames)
+{
+	const float32_t *stream = stft_input(d, n * STFT_HOP + MFCC_LEN, 1);
+
+	for (uint32_t f = 0; f < n; f++)
+	{
+		memcpy(mfcc_frame, stream + f * STFT_HOP, MFCC_LEN * sizeof(float32_t));
+		arm_mfcc_f32(&mfcc_f32, mfcc_frame, WORK_OUT(float32_t, d) + f * MFCC_OUTPUTS, mfcc_tmp);
+	}
+}
+#endif
+
+static int setup_rfft_mr_f32(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(WORK(float32_t, d), d->f32[0], n * sizeof(float32_t));
+	inverse = 0;
+	return arm_rfft_mr_init_f32(&rfft_mr_f32, n, mr_twiddle, mr_scratch) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_rfft_mr_f32, GROUP, "f32", dsp_bench_fft_mr_sizes, setup_rfft_mr_f32, NULL)
+{
+	float32_t *from = inverse ? WORK_OUT(float32_t, d) : WORK(float32_t, d);
+	float32_t *to = inverse ? WORK(float32_t, d) : WORK_OUT(float32_t, d);
+
+	arm_rfft_mr_f32(&rfft_mr_f32, from, to, inverse);
+	inverse ^= 1;
+}
+
+#if !defined(ARM_MATH_NEON)
+static int setup_rfft_4step_f32(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(WORK(float32_t, d), d->f32[0], n * sizeof(float32_t));
+	inverse = 0;
+	return arm_rfft_4step_init_f32(&rfft_4step_f32, n, large_twiddle) == ARM_MATH_SUCCESS;
+}
+DSP_BENCH_FULL(arm_rfft_4step_f32, GROUP, "f32", dsp_bench_fft_large_sizes, setup_rfft_4step_f32, NULL)
+{
+	float32_t *from = inverse ? WORK_OUT(float32_t, d) : WORK(float32_t, d);
+	float32_t *to = inverse ? WORK(float32_t, d) : WORK_OUT(float32_t, d);
+
+	arm_rfft_4step_f32(&rfft_4step_f32, from, to, inverse);
+	inverse ^= 1;
+}
+#endif
+
+static int setup_rfft_q31(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(WORK(q31_t, d), d->q31[0], n * sizeof(q31_t));
+#if defined(ARM_MATH_NEON)
+	return arm_rfft_init_q31(&rfft_q31, n) == ARM_MATH_SUCCESS;
+#else
+	return arm_rfft_init_q31(&rfft_q31, n, 0, 1) == ARM_MATH_SUCCESS;
+#endif
+}
+DSP_BENCH_FULL(arm_rfft_q31, GROUP, "q31", SIZES, setup_rfft_q31, NULL)
+{
+#if defined(ARM_MATH_NEON)
+	arm_rfft_q31(&rfft_q31, WORK(q31_t, d), WORK_OUT(q31_t, d), WORK_OUT(q31_t, d) + 2 * n, 0);
+#else
+	arm_rfft_q31(&rfft_q31, WORK(q31_t, d), WORK_OUT(q31_t, d));
+#endif
+}
+
+static int setup_rfft_q15(DspBenchData_t *d, uint32_t n)
+{
+	memcpy(WORK(q15_t, d), d->q15[0], n * sizeof(q15_t));
+#if defined(ARM_MATH_NEON)
+	return arm_rfft_init_q15(&rfft_q15, n) == ARM_MATH_SUCCESS;
+#else
+	return arm_rfft_init_q15(&rfft_q15, n, 0, 1) == ARM_MATH_SUCCESS;
+#endif
+}
+DSP_BENCH_FULL(arm_rfft_q15, GROUP, "q15", SIZES, setup_rfft_q15, NULL)
+{
+#if defined(ARM_MATH_NEON)
+	arm_rfft_q15(&rfft_q15, WORK(q15_t, d), WORK_OUT(q15_t, d), WORK_OUT(q15_t, d) + 2 * n, 0);
+#else
+	arm_rfft_q15(&rfft_q15, WORK(q15_t, d), WORK_OUT(q15_t, d));
+#endif
+}
@@ -0,0 +1,415 @@
+/**
+ * @file dsp_bench.c
+ * @brief Times the registered CMSIS-DSP kernels. See dsp_bench.h.
+ *
+ * Usage:
+ *   dsp_bench [-f filter] [-r repetitions] [-t sample_ms] [-w warmup_ms] [-o results.json] [-l]
+ *   dsp_bench -c base.json new.json
+ *
+ * Per kernel and size: the kernel runs for warmup_ms first, then the calls per sample
+ * are picked so one sample takes about sample_ms, and the median of the repetitions is
+ * reported with the minimum and the spread (coefficient of variation). -f keeps the
+ * kernels whose name contains the filter, e.g. "_f32" or "arm_fir".
+ *
+ * The JSON holds the build configuration and one result per line in a fixed order, so
+ * two files diff line by line; -c prints the speed-up per kernel and size and the
+ * geometric mean per group.
+ *
+ * In DISPATCH builds the x86 variant in use is recorded as "isa"; CMSISDSP_ISA=scalar,
+ * sse or avx2 in the environment times another one with the same binary.
+ */
+
+#include "dsp_bench.h"
+#if defined(ARM_MATH_DISPATCH)
+#include "arm_x86_dispatch.h"
+#endif
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef DSP_BENCH_CONFIG
+#define DSP_BENCH_CONFIG "unknown"
+#endif
+#ifndef DSP_BENCH_CFLAGS
+#define DSP_BENCH_CFLAGS "unknown"
+#endif
+
+#if defined(ARM_MATH_DISPATCH)
+#define DSP_BENCH_ISA		arm_x86_dispatch_name(arm_x86_dispatch_isa())
+#else
+#define DSP_BENCH_ISA		"fixed"		// Chosen at build time, see the options
+#endif
+
+#define MAX_REPETITIONS		101
+#define MAX_COMPARE			4096
+
+const uint32_t dsp_bench_vector_sizes[] = { 16, 256, 4096, 65536, 0 };
+const uint32_t dsp_bench_basic_sizes[] = { 8, 64, 512, 4096, 32768, 262144, 1048576, 0 };
+const uint32_t dsp_bench_block_sizes[] = { 64, 1024, 16384, 0 };
+const uint32_t dsp_bench_matrix_sizes[] = { 4, 6, 16, 64, 0 };
+const uint32_t dsp_bench_fft_sizes[] = { 64, 256, 1024, 4096, 0 };
+const uint32_t dsp_bench_fft_mr_sizes[] = { 3000, 4096, 4800, 8192, 0 };
+const uint32_t dsp_bench_fft_large_sizes[] = { 4096, 65536, 262144, 1048576, 0 };
+const uint32_t dsp_bench_fft_channel_sizes[] = { 1, 2, 4, 8, 16, 32, 64, 0 };
+const uint32_t dsp_bench_frame_sizes[] = { 1, 4, 16, 64, 0 };
+const uint32_t dsp_bench_template_sizes[] = { 8, 32, 64, 128, 512, 1024, 2048, 0 };
+const uint32_t dsp_bench_fir_tap_sizes[] = { 32, 128, 512, 2048, 8192, 32768, 0 };
+const uint32_t dsp_bench_scalar_sizes[] = { 1024, 0 };
+
+static DspBenchKernel_t *kernels = NULL;
+
+typedef struct {
+	double ns_per_call;		// Median
+	double min_ns;
+	double cv_pct;
+	uint64_t iterations;	// Calls per sample
+} Result_t;
+
+uint64_t DspBench_Square(uint32_t n)
+{
+	return (uint64_t)n * n;
+}
+
+/// @brief Keeps the list sorted by group and name, so the output order doesn't depend on the link order.
+void DspBench_Register(DspBenchKernel_t *kernel)
+{
+	DspBenchKernel_t **at = &kernels;
+
+	while (*at != NULL)
+	{
+		int order = strcmp((*at)->group, kernel->group);
+		if (order > 0 || (order == 0 && strcmp((*at)->name, kernel->name) > 0))
+		{
+			break;
+		}
+		at = &(*at)->next;
+	}
+	kernel->next = *at;
+	*at = kernel;
+}
+
+static double now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+	double x = *(const double *)a;
+	double y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+static uint64_t splitmix64(uint64_t *s)
+{
+	uint64_t z = (*s += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+/// @brief Same data for every kernel and run, so results compare across builds.
+static int alloc_data(DspBenchData_t *d)
+{
+	uint64_t seed = 1;
+
+	for (int b = 0; b < DSP_BENCH_BUFFERS; b++)
+	{
+		d->f32[b] = aligned_alloc(64, DSP_BENCH_BUFFER_LEN * sizeof(float32_t));
+		d->q31[b] = aligned_alloc(64, DSP_BENCH_BUFFER_LEN * sizeof(q31_t));
+		d->q15[b] = aligned_alloc(64, DSP_BENCH_BUFFER_LEN * sizeof(q15_t));
+		if (d->f32[b] == NULL || d->q31[b] == NULL || d->q15[b] == NULL)
+		{
+			return -1;
+		}
+	}
+	d->f32_positive = aligned_alloc(64, DSP_BENCH_BUFFER_LEN * sizeof(float32_t));
+	d->scratch = aligned_alloc(64, DSP_BENCH_BUFFER_LEN * 8);
+	if (d->f32_positive == NULL || d->scratch == NULL)
+	{
+		return -1;
+	}
+
+	for (uint32_t i = 0; i < DSP_BENCH_BUFFER_LEN; i++)
+	{
+		for (int b = 0; b < DSP_BENCH_BUFFERS; b++)
+		{
+			float x = (float)(splitmix64(&seed) >> 40) / 16777216.0f - 0.5f;
+			d->f32[b][i] = x;
+			d->q31[b][i] = (q31_t)(x * 2147483648.0f);
+			d->q15[b][i] = (q15_t)(x * 32768.0f);
+		}
+		d->f32_positive[i] = 1.0f - (float)(splitmix64(&seed) >> 40) / 16777216.0f;
+	}
+	memset(d->scratch, 0, DSP_BENCH_BUFFER_LEN * 8);
+	return 0;
+}
+
+static double time_calls(const DspBenchKernel_t *k, DspBenchData_t *d, uint32_t n, uint64_t calls)
+{
+	double t0 = now_ns();
+	for (uint64_t i = 0; i < calls; i++)
+	{
+		k->run(d, n);
+	}
+	return now_ns() - t0;
+}
+
+static void measure(const DspBenchKernel_t *k, DspBenchData_t *d, uint32_t n,
+					int repetitions, double sample_ns, double warmup_ns, Result_t *result)
+{
+	double samples[MAX_REPETITIONS];
+	uint64_t calls = 1;
+	double elapsed = 0;
+
+	// Warm-up, which also sizes the samples.
+	double start = now_ns();
+	do
+	{
+		elapsed = time_calls(k, d, n, calls);
+		if (elapsed < sample_ns / 4)
+		{
+			calls *= 2;
+		}
+	} while (now_ns() - start < warmup_ns);
+	calls = (uint64_t)(calls * sample_ns / (elapsed > 1 ? elapsed : 1));
+	if (calls < 1)
+	{
+		calls = 1;
+	}
+
+	double sum = 0;
+	double sum2 = 0;
+	for (int r = 0; r < repetitions; r++)
+	{
+		samples[r] = time_calls(k, d, n, calls) / calls;
+		sum += samples[r];
+		sum2 += samples[r] * samples[r];
+	}
+	qsort(samples, repetitions, sizeof(double), compare_double);
+
+	double mean = sum / repetitions;
+	double var = sum2 / repetitions - mean * mean;
+	result->ns_per_call = samples[repetitions / 2];
+	result->min_ns = samples[0];
+	result->cv_pct = (mean > 0 && var > 0) ? sqrt(var) / mean * 100.0 : 0.0;
+	result->iterations = calls;
+}
+
+/// @brief Value of "key": in a result line, NULL if it isn't there.
+static const char *json_field(const char *line, const char *key)
+{
+	char pattern[64];
+	snprintf(pattern, sizeof(pattern), "\"%s\": ", key);
+	const char *at = strstr(line, pattern);
+	return (at != NULL) ? at + strlen(pattern) : NULL;
+}
+
+typedef struct {
+	char kernel[64];
+	char group[32];
+	unsigned n;
+	double ns_per_element;
+} Entry_t;
+
+static int load_results(const char *path, Entry_t *entries, int max)
+{
+	FILE *f = fopen(path, "r");
+	char line[512];
+	int count = 0;
+
+	if (f == NULL)
+	{
+		perror(path);
+		return -1;
+	}
+	while (fgets(line, sizeof(line), f) != NULL && count < max)
+	{
+		const char *kernel = json_field(line, "kernel");
+		const char *group = json_field(line, "group");
+		const char *n = json_field(line, "n");
+		const char *per_element = json_field(line, "ns_per_element");
+
+		if (kernel == NULL || group == NULL || n == NULL || per_element == NULL ||
+			sscanf(kernel, "\"%63[^\"]\"", entries[count].kernel) != 1 ||
+			sscanf(group, "\"%31[^\"]\"", entries[count].group) != 1)
+		{
+			continue;
+		}
+		entries[count].n = (unsigned)strtoul(n, NULL, 10);
+		entries[count].ns_per_element = strtod(per_element, NULL);
+		count++;
+	}
+	fclose(f);
+	return count;
+}
+
+static int compare_files(const char *base_path, const char *new_path)
+{
+	static Entry_t base[MAX_COMPARE];
+	static Entry_t next[MAX_COMPARE];
+	int base_count = load_results(base_path, base, MAX_COMPARE);
+	int next_count = load_results(new_path, next, MAX_COMPARE);
+	char group[32] = "";
+	double log_sum = 0;
+	int group_count = 0;
+
+	if (base_count < 0 || next_count < 0)
+	{
+		return 1;
+	}
+
+	printf("%-36s %7s %12s %12s %8s\n", "kernel", "n", "base ns/el", "new ns/el", "speedup");
+	for (int i = 0; i <= next_count; i++)
+	{
+		// Geometric mean of the group that just ended.
+		if (group_count > 0 && (i == next_count || strcmp(next[i].group, group) != 0))
+		{
+			printf("%-36s %7s %12s %12s %7.2fx\n", group, "", "", "geomean", exp(log_sum / group_count));
+			log_sum = 0;
+			group_count = 0;
+		}
+		if (i == next_count)
+		{
+			break;
+		}
+		snprintf(group, sizeof(group), "%s", next[i].group);
+
+		for (int j = 0; j < base_count; j++)
+		{
+			if (base[j].n == next[i].n && strcmp(base[j].kernel, next[i].kernel) == 0 &&
+				base[j].ns_per_element > 0 && next[i].ns_per_element > 0)
+			{
+				double speedup = base[j].ns_per_element / next[i].ns_per_element;
+				printf("%-36s %7u %12.4f %12.4f %7.2fx\n", next[i].kernel, next[i].n,
+					   base[j].ns_per_element, next[i].ns_per_element, speedup);
+				log_sum += log(speedup);
+				group_count++;
+				break;
+			}
+		}
+	}
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	const char *filter = NULL;
+	const char *json_path = NULL;
+	int repetitions = 9;
+	double sample_ms = 2.0;
+	double warmup_ms = 20.0;
+	int list = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "f:r:t:w:o:lc")) != -1)
+	{
+		switch (opt)
+		{
+		case 'f': filter = optarg; break;
+		case 'r': repetitions = atoi(optarg); break;
+		case 't': sample_ms = atof(optarg); break;
+		case 'w': warmup_ms = atof(optarg); break;
+		case 'o': json_path = optarg; break;
+		case 'l': list = 1; break;
+		case 'c':
+			if (optind + 2 != argc)
+			{
+				fprintf(stderr, "usage: %s -c base.json new.json\n", argv[0]);
+				return 2;
+			}
+			return compare_files(argv[optind], argv[optind + 1]);
+		default:
+			fprintf(stderr, "usage: %s [-f filter] [-r repetitions] [-t sample_ms] [-w warmup_ms] [-o results.json] [-l]\n"
+							"       %s -c base.json new.json\n", argv[0], argv[0]);
+			return 2;
+		}
+	}
+	if (repetitions < 1 || repetitions > MAX_REPETITIONS || !(sample_ms > 0) || warmup_ms < 0)
+	{
+		fprintf(stderr, "invalid arguments\n");
+		return 2;
+	}
+
+	if (list)
+	{
+		for (DspBenchKernel_t *k = kernels; k != NULL; k = k->next)
+		{
+			printf("%-20s %-36s %s\n", k->group, k->name, k->type);
+		}
+		return 0;
+	}
+
+	static DspBenchData_t data;
+	if (alloc_data(&data) != 0)
+	{
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+
+	FILE *json = NULL;
+	if (json_path != NULL)
+	{
+		json = fopen(json_path, "w");
+		if (json == NULL)
+		{
+			perror(json_path);
+			return 1;
+		}
+		fprintf(json, "{\n  \"config\": {\"options\": \"%s\", \"isa\": \"%s\", \"cflags\": \"%s\", \"compiler\": \"%s\", "
+					  "\"repetitions\": %d, \"sample_ms\": %g},\n  \"results\": [\n",
+				DSP_BENCH_CONFIG, DSP_BENCH_ISA, DSP_BENCH_CFLAGS, __VERSION__, repetitions, sample_ms);
+	}
+
+	fprintf(stderr, "isa: %s\n", DSP_BENCH_ISA);
+
+	printf("%-20s %-36s %7s %12s %10s %10s %6s\n", "group", "kernel", "n", "ns/call", "ns/elem", "Melem/s", "cv%");
+	int first = 1;
+	for (DspBenchKernel_t *k = kernels; k != NULL; k = k->next)
+	{
+		if (filter != NULL && strstr(k->name, filter) == NULL)
+		{
+			continue;
+		}
+		for (const uint32_t *size = k->sizes; *size != 0; size++)
+		{
+			Result_t r;
+			uint32_t n = *size;
+
+			if (k->setup != NULL && !k->setup(&data, n))
+			{
+				continue;
+			}
+			measure(k, &data, n, repetitions, sample_ms * 1e6, warmup_ms * 1e6, &r);
+
+			uint64_t elements = (k->elements != NULL) ? k->elements(n) : n;
+			double per_element = r.ns_per_call / elements;
+			printf("%-20s %-36s %7u %12.1f %10.4f %10.1f %6.1f\n", k->group, k->name, n,
+				   r.ns_per_call, per_element, 1e3 / per_element, r.cv_pct);
+			fflush(stdout);
+
+			if (json != NULL)
+			{
+				fprintf(json, "%s    {\"kernel\": \"%s\", \"group\": \"%s\", \"type\": \"%s\", \"n\": %u, \"elements\": %llu, "
+							  "\"ns_per_call\": %.2f, \"ns_per_element\": %.5f, \"melements_per_s\": %.2f, "
+							  "\"min_ns\": %.2f, \"cv_pct\": %.2f, \"iterations\": %llu}",
+						first ? "" : ",\n", k->name, k->group, k->type, n, (unsigned long long)elements,
+						r.ns_per_call, per_element, 1e3 / per_element, r.min_ns, r.cv_pct,
+						(unsigned long long)r.iterations);
+				first = 0;
+			}
+		}
+	}
+
+	if (json != NULL)
+	{
+		fprintf(json, "\n  ]\n}\n");
+		fclose(json);
+	}
+	return 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file dsp_bench.h
+ * @brief Host benchmark harness for the CMSIS-DSP kernels in Source/.
+ *
+ * Every kernel is registered by its bench_<group>.c file with DSP_BENCH, at load time,
+ * so adding a kernel is one block in one file. The body runs the kernel once on a
+ * size n from the kernel's size list, on the shared buffers of DspBenchData_t.
+ * dsp_bench.c times every kernel and size and writes the results as JSON.
+ */
+
+#ifndef DSP_BENCH_H
+#define DSP_BENCH_H
+
+#include "arm_math.h"
+#include <stdint.h>
+
+#define DSP_BENCH_MAX_N			1048576	// Largest size in any size list
+#define DSP_BENCH_BUFFER_LEN	(2 * DSP_BENCH_MAX_N)	// Room for complex data and filter state
+#define DSP_BENCH_BUFFERS		4
+
+typedef struct {
+	// Random data in [-0.5, 0.5), DSP_BENCH_BUFFER_LEN elements each
+	float32_t *f32[DSP_BENCH_BUFFERS];
+	q31_t *q31[DSP_BENCH_BUFFERS];
+	q15_t *q15[DSP_BENCH_BUFFERS];
+	float32_t *f32_positive;	// In (0, 1], for logarithms and roots
+	void *scratch;				// DSP_BENCH_BUFFER_LEN * 8 bytes for kernel state
+	volatile float sink;		// Results of kernels that return a value go here
+} DspBenchData_t;
+
+typedef struct DspBenchKernel {
+	const char *name;
+	const char *group;
+	const char *type;
+	const uint32_t *sizes;					// 0 terminated
+	int (*setup)(DspBenchData_t *d, uint32_t n);	// Optional, 0 if the size can't be run
+	void (*run)(DspBenchData_t *d, uint32_t n);
+	uint64_t (*elements)(uint32_t n);		// Optional, elements per run when not n
+	struct DspBenchKernel *next;
+} DspBenchKernel_t;
+
+void DspBench_Register(DspBenchKernel_t *kernel);
+
+// Size lists shared by the bench files
+extern const uint32_t dsp_bench_vector_sizes[];		// 16 .. 65536
+extern const uint32_t dsp_bench_basic_sizes[];		// 8 .. 1M, from L1 to DRAM
+extern const uint32_t dsp_bench_block_sizes[];		// Filter block sizes
+extern const uint32_t dsp_bench_matrix_sizes[];		// n x n, 6 is the plant model
+extern const uint32_t dsp_bench_fft_sizes[];
+extern const uint32_t dsp_bench_fft_mr_sizes[];		// Frame lengths and their power of two padding
+extern const uint32_t dsp_bench_fft_large_sizes[];	// 4096, where arm_cfft_f32 stops, to 1M
+extern const uint32_t dsp_bench_fft_channel_sizes[];	// Channels per call of the multi-channel FFTs
+extern const uint32_t dsp_bench_frame_sizes[];		// Frames per call of the streaming MFCC
+extern const uint32_t dsp_bench_template_sizes[];	// Template lengths of the long correlations
+extern const uint32_t dsp_bench_fir_tap_sizes[];	// Taps of the long FIRs
+extern const uint32_t dsp_bench_scalar_sizes[];		// Calls per run for one-sample kernels
+
+uint64_t DspBench_Square(uint32_t n);	// elements = n * n
+
+/// @brief Registers a kernel with its own setup and element count and opens the body of its run function.
+#define DSP_BENCH_FULL(kernel, group, type, sizes, setup, elements)						\
+	static void dsp_bench_run_##kernel(DspBenchData_t *d, uint32_t n);					\
+	static DspBenchKernel_t dsp_bench_##kernel = { #kernel, group, type, sizes, setup,	\
+												   dsp_bench_run_##kernel, elements, NULL };	\
+	__attribute__((constructor)) static void dsp_bench_register_##kernel(void)			\
+	{																					\
+		DspBench_Register(&dsp_bench_##kernel);											\
+	}																					\
+	static void dsp_bench_run_##kernel(DspBenchData_t *d, uint32_t n)
+
+/// @brief Registers a kernel that needs no setup and handles n elements per run.
+#define DSP_BENCH(kernel, group, type, sizes) DSP_BENCH_FULL(kernel, group, type, sizes, NULL, NULL)
+
+#endif
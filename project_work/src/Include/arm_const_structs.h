@@ -48,6 +48,7 @@ extern "C"
    extern const arm_cfft_instance_f64 arm_cfft_sR_f64_len2048;
    extern const arm_cfft_instance_f64 arm_cfft_sR_f64_len4096;
 
+#if !defined(ARM_FFT_RUNTIME_TABLES)
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len16;
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len32;
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len64;
@@ -57,6 +58,7 @@ extern "C"
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024;
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len2048;
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len4096;
+#endif
 
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len16;
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len32;
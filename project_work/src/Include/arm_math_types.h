@@ -89,6 +89,7 @@ extern "C"
 #define __ALIGNED(x) __declspec(align(x))
 #define __WEAK
 #define SECTION_NOINIT
+#define __RESTRICT __restrict
 #define NO_INLINE __declspec(noinline)
 
 
@@ -98,6 +99,7 @@ extern "C"
 #define __STATIC_FORCEINLINE static inline __attribute__((always_inline)) 
 #define __STATIC_INLINE static inline
 #define __WEAK
+#define __RESTRICT __restrict
 #define SECTION_NOINIT
 #define NO_INLINE __attribute__ ((noinline))
 #elif defined (__GNUC_PYTHON__)
@@ -107,6 +109,7 @@ extern "C"
 #define __STATIC_INLINE static inline
 #define __WEAK
 #define SECTION_NOINIT __attribute__((section(".noinit")))
+#define __RESTRICT __restrict
 #define NO_INLINE __attribute__ ((noinline))
 
 #else
@@ -153,6 +156,12 @@ extern "C"
   #endif
 #endif
 
+/* ARM_MATH_AVX2 / ARM_MATH_SSE select the x86 variants for host builds, see arm_x86_utils.h */
+#if (defined(ARM_MATH_AVX2) || defined(ARM_MATH_SSE)) && !defined(ARM_MATH_AUTOVECTORIZE)
+  #include <immintrin.h>
+  #define ARM_MATH_X86
+#endif
+
 #if !defined(ARM_MATH_AUTOVECTORIZE)
 
 
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_x86_dispatch.h
+ * Description:  Runtime selection of the x86 kernel variants (host builds)
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_X86_DISPATCH_H_
+#define ARM_X86_DISPATCH_H_
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/***************************************
+
+Only in builds with the DISPATCH option (ARM_MATH_DISPATCH defined).
+
+The kernels with x86 variants (see arm_x86_utils.h) are then built three
+times, scalar, SSE2 and AVX2, and the public names call the variant selected
+for the process. The selection is made at the first call of a dispatched
+kernel: the best one the CPU supports, or the one named by the
+CMSISDSP_ISA environment variable (scalar, sse or avx2) to compare them
+with one binary.
+
+***************************************/
+
+typedef enum
+{
+    ARM_X86_ISA_SCALAR = 0,
+    ARM_X86_ISA_SSE,
+    ARM_X86_ISA_AVX2,
+    ARM_X86_ISA_COUNT
+} arm_x86_isa;
+
+/**
+ * @brief  Variant used by the dispatched kernels, selecting it if no kernel has been called yet.
+ * @return the selected variant
+ */
+arm_x86_isa arm_x86_dispatch_isa(void);
+
+/**
+ * @brief  Selects a variant, e.g. for benchmarks and tests.
+ *         Not for use while another thread calls dispatched kernels.
+ * @param[in]  isa  requested variant
+ * @return the variant selected: isa, or the best supported one below it
+ */
+arm_x86_isa arm_x86_dispatch_select(arm_x86_isa isa);
+
+/**
+ * @brief  Best variant this CPU supports.
+ */
+arm_x86_isa arm_x86_dispatch_detect(void);
+
+/**
+ * @brief  Name of a variant, as accepted in CMSISDSP_ISA.
+ */
+const char *arm_x86_dispatch_name(arm_x86_isa isa);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_X86_DISPATCH_H_ */
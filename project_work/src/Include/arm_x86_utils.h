@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_x86_utils.h
+ * Description:  Vector helpers for the x86 SSE / AVX2 variants (host builds)
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_X86_UTILS_H_
+#define ARM_X86_UTILS_H_
+
+#include "arm_math_types.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/***************************************
+
+ARM_MATH_X86 is defined in arm_math_types.h when ARM_MATH_AVX2 or ARM_MATH_SSE
+is set. The kernels are written once against f32xv_t, X86_F32_LANES wide:
+8 lanes with AVX2, 4 lanes with SSE2. No FMA, so element-wise results are
+bit-identical to the scalar code.
+
+***************************************/
+#if defined(ARM_MATH_X86)
+
+#if defined(ARM_MATH_AVX2)
+
+#if !defined(__AVX2__)
+#error "ARM_MATH_AVX2 needs a compiler target with AVX2 (-mavx2)"
+#endif
+
+#define X86_F32_LANES 8
+
+typedef __m256 f32xv_t;
+
+__STATIC_FORCEINLINE f32xv_t x86_vld_f32(const float32_t *p)         { return _mm256_loadu_ps(p); }
+__STATIC_FORCEINLINE void    x86_vst_f32(float32_t *p, f32xv_t v)    { _mm256_storeu_ps(p, v); }
+__STATIC_FORCEINLINE f32xv_t x86_vdup_f32(float32_t x)               { return _mm256_set1_ps(x); }
+__STATIC_FORCEINLINE f32xv_t x86_vadd_f32(f32xv_t a, f32xv_t b)      { return _mm256_add_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vsub_f32(f32xv_t a, f32xv_t b)      { return _mm256_sub_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vmul_f32(f32xv_t a, f32xv_t b)      { return _mm256_mul_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vmin_f32(f32xv_t a, f32xv_t b)      { return _mm256_min_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vmax_f32(f32xv_t a, f32xv_t b)      { return _mm256_max_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vandnot_f32(f32xv_t a, f32xv_t b)   { return _mm256_andnot_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vxor_f32(f32xv_t a, f32xv_t b)      { return _mm256_xor_ps(a, b); }
+
+/* Sum of the lanes, pairwise in a fixed order so the result doesn't depend on the data */
+__STATIC_FORCEINLINE float32_t x86_vaddv_f32(f32xv_t v)
+{
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+    return _mm_cvtss_f32(s);
+}
+
+#else /* ARM_MATH_SSE */
+
+#define X86_F32_LANES 4
+
+typedef __m128 f32xv_t;
+
+__STATIC_FORCEINLINE f32xv_t x86_vld_f32(const float32_t *p)         { return _mm_loadu_ps(p); }
+__STATIC_FORCEINLINE void    x86_vst_f32(float32_t *p, f32xv_t v)    { _mm_storeu_ps(p, v); }
+__STATIC_FORCEINLINE f32xv_t x86_vdup_f32(float32_t x)               { return _mm_set1_ps(x); }
+__STATIC_FORCEINLINE f32xv_t x86_vadd_f32(f32xv_t a, f32xv_t b)      { return _mm_add_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vsub_f32(f32xv_t a, f32xv_t b)      { return _mm_sub_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vmul_f32(f32xv_t a, f32xv_t b)      { return _mm_mul_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vmin_f32(f32xv_t a, f32xv_t b)      { return _mm_min_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vmax_f32(f32xv_t a, f32xv_t b)      { return _mm_max_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vandnot_f32(f32xv_t a, f32xv_t b)   { return _mm_andnot_ps(a, b); }
+__STATIC_FORCEINLINE f32xv_t x86_vxor_f32(f32xv_t a, f32xv_t b)      { return _mm_xor_ps(a, b); }
+
+__STATIC_FORCEINLINE float32_t x86_vaddv_f32(f32xv_t v)
+{
+    __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+    return _mm_cvtss_f32(s);
+}
+
+#endif /* defined(ARM_MATH_AVX2) */
+
+/* |x|: clears the sign bit, as fabsf does, also for NaN and -0 */
+__STATIC_FORCEINLINE f32xv_t x86_vabs_f32(f32xv_t v)
+{
+    return x86_vandnot_f32(x86_vdup_f32(-0.0f), v);
+}
+
+/* -x: flips the sign bit, as the unary minus does */
+__STATIC_FORCEINLINE f32xv_t x86_vneg_f32(f32xv_t v)
+{
+    return x86_vxor_f32(v, x86_vdup_f32(-0.0f));
+}
+
+#endif /* defined(ARM_MATH_X86) */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_X86_UTILS_H_ */
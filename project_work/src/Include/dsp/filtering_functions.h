@@ -35,6 +35,7 @@
 
 #include "dsp/support_functions.h"
 #include "dsp/fast_math_functions.h"
+#include "dsp/transform_functions.h"
 
 #ifdef   __cplusplus
 extern "C"
@@ -1878,6 +1879,286 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         float32_t * pDst);
 
 
+#if !defined(ARM_MATH_NEON)
+  /**
+   * @brief Scratch of arm_conv_fft_calibrate_f32, in floats.
+   */
+#define ARM_CONV_FFT_CALIBRATE_SCRATCH 3072U
+
+  /**
+   * @brief FFT length of the FFT convolution and correlation of two sequences.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @return fftLen, 32 to 4096, or 0 if a length is 0 or both are above 2048. The scratch is 3 * fftLen floats.
+   */
+  uint32_t arm_conv_fft_len_f32(
+        uint32_t srcALen,
+        uint32_t srcBLen);
+
+  /**
+   * @brief Convolution of floating-point sequences through the FFT.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch  points to 3 * arm_conv_fft_len_f32(srcALen, srcBLen) floats.
+   * @return execution status
+   */
+  arm_status arm_conv_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+  /**
+   * @brief Correlation of floating-point sequences through the FFT.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to 3 * arm_conv_fft_len_f32(srcALen, srcBLen) floats.
+   * @return execution status
+   */
+  arm_status arm_correlate_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+  /**
+   * @brief Convolution of floating-point sequences, arm_conv_f32 or arm_conv_fft_f32 by length.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch  points to 3 * arm_conv_fft_len_f32(srcALen, srcBLen) floats.
+   * @return execution status
+   */
+  arm_status arm_conv_auto_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+  /**
+   * @brief Correlation of floating-point sequences, arm_correlate_f32 or arm_correlate_fft_f32 by length.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to 3 * arm_conv_fft_len_f32(srcALen, srcBLen) floats.
+   * @return execution status
+   */
+  arm_status arm_correlate_auto_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+  /**
+   * @brief Sets the cost ratio of arm_conv_auto_f32 and arm_correlate_auto_f32.
+   * @param[in]  ratio  FFT work unit time over direct multiply-accumulate time.
+   */
+  void arm_conv_fft_set_ratio_f32(
+        float32_t ratio);
+
+  /**
+   * @brief Times arm_conv_f32 against arm_conv_fft_f32 and sets the cost ratio of the auto versions.
+   * @param[in]  pClock    returns a time in any unit, e.g. a cycle counter.
+   * @param[in]  pScratch  points to ARM_CONV_FFT_CALIBRATE_SCRATCH floats.
+   * @return the ratio set
+   */
+  float32_t arm_conv_fft_calibrate_f32(
+        uint32_t (*pClock)(void),
+        float32_t * pScratch);
+#endif
+
+#if !defined(ARM_MATH_NEON)
+  /**
+   * @brief Filter spectra of the partitioned FIR, shared by the channels that use the filter.
+   */
+  typedef struct
+  {
+          arm_rfft_fast_instance_f32 Srfft;   /**< Real FFT of 2 * partitionSize points. */
+    const float32_t *pSpectra;                /**< numPartitions packed spectra of 2 * partitionSize floats. */
+          uint16_t partitionSize;             /**< Samples per partition and per processed block. */
+          uint16_t numPartitions;             /**< ceil(numTaps / partitionSize). */
+  } arm_fir_partitioned_filter_f32;
+
+  /**
+   * @brief Instance structure for one channel of the partitioned FIR.
+   */
+  typedef struct
+  {
+    const arm_fir_partitioned_filter_f32 *pFilter; /**< Filter spectra, may be shared. */
+          float32_t *pState;                       /**< 2 * partitionSize * (numPartitions + 3) floats. */
+          uint16_t pos;                            /**< Slot of the newest input spectrum. */
+  } arm_fir_partitioned_instance_f32;
+
+  /**
+   * @brief  Computes the filter spectra of the partitioned FIR.
+   * @param[out] F              points to the filter structure.
+   * @param[in]  numTaps        number of filter coefficients.
+   * @param[in]  pCoeffs        points to the coefficients, in time reversed order like arm_fir_f32.
+   * @param[in]  partitionSize  power of two from 16 to 2048.
+   * @param[out] pSpectra       points to 2 * partitionSize * ceil(numTaps / partitionSize) floats.
+   * @param[in]  pScratch       points to 2 * partitionSize floats.
+   * @return execution status
+   */
+  arm_status arm_fir_partitioned_filter_init_f32(
+        arm_fir_partitioned_filter_f32 * F,
+        uint32_t numTaps,
+  const float32_t * pCoeffs,
+        uint16_t partitionSize,
+        float32_t * pSpectra,
+        float32_t * pScratch);
+
+  /**
+   * @brief  Initialization function for one channel of the partitioned FIR.
+   * @param[out] S        points to the instance.
+   * @param[in]  pFilter  points to the filter spectra.
+   * @param[in]  pState   points to 2 * partitionSize * (numPartitions + 3) floats.
+   */
+  void arm_fir_partitioned_init_f32(
+        arm_fir_partitioned_instance_f32 * S,
+  const arm_fir_partitioned_filter_f32 * pFilter,
+        float32_t * pState);
+
+  /**
+   * @brief Processing function for the partitioned FIR.
+   * @param[in,out] S          points to the instance.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples, a multiple of partitionSize.
+   * @return execution status
+   */
+  arm_status arm_fir_partitioned_f32(
+        arm_fir_partitioned_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+#endif
+
+  /**
+   * @brief Instance structure for the floating-point rational polyphase resampler.
+   */
+  typedef struct
+  {
+          uint16_t L;                 /**< Upsample factor. */
+          uint16_t M;                 /**< Downsample factor. */
+          uint16_t phaseLength;       /**< numTaps / L. */
+          uint16_t phase;             /**< Phase of the next output, 0 to L - 1. */
+          uint32_t skip;              /**< Input samples before the one of the next output. */
+          uint32_t blockSize;         /**< Input samples copied into the state per pass. */
+    const float32_t *pCoeffs;         /**< numTaps coefficients, time reversed as for arm_fir_interpolate_f32. */
+          float32_t *pState;          /**< phaseLength - 1 + blockSize floats. */
+  } arm_resample_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point rational polyphase resampler.
+   * @param[out] S          points to the instance.
+   * @param[in]  L          upsample factor.
+   * @param[in]  M          downsample factor.
+   * @param[in]  numTaps    number of coefficients, a multiple of L.
+   * @param[in]  pCoeffs    points to the coefficients, time reversed.
+   * @param[in]  pState     points to numTaps / L - 1 + blockSize floats.
+   * @param[in]  blockSize  input samples per pass, any number can be given per call.
+   * @return execution status
+   */
+  arm_status arm_resample_init_f32(
+        arm_resample_instance_f32 * S,
+        uint16_t L,
+        uint16_t M,
+        uint32_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point rational polyphase resampler.
+   * @param[in,out] S          points to the instance.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, room for blockSize * L / M + 1 values.
+   * @param[in]     blockSize  number of input samples, any number.
+   * @return number of output samples written
+   */
+  uint32_t arm_resample_f32(
+        arm_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point Farrow resampler.
+   */
+  typedef struct
+  {
+          uint64_t step;              /**< Input samples per output, 32.32 fixed point. */
+          uint64_t pos;               /**< Position of the next output from the next input sample, 32.32 fixed point. */
+          uint16_t numTaps;           /**< Taps of each coefficient polynomial. */
+          uint16_t order;             /**< Degree of the polynomials in the fractional position. */
+          uint32_t blockSize;         /**< Input samples copied into the state per pass. */
+    const float32_t *pCoeffs;         /**< (order + 1) rows of numTaps coefficients, time reversed. */
+          float32_t *pState;          /**< numTaps - 1 + blockSize floats. */
+  } arm_resample_farrow_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Farrow resampler.
+   * @param[out] S          points to the instance.
+   * @param[in]  numTaps    taps of each coefficient polynomial.
+   * @param[in]  order      degree of the polynomials.
+   * @param[in]  pCoeffs    points to (order + 1) * numTaps coefficients, row k for the fractional position to the power k.
+   * @param[in]  ratio      output rate over input rate.
+   * @param[in]  pState     points to numTaps - 1 + blockSize floats.
+   * @param[in]  blockSize  input samples per pass, any number can be given per call.
+   * @return execution status
+   */
+  arm_status arm_resample_farrow_init_f32(
+        arm_resample_farrow_instance_f32 * S,
+        uint16_t numTaps,
+        uint16_t order,
+  const float32_t * pCoeffs,
+        float64_t ratio,
+        float32_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Changes the ratio of the Farrow resampler from the next output on.
+   * @param[in,out] S      points to the instance.
+   * @param[in]     ratio  output rate over input rate, 1/65536 to 4294967296.
+   * @return execution status
+   */
+  arm_status arm_resample_farrow_set_ratio_f32(
+        arm_resample_farrow_instance_f32 * S,
+        float64_t ratio);
+
+  /**
+   * @brief Processing function for the floating-point Farrow resampler.
+   * @param[in,out] S          points to the instance.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, room for blockSize * ratio + 1 values.
+   * @param[in]     blockSize  number of input samples, any number.
+   * @return number of output samples written
+   */
+  uint32_t arm_resample_farrow_f32(
+        arm_resample_farrow_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
   /**
    * @brief Correlation of floating-point sequences.
    * @param[in]  pSrcA    points to the first input sequence.
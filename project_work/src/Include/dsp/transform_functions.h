@@ -849,6 +849,266 @@ void arm_rfft_fast_f32(
         uint8_t ifftFlag);
 #endif
 
+#if !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE))
+  arm_status arm_cfft_init_tables_f32(
+        arm_cfft_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle,
+        uint16_t * pBitRevTable);
+
+  arm_status arm_rfft_fast_init_tables_f32(
+        arm_rfft_fast_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle,
+        uint16_t * pBitRevTable);
+
+  void arm_fft_tables_pool_f32(
+        void * pMem,
+        uint32_t memSize);
+
+  uint32_t arm_fft_tables_pool_used_f32(void);
+
+  arm_status arm_cfft_init_pooled_f32(
+        arm_cfft_instance_f32 * S,
+        uint16_t fftLen);
+
+  arm_status arm_rfft_fast_init_pooled_f32(
+        arm_rfft_fast_instance_f32 * S,
+        uint16_t fftLen);
+
+  void arm_cfft_batch_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p,
+        uint32_t numChannels,
+        uint8_t ifftFlag);
+
+  void arm_cfft_batch_strided_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p,
+        uint32_t numChannels,
+        uint32_t stride,
+        uint8_t ifftFlag);
+
+  void arm_rfft_fast_batch_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint32_t numChannels,
+        uint8_t ifftFlag);
+
+  void arm_rfft_fast_batch_strided_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint32_t numChannels,
+        uint32_t stride,
+        uint8_t ifftFlag);
+#elif defined(ARM_FFT_RUNTIME_TABLES)
+#error "ARM_FFT_RUNTIME_TABLES is for the scalar f32 FFT, the Neon and Helium ones have their own tables"
+#endif
+
+#define ARM_CFFT_MR_MAX_STAGES 16
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                          /**< length of the FFT. */
+          uint16_t numStages;                       /**< number of radix stages. */
+          uint8_t radix[ARM_CFFT_MR_MAX_STAGES];    /**< radix of each stage: 2, 3, 4, 5 or 7. */
+    const float32_t *pTwiddle;                      /**< twiddles of all the stages, computed by the init function. */
+          float32_t *pScratch;                      /**< working buffer of fftLen complex values. */
+  } arm_cfft_mr_instance_f32;
+
+  arm_status arm_cfft_mr_init_f32(
+        arm_cfft_mr_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle,
+        float32_t * pScratch);
+
+  void arm_cfft_mr_f32(
+  const arm_cfft_mr_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+          arm_cfft_mr_instance_f32 Sint;   /**< Internal CFFT structure, of fftLenRFFT / 2. */
+          uint16_t fftLenRFFT;             /**< length of the real sequence */
+    const float32_t * pTwiddleRFFT;        /**< Twiddle factors real stage  */
+  } arm_rfft_mr_instance_f32;
+
+  arm_status arm_rfft_mr_init_f32(
+        arm_rfft_mr_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle,
+        float32_t * pScratch);
+
+  void arm_rfft_mr_f32(
+  const arm_rfft_mr_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag);
+
+#if !defined(ARM_MATH_NEON)
+  /**
+   * @brief Instance structure for the floating-point four-step CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint32_t fftLen;                   /**< length of the FFT, N1 * N2. */
+          uint16_t fftLenCol;                /**< N1, length of the column transforms. */
+          uint16_t fftLenRow;                /**< N2, length of the row transforms. */
+          uint16_t log2Col;                  /**< log2 of N1. */
+          arm_cfft_instance_f32 Scol;        /**< column transform of N1. */
+          arm_cfft_instance_f32 Srow;        /**< row transform of N2. */
+    const float32_t *pTwiddleLo;             /**< W^j, j = 0 .. N1-1, as cos and sin. */
+    const float32_t *pTwiddleHi;             /**< W^(N1 * j), j = 0 .. N2-1, as cos and sin. */
+  } arm_cfft_4step_instance_f32;
+
+  arm_status arm_cfft_4step_init_f32(
+        arm_cfft_4step_instance_f32 * S,
+        uint32_t fftLen,
+        float32_t * pTwiddle);
+
+  void arm_cfft_4step_f32(
+  const arm_cfft_4step_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point four-step RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+          arm_cfft_4step_instance_f32 Sint;  /**< Internal CFFT structure, of fftLenRFFT / 2. */
+          uint32_t fftLenRFFT;               /**< length of the real sequence */
+    const float32_t *pTwiddleLo;             /**< split stage twiddles, as in arm_cfft_4step_instance_f32 */
+    const float32_t *pTwiddleHi;
+  } arm_rfft_4step_instance_f32;
+
+  arm_status arm_rfft_4step_init_f32(
+        arm_rfft_4step_instance_f32 * S,
+        uint32_t fftLen,
+        float32_t * pTwiddle);
+
+  void arm_rfft_4step_f32(
+  const arm_rfft_4step_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag);
+#endif
+
+#if !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE))
+  /**
+   * @brief Output of the STFT for each frame and channel.
+   */
+  typedef enum
+  {
+    ARM_STFT_COMPLEX = 0,   /**< Packed spectrum of arm_rfft_fast_f32, fftLen values */
+    ARM_STFT_MAGNITUDE = 1, /**< |X[k]|, k = 0 .. fftLen/2, fftLen/2 + 1 values */
+    ARM_STFT_POWER = 2      /**< |X[k]|^2, k = 0 .. fftLen/2, fftLen/2 + 1 values */
+  } arm_stft_output;
+
+  /**
+   * @brief Instance structure for the floating-point streaming STFT.
+   */
+  typedef struct
+  {
+          arm_rfft_fast_instance_f32 Srfft;  /**< real FFT of fftLen */
+    const float32_t *pWindow;                /**< fftLen window values, can be shared by instances */
+          float32_t *pState;                 /**< ring of the last fftLen samples, then two work frames */
+          uint32_t numChannels;              /**< interleaved channels */
+          uint16_t fftLen;                   /**< frame length */
+          uint16_t hopSize;                  /**< samples between two frames */
+          uint16_t ringPos;                  /**< oldest sample of the ring, the next one written */
+          uint16_t toNext;                   /**< samples before the next frame */
+          arm_stft_output outputType;        /**< what a frame holds */
+  } arm_stft_instance_f32;
+
+  arm_status arm_stft_init_f32(
+        arm_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+        uint32_t numChannels,
+        arm_stft_output outputType,
+  const float32_t * pWindow,
+        float32_t * pState);
+
+  uint32_t arm_stft_f32(
+        arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst);
+#endif
+
+#if !defined(ARM_MATH_NEON)
+  /**
+   * @brief Instance structure for the floating-point DCT-II, DCT-III and DCT-IV.
+   */
+  typedef struct
+  {
+          arm_rfft_fast_instance_f32 Srfft;  /**< real FFT of N, its CFFT of N/2 for the DCT-IV */
+    const float32_t *pTwiddle;               /**< 3 * N values: exp(-i*pi*k/(2N)), k < N, then the DCT-IV pre-twiddles */
+          uint16_t N;                        /**< length of the DCT */
+  } arm_dct_instance_f32;
+
+  arm_status arm_dct_init_f32(
+        arm_dct_instance_f32 * S,
+        uint16_t N,
+        float32_t * pTwiddle);
+
+  void arm_dct2_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  void arm_dct3_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  void arm_dct4_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp);
+
+  /**
+   * @brief Instance structure for the Q31 DCT-II and DCT-IV.
+   */
+  typedef struct
+  {
+          arm_rfft_instance_q31 Srfft;  /**< forward real FFT of N, its CFFT of N/2 for the DCT-IV */
+    const q31_t *pTwiddle;              /**< 3 * N values, as in arm_dct_instance_f32 */
+          uint16_t N;                   /**< length of the DCT */
+  } arm_dct_instance_q31;
+
+  arm_status arm_dct_init_q31(
+        arm_dct_instance_q31 * S,
+        uint16_t N,
+        q31_t * pTwiddle);
+
+  void arm_dct2_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp);
+
+  void arm_dct4_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp);
+#endif
+
 
   /**
    * @brief Instance structure for the Floating-point MFCC function.
@@ -869,6 +1129,9 @@ typedef struct
 #else
      /* Implementation of the MFCC is using a RFFT (default) */
      arm_rfft_fast_instance_f32 rfft;
+#endif
+#if !defined(ARM_MATH_NEON)
+     const arm_dct_instance_f32 *dct; /**< DCT-II of nbMelFilters used instead of dctCoefs, or NULL */
 #endif
   } arm_mfcc_instance_f32 ;
 
@@ -972,6 +1235,13 @@ arm_status arm_mfcc_init_f32(
   const float32_t *windowCoefs
   );
 
+#if !defined(ARM_MATH_NEON)
+arm_status arm_mfcc_init_dct_f32(
+  arm_mfcc_instance_f32 * S,
+  const arm_dct_instance_f32 *dct
+  );
+#endif
+
 
 /**
   @brief         MFCC F32
@@ -997,6 +1267,33 @@ void arm_mfcc_f32(
   );
 #endif
 
+#if !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE))
+  /**
+   * @brief Instance structure for the floating-point streaming MFCC.
+   */
+  typedef struct
+  {
+          arm_stft_instance_f32 Sstft;   /**< frames, window and magnitude spectra */
+    const arm_mfcc_instance_f32 *pMfcc;  /**< Mel filters, window and DCT */
+          float32_t *pBatch;             /**< two buffers of maxFrames * numChannels * (fftLen/2 + 1) floats */
+          uint32_t maxFrames;            /**< frames per batch */
+  } arm_mfcc_stream_instance_f32;
+
+  arm_status arm_mfcc_stream_init_f32(
+        arm_mfcc_stream_instance_f32 * S,
+  const arm_mfcc_instance_f32 * pMfcc,
+        uint16_t hopSize,
+        uint32_t numChannels,
+        uint32_t maxFrames,
+        float32_t * pState);
+
+  uint32_t arm_mfcc_stream_f32(
+        arm_mfcc_stream_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst);
+#endif
+
  /**
    * @brief Instance structure for the Q31 MFCC function.
    */
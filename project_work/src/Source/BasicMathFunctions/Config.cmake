@@ -95,7 +95,10 @@ if (FASTBUILD)
 
 else()
 target_sources(CMSISDSP PRIVATE ${SRCF64})
+# With DISPATCH these are built per x86 variant by DispatchFunctions/Config.cmake
+if (NOT DISPATCH)
 target_sources(CMSISDSP PRIVATE ${SRCF32})
+endif()
 
 if ((NOT ARMAC5) AND (NOT DISABLEFLOAT16))
 target_sources(CMSISDSP PRIVATE ${SRCF16})
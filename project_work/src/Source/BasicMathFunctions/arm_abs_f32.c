@@ -30,6 +30,10 @@
 
 
 #include "dsp/basic_math_functions.h"
+
+#if defined(ARM_MATH_X86)
+#include "arm_x86_utils.h"
+#endif
 #include <math.h>
 
 /**
@@ -146,6 +150,33 @@ ARM_DSP_ATTRIBUTE void arm_abs_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_X86)
+    f32xv_t vec1;
+    f32xv_t res;
+
+    /* Compute X86_F32_LANES outputs at a time */
+    blkCnt = blockSize / X86_F32_LANES;
+
+    while (blkCnt > 0U)
+    {
+        /* C = |A| */
+
+        /* Calculate absolute values and then store the results in the destination buffer. */
+        vec1 = x86_vld_f32(pSrc);
+        res = x86_vabs_f32(vec1);
+        x86_vst_f32(pDst, res);
+
+        /* Increment pointers */
+        pSrc += X86_F32_LANES;
+        pDst += X86_F32_LANES;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = blockSize % X86_F32_LANES;
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL) && !defined(ARM_MATH_AUTOVECTORIZE)
 
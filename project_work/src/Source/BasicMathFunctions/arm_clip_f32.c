@@ -31,6 +31,10 @@
 
 #include "dsp/basic_math_functions.h"
 
+#if defined(ARM_MATH_X86)
+#include "arm_x86_utils.h"
+#endif
+
 /**
   @ingroup groupMath
  */
@@ -128,8 +132,21 @@ ARM_DSP_ATTRIBUTE void arm_clip_f32(const float32_t * pSrc,
   float32_t high, 
   uint32_t numSamples)
 {
-    uint32_t i;
-    for (i = 0; i < numSamples; i++)
+    uint32_t i = 0;
+
+#if defined(ARM_MATH_X86)
+    f32xv_t vecLow = x86_vdup_f32(low);
+    f32xv_t vecHigh = x86_vdup_f32(high);
+
+    /* max / min return their second operand for NaN and equal zeros, so NaN and -0
+       inputs come out as in the scalar loop. Same results for low <= high. */
+    for (; i + X86_F32_LANES <= numSamples; i += X86_F32_LANES)
+    {
+        x86_vst_f32(&pDst[i], x86_vmin_f32(vecHigh, x86_vmax_f32(vecLow, x86_vld_f32(&pSrc[i]))));
+    }
+#endif
+
+    for (; i < numSamples; i++)
     {                                        
         if (pSrc[i] > high)                  
             pDst[i] = high;                  
@@ -31,6 +31,10 @@
 
 #include "dsp/basic_math_functions.h"
 
+#if defined(ARM_MATH_X86)
+#include "arm_x86_utils.h"
+#endif
+
 /**
   @ingroup groupMath
  */
@@ -59,6 +63,12 @@
   @param[in]     pSrcB      points to the second input vector.
   @param[in]     blockSize  number of samples in each vector.
   @param[out]    result     output result returned here.
+
+  @par           x86 variant
+                   With ARM_MATH_SSE / ARM_MATH_AVX2 the products are summed in
+                   2 * X86_F32_LANES partial sums, so the result is not bit-identical
+                   to the scalar sum. Both are within
+                   blockSize * FLT_EPSILON * sum(|pSrcA[n] * pSrcB[n]|) of the exact value.
  */
 
 #if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
@@ -173,6 +183,33 @@ ARM_DSP_ATTRIBUTE void arm_dot_prod_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_X86)
+    /* Two accumulators, so consecutive adds don't wait for each other */
+    f32xv_t accum0 = x86_vdup_f32(0.0f);
+    f32xv_t accum1 = x86_vdup_f32(0.0f);
+
+    /* Compute 2 * X86_F32_LANES products at a time */
+    blkCnt = blockSize / (2 * X86_F32_LANES);
+
+    while (blkCnt > 0U)
+    {
+        /* C = A[0]*B[0] + A[1]*B[1] + A[2]*B[2] + ... + A[blockSize-1]*B[blockSize-1] */
+        accum0 = x86_vadd_f32(accum0, x86_vmul_f32(x86_vld_f32(pSrcA), x86_vld_f32(pSrcB)));
+        accum1 = x86_vadd_f32(accum1, x86_vmul_f32(x86_vld_f32(pSrcA + X86_F32_LANES), x86_vld_f32(pSrcB + X86_F32_LANES)));
+
+        /* Increment pointers */
+        pSrcA += 2 * X86_F32_LANES;
+        pSrcB += 2 * X86_F32_LANES;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    sum = x86_vaddv_f32(x86_vadd_f32(accum0, accum1));
+
+    /* Tail */
+    blkCnt = blockSize % (2 * X86_F32_LANES);
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL) && !defined(ARM_MATH_AUTOVECTORIZE)
 
@@ -8507,6 +8507,7 @@ const uint64_t twiddleCoefF64_4096[8192] ARM_DSP_TABLE_ATTRIBUTE = {
 
 };
 
+#if !defined(ARM_FFT_RUNTIME_TABLES)
 /**
   @par
   Example code for Floating-point Twiddle factors Generation:
@@ -16835,6 +16836,7 @@ const float32_t twiddleCoef_4096[8192] ARM_DSP_TABLE_ATTRIBUTE = {
     0.999995294f, -0.003067957f,
     0.999998823f, -0.001533980f
 };
+#endif /* !defined(ARM_FFT_RUNTIME_TABLES) */
 
 
 /**
@@ -25055,6 +25057,7 @@ const uint16_t armBitRevIndexTableF64_4096[ARMBITREVINDEXTABLEF64_4096_TABLE_LEN
     31480,32120, 31736,32632, 32248,32504
 };
 
+#if !defined(ARM_FFT_RUNTIME_TABLES)
 const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE_16_TABLE_LENGTH] ARM_DSP_TABLE_ATTRIBUTE =
 {
    /* 8x2, size 20 */
@@ -26039,6 +26042,7 @@ const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE_4096_TABLE_LENGTH] AR
    31096,31544, 31160,32056, 31224,32568, 31672,32120, 31736,32632,
    32248,32696
 };
+#endif /* !defined(ARM_FFT_RUNTIME_TABLES) */
 
 const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH] ARM_DSP_TABLE_ATTRIBUTE =
 {
@@ -30810,6 +30814,7 @@ const uint64_t twiddleCoefF64_rfft_4096[4096] ARM_DSP_TABLE_ATTRIBUTE = {
 };
 
 
+#if !defined(ARM_FFT_RUNTIME_TABLES)
 /**
   @par
   Example code for Floating-point RFFT Twiddle factors Generation:
@@ -34921,6 +34926,7 @@ const float32_t twiddleCoef_rfft_4096[4096] ARM_DSP_TABLE_ATTRIBUTE = {
     0.003067957f, -0.999995294f,
     0.001533980f, -0.999998823f
 };
+#endif /* !defined(ARM_FFT_RUNTIME_TABLES) */
 
 
 /**
@@ -73,8 +73,8 @@ const arm_cfft_instance_f64 arm_cfft_sR_f64_len4096 ARM_DSP_TABLE_ATTRIBUTE = {
   4096, (const float64_t *)twiddleCoefF64_4096, armBitRevIndexTableF64_4096, ARMBITREVINDEXTABLEF64_4096_TABLE_LENGTH
 };
 
-/* Floating-point structs */
-#if (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE)) && !defined(ARM_MATH_NEON)
+/* Floating-point structs, the tables are generated at init with ARM_FFT_RUNTIME_TABLES */
+#if (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE)) && !defined(ARM_MATH_NEON) && !defined(ARM_FFT_RUNTIME_TABLES)
 
 
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len16 ARM_DSP_TABLE_ATTRIBUTE = {
@@ -261,7 +261,7 @@ const arm_rfft_fast_instance_f64 arm_rfft_fast_sR_f64_len4096 ARM_DSP_TABLE_ATTR
 
 /* Floating-point structs */
 
-#if (!defined(ARM_MATH_MVEF)  || defined(ARM_MATH_AUTOVECTORIZE)) && !defined(ARM_MATH_NEON)
+#if (!defined(ARM_MATH_MVEF)  || defined(ARM_MATH_AUTOVECTORIZE)) && !defined(ARM_MATH_NEON) && !defined(ARM_FFT_RUNTIME_TABLES)
 
 const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len32 ARM_DSP_TABLE_ATTRIBUTE = {
   { 16, twiddleCoef_16, armBitRevIndexTable16, ARMBITREVINDEXTABLE_16_TABLE_LENGTH },
@@ -0,0 +1,46 @@
+cmake_minimum_required (VERSION 3.14)
+
+# x86 runtime dispatch (DISPATCH option, host builds). The kernels with x86 variants
+# are built once per variant with suffixed names (arm_add_f32_avx2, ...) and
+# arm_x86_dispatch.c defines the public names. ARM_X86_DISPATCH_KERNELS in that file
+# must list the same kernels.
+
+if (NOT CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64")
+  message(FATAL_ERROR "DISPATCH needs an x86-64 host")
+endif()
+if (FASTBUILD)
+  message(FATAL_ERROR "DISPATCH does not support FASTBUILD")
+endif()
+
+set(DISPATCH_KERNELS
+  arm_abs_f32
+  arm_add_f32
+  arm_clip_f32
+  arm_dot_prod_f32
+  arm_mult_f32
+  arm_negate_f32
+  arm_offset_f32
+  arm_scale_f32
+  arm_sub_f32
+)
+
+foreach(VARIANT scalar sse avx2)
+  add_library(CMSISDSP_${VARIANT} OBJECT)
+  foreach(KERNEL ${DISPATCH_KERNELS})
+    target_sources(CMSISDSP_${VARIANT} PRIVATE BasicMathFunctions/${KERNEL}.c)
+    target_compile_definitions(CMSISDSP_${VARIANT} PRIVATE ${KERNEL}=${KERNEL}_${VARIANT})
+  endforeach()
+
+  # Same options as the rest of the library, then the variant's own
+  target_include_directories(CMSISDSP_${VARIANT} PRIVATE $<TARGET_PROPERTY:CMSISDSP,INCLUDE_DIRECTORIES>)
+  configDsp(CMSISDSP_${VARIANT})
+  target_sources(CMSISDSP PRIVATE $<TARGET_OBJECTS:CMSISDSP_${VARIANT}>)
+endforeach()
+
+target_compile_definitions(CMSISDSP_sse PRIVATE ARM_MATH_SSE)
+target_compile_options(CMSISDSP_sse PRIVATE -msse2)
+target_compile_definitions(CMSISDSP_avx2 PRIVATE ARM_MATH_AVX2)
+target_compile_options(CMSISDSP_avx2 PRIVATE -mavx2)
+
+target_sources(CMSISDSP PRIVATE DispatchFunctions/arm_x86_dispatch.c)
+target_compile_definitions(CMSISDSP PUBLIC ARM_MATH_DISPATCH)
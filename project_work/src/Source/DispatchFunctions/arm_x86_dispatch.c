@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_x86_dispatch.c
+ * Description:  Runtime selection of the x86 kernel variants (host builds)
+ *
+ * Target Processor: x86-64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/basic_math_functions.h"
+#include "arm_x86_dispatch.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The dispatched kernels, all void: name, parameters, arguments.
+ * DispatchFunctions/Config.cmake builds each of them as <name>_scalar, <name>_sse
+ * and <name>_avx2, its DISPATCH_KERNELS list must name the same ones.
+ */
+#define ARM_X86_DISPATCH_KERNELS(X)                                                                 \
+    X(arm_abs_f32,                                                                                  \
+      (const float32_t *pSrc, float32_t *pDst, uint32_t blockSize),                                 \
+      (pSrc, pDst, blockSize))                                                                      \
+    X(arm_add_f32,                                                                                  \
+      (const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize),        \
+      (pSrcA, pSrcB, pDst, blockSize))                                                              \
+    X(arm_clip_f32,                                                                                 \
+      (const float32_t *pSrc, float32_t *pDst, float32_t low, float32_t high, uint32_t numSamples), \
+      (pSrc, pDst, low, high, numSamples))                                                          \
+    X(arm_dot_prod_f32,                                                                             \
+      (const float32_t *pSrcA, const float32_t *pSrcB, uint32_t blockSize, float32_t *result),      \
+      (pSrcA, pSrcB, blockSize, result))                                                            \
+    X(arm_mult_f32,                                                                                 \
+      (const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize),        \
+      (pSrcA, pSrcB, pDst, blockSize))                                                              \
+    X(arm_negate_f32,                                                                               \
+      (const float32_t *pSrc, float32_t *pDst, uint32_t blockSize),                                 \
+      (pSrc, pDst, blockSize))                                                                      \
+    X(arm_offset_f32,                                                                               \
+      (const float32_t *pSrc, float32_t offset, float32_t *pDst, uint32_t blockSize),               \
+      (pSrc, offset, pDst, blockSize))                                                              \
+    X(arm_scale_f32,                                                                                \
+      (const float32_t *pSrc, float32_t scale, float32_t *pDst, uint32_t blockSize),                \
+      (pSrc, scale, pDst, blockSize))                                                               \
+    X(arm_sub_f32,                                                                                  \
+      (const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize),        \
+      (pSrcA, pSrcB, pDst, blockSize))
+
+/* Variant prototypes */
+#define X(name, params, args)         \
+    extern void name##_scalar params; \
+    extern void name##_sse params;    \
+    extern void name##_avx2 params;
+ARM_X86_DISPATCH_KERNELS(X)
+#undef X
+
+/* One table of entry points per variant */
+typedef struct
+{
+#define X(name, params, args) void (*name) params;
+    ARM_X86_DISPATCH_KERNELS(X)
+#undef X
+} arm_x86_dispatch_table;
+
+static const arm_x86_dispatch_table tables[ARM_X86_ISA_COUNT] =
+{
+    [ARM_X86_ISA_SCALAR] = {
+#define X(name, params, args) .name = name##_scalar,
+        ARM_X86_DISPATCH_KERNELS(X)
+#undef X
+    },
+    [ARM_X86_ISA_SSE] = {
+#define X(name, params, args) .name = name##_sse,
+        ARM_X86_DISPATCH_KERNELS(X)
+#undef X
+    },
+    [ARM_X86_ISA_AVX2] = {
+#define X(name, params, args) .name = name##_avx2,
+        ARM_X86_DISPATCH_KERNELS(X)
+#undef X
+    },
+};
+
+static const char *const names[ARM_X86_ISA_COUNT] = { "scalar", "sse", "avx2" };
+
+/* NULL until the first call selects a table. Function pointers rather than ifunc
+   resolvers: those run during relocation, before getenv can be relied on. */
+static const arm_x86_dispatch_table *active = NULL;
+
+arm_x86_isa arm_x86_dispatch_detect(void)
+{
+    __builtin_cpu_init();
+    /* Also checks that the OS saves the YMM registers */
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return ARM_X86_ISA_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return ARM_X86_ISA_SSE;
+    }
+    return ARM_X86_ISA_SCALAR;
+}
+
+arm_x86_isa arm_x86_dispatch_select(arm_x86_isa isa)
+{
+    arm_x86_isa best = arm_x86_dispatch_detect();
+
+    if ((unsigned)isa > (unsigned)best)
+    {
+        isa = best;
+    }
+    __atomic_store_n(&active, &tables[isa], __ATOMIC_RELEASE);
+    return isa;
+}
+
+const char *arm_x86_dispatch_name(arm_x86_isa isa)
+{
+    return ((unsigned)isa < ARM_X86_ISA_COUNT) ? names[isa] : "unknown";
+}
+
+/* First call: CMSISDSP_ISA if set and known, the best supported variant otherwise */
+static const arm_x86_dispatch_table *select_default(void)
+{
+    arm_x86_isa isa = ARM_X86_ISA_AVX2;
+    const char *forced = getenv("CMSISDSP_ISA");
+
+    if (forced != NULL)
+    {
+        for (int i = 0; i < ARM_X86_ISA_COUNT; i++)
+        {
+            if (strcmp(forced, names[i]) == 0)
+            {
+                isa = (arm_x86_isa)i;
+            }
+        }
+    }
+    arm_x86_dispatch_select(isa);
+    return __atomic_load_n(&active, __ATOMIC_ACQUIRE);
+}
+
+__STATIC_FORCEINLINE const arm_x86_dispatch_table *dispatch_table(void)
+{
+    const arm_x86_dispatch_table *table = __atomic_load_n(&active, __ATOMIC_ACQUIRE);
+
+    return (table != NULL) ? table : select_default();
+}
+
+arm_x86_isa arm_x86_dispatch_isa(void)
+{
+    return (arm_x86_isa)(dispatch_table() - tables);
+}
+
+/* The public names */
+#define X(name, params, args)        \
+    void name params                 \
+    {                                \
+        dispatch_table()->name args; \
+    }
+ARM_X86_DISPATCH_KERNELS(X)
+#undef X
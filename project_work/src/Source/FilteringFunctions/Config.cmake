@@ -30,6 +30,8 @@ target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_biquad_cascade_df2T_init_
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_biquad_cascade_stereo_df2T_f32.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_biquad_cascade_stereo_df2T_init_f32.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_conv_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_conv_fft_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_conv_auto_f32.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_conv_fast_opt_q15.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_conv_fast_q15.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_conv_fast_q31.c)
@@ -90,6 +92,8 @@ target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_lattice_init_q15.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_lattice_init_q31.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_lattice_q15.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_lattice_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_partitioned_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_partitioned_init_f32.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_q15.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_q31.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_q7.c)
@@ -119,6 +123,9 @@ target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lms_q15.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_lms_q31.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_levinson_durbin_f32.c)
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_levinson_durbin_q31.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_resample_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_resample_farrow_f32.c)
+target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_resample_init_f32.c)
 
 if ((NOT ARMAC5) AND (NOT DISABLEFLOAT16))
 target_sources(CMSISDSP PRIVATE FilteringFunctions/arm_fir_f16.c)
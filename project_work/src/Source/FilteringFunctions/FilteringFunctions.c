@@ -43,6 +43,8 @@
 #include "arm_biquad_cascade_stereo_df2T_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_init_f32.c"
 #include "arm_conv_f32.c"
+#include "arm_conv_fft_f32.c"
+#include "arm_conv_auto_f32.c"
 #include "arm_conv_fast_opt_q15.c"
 #include "arm_conv_fast_q15.c"
 #include "arm_conv_fast_q31.c"
@@ -101,6 +103,8 @@
 #include "arm_fir_lattice_init_q31.c"
 #include "arm_fir_lattice_q15.c"
 #include "arm_fir_lattice_q31.c"
+#include "arm_fir_partitioned_f32.c"
+#include "arm_fir_partitioned_init_f32.c"
 #include "arm_fir_q15.c"
 #include "arm_fir_q31.c"
 #include "arm_fir_q7.c"
@@ -133,3 +137,6 @@
 
 #include "arm_levinson_durbin_f32.c"
 #include "arm_levinson_durbin_q31.c"
+#include "arm_resample_f32.c"
+#include "arm_resample_farrow_f32.c"
+#include "arm_resample_init_f32.c"
@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_auto_f32.c
+ * Description:  Direct or FFT convolution and correlation by length, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup ConvFFT
+  @{
+ */
+
+/* Lengths timed by arm_conv_fft_calibrate_f32, near the crossover */
+#define ARM_CONV_CALIBRATE_A_LEN  1024U
+#define ARM_CONV_CALIBRATE_B_LEN  64U
+#define ARM_CONV_CALIBRATE_CALLS  4U
+#define ARM_CONV_CALIBRATE_RUNS   5U
+
+/*
+ * Time of one FFT work unit over the time of one multiply-accumulate of the
+ * direct version. Default measured on the x86-64 host with the ARM_MATH_DSP
+ * loops of arm_conv_f32, those of the Cortex-A builds; builds without
+ * ARM_MATH_DSP get the generic loop, several times slower, and should call
+ * arm_conv_fft_calibrate_f32 like the targets.
+ */
+static float32_t arm_conv_fft_ratio = 4.0f;
+
+/*
+ * Work of arm_conv_fft_f32 in units of one butterfly: (2 * blocks + 1) real FFTs
+ * of fftLen / 2 * log2(fftLen) butterflies each, plus the spectrum products,
+ * loads and overlap-adds of each block, about 2 * fftLen.
+ */
+static float32_t arm_conv_fft_cost(
+        uint32_t srcALen,
+        uint32_t srcBLen)
+{
+    const uint32_t fftLen = arm_conv_fft_len_f32(srcALen, srcBLen);
+    const uint32_t hLen = (srcALen < srcBLen) ? srcALen : srcBLen;
+    const uint32_t xLen = srcALen + srcBLen - hLen;
+    const uint32_t step = fftLen - hLen + 1U;
+    const uint32_t blocks = (xLen + step - 1U) / step;
+    uint32_t log2n = 0;
+
+    while ((1U << log2n) < fftLen)
+    {
+        log2n++;
+    }
+    return (float32_t)(2U * blocks + 1U) * (float32_t)(fftLen / 2U * log2n)
+         + (float32_t)blocks * (float32_t)(2U * fftLen);
+}
+
+/* 1 if arm_conv_fft_f32 is expected to be faster than arm_conv_f32 for these lengths */
+static int arm_conv_fft_faster(
+        uint32_t srcALen,
+        uint32_t srcBLen)
+{
+    if (arm_conv_fft_len_f32(srcALen, srcBLen) == 0U)
+    {
+        return 0;
+    }
+    return arm_conv_fft_ratio * arm_conv_fft_cost(srcALen, srcBLen) < (float32_t)srcALen * (float32_t)srcBLen;
+}
+
+/**
+  @brief         Convolution of floating-point sequences, direct or through the FFT.
+  @param[in]     pSrcA      points to the first input sequence
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     pSrcB      points to the second input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @param[out]    pDst       points to the output, srcALen + srcBLen - 1 values
+  @param[in]     pScratch   points to 3 * arm_conv_fft_len_f32(srcALen, srcBLen) floats,
+                            not used when the direct version is faster
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS
+
+  @par
+                   arm_conv_fft_f32 when its cost model, with the ratio of
+                   arm_conv_fft_calibrate_f32, is below the srcALen * srcBLen
+                   multiply-accumulates of arm_conv_f32, arm_conv_f32 otherwise.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_conv_auto_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+    if (arm_conv_fft_faster(srcALen, srcBLen))
+    {
+        return arm_conv_fft_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst, pScratch);
+    }
+    arm_conv_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Correlation of floating-point sequences, direct or through the FFT.
+  @param[in]     pSrcA      points to the first input sequence
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     pSrcB      points to the second input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @param[out]    pDst       points to the output, 2 * max(srcALen, srcBLen) - 1 values
+  @param[in]     pScratch   points to 3 * arm_conv_fft_len_f32(srcALen, srcBLen) floats,
+                            not used when the direct version is faster
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS
+
+  @par
+                   The choice of arm_conv_auto_f32 between arm_correlate_fft_f32 and
+                   arm_correlate_f32. The zero padding of the output is written in both
+                   cases.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_correlate_auto_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+    if (arm_conv_fft_faster(srcALen, srcBLen))
+    {
+        return arm_correlate_fft_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst, pScratch);
+    }
+
+    if (srcALen >= srcBLen)
+    {
+        arm_fill_f32(0.0f, pDst, srcALen - srcBLen);
+    }
+    else
+    {
+        arm_fill_f32(0.0f, pDst + (srcALen + srcBLen - 1U), srcBLen - srcALen);
+    }
+    arm_correlate_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Sets the cost ratio of arm_conv_auto_f32 and arm_correlate_auto_f32.
+  @param[in]     ratio      time of an FFT work unit over the time of a direct multiply-accumulate,
+                            e.g. a value returned by arm_conv_fft_calibrate_f32 and stored
+ */
+ARM_DSP_ATTRIBUTE void arm_conv_fft_set_ratio_f32(
+        float32_t ratio)
+{
+    arm_conv_fft_ratio = ratio;
+}
+
+/**
+  @brief         Times arm_conv_f32 against arm_conv_fft_f32 and sets the cost ratio from it.
+  @param[in]     pClock     returns a time in any unit, e.g. a cycle counter; it may wrap
+  @param[in]     pScratch   points to ARM_CONV_FFT_CALIBRATE_SCRATCH floats
+  @return        the ratio now used by arm_conv_auto_f32 and arm_correlate_auto_f32
+
+  @par
+                   Both versions convolve 1024 with 64 samples, near the crossover, the
+                   fastest of 5 runs of 4 calls each. The ratio is left as it was if the
+                   clock did not advance. Call it once at start-up, with interrupts
+                   that would disturb the timing off, or store the result and set it
+                   with arm_conv_fft_set_ratio_f32.
+ */
+ARM_DSP_ATTRIBUTE float32_t arm_conv_fft_calibrate_f32(
+        uint32_t (*pClock)(void),
+        float32_t * pScratch)
+{
+    const uint32_t outLen = ARM_CONV_CALIBRATE_A_LEN + ARM_CONV_CALIBRATE_B_LEN - 1U;
+    float32_t *pA = pScratch;
+    float32_t *pB = pA + ARM_CONV_CALIBRATE_A_LEN;
+    float32_t *pOut = pB + ARM_CONV_CALIBRATE_B_LEN;
+    float32_t *pFft = pOut + outLen;
+    uint32_t direct = UINT32_MAX, fft = UINT32_MAX;
+
+    arm_fill_f32(0.25f, pA, ARM_CONV_CALIBRATE_A_LEN);
+    arm_fill_f32(-0.5f, pB, ARM_CONV_CALIBRATE_B_LEN);
+
+    for (uint32_t run = 0; run < ARM_CONV_CALIBRATE_RUNS; run++)
+    {
+        uint32_t t0, t1, t2;
+
+        t0 = pClock();
+        for (uint32_t i = 0; i < ARM_CONV_CALIBRATE_CALLS; i++)
+        {
+            arm_conv_f32(pA, ARM_CONV_CALIBRATE_A_LEN, pB, ARM_CONV_CALIBRATE_B_LEN, pOut);
+        }
+        t1 = pClock();
+        for (uint32_t i = 0; i < ARM_CONV_CALIBRATE_CALLS; i++)
+        {
+            arm_conv_fft_f32(pA, ARM_CONV_CALIBRATE_A_LEN, pB, ARM_CONV_CALIBRATE_B_LEN, pOut, pFft);
+        }
+        t2 = pClock();
+
+        direct = (t1 - t0 < direct) ? t1 - t0 : direct;
+        fft = (t2 - t1 < fft) ? t2 - t1 : fft;
+    }
+
+    if (direct != 0U && fft != 0U)
+    {
+        /* (fft time per unit) / (direct time per multiply-accumulate) */
+        arm_conv_fft_ratio = ((float32_t)fft / arm_conv_fft_cost(ARM_CONV_CALIBRATE_A_LEN, ARM_CONV_CALIBRATE_B_LEN))
+                           / ((float32_t)direct / (float32_t)(ARM_CONV_CALIBRATE_A_LEN * ARM_CONV_CALIBRATE_B_LEN));
+    }
+    return arm_conv_fft_ratio;
+}
+
+/**
+  @} end of ConvFFT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
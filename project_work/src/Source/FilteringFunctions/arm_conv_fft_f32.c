@@ -0,0 +1,255 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_f32.c
+ * Description:  Convolution and correlation through the real FFT, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/transform_functions.h"
+#include "dsp/complex_math_functions.h"
+#include "dsp/basic_math_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup ConvFFT FFT Convolution and Correlation
+
+  @par
+                   arm_conv_fft_f32 and arm_correlate_fft_f32 compute the results of
+                   arm_conv_f32 and arm_correlate_f32 with arm_rfft_fast_f32: the
+                   spectrum of the shorter sequence is computed once and the longer
+                   one is processed in blocks (overlap-add), each block one forward
+                   and one inverse FFT of length fftLen. fftLen is about 4 times the
+                   shorter length, from 32 to 4096, so the shorter sequence can have
+                   up to 2048 samples and the longer one any length. The cost grows
+                   with log2(fftLen) per output sample instead of the shorter length:
+                   correlating a 4096 sample capture with a 1024 sample template takes
+                   5 FFTs of 4096 points instead of 4 million multiply-accumulates.
+  @par
+                   arm_conv_auto_f32 and arm_correlate_auto_f32 pick the direct or the
+                   FFT version from the lengths, with a cost model whose ratio is set by
+                   arm_conv_fft_calibrate_f32 on the target.
+  @par           Scratch
+                   3 * arm_conv_fft_len_f32(srcALen, srcBLen) floats: the spectrum of
+                   the shorter sequence, a block and its spectrum.
+  @par           Accuracy
+                   Within a few roundings of the direct versions relative to the norm
+                   of the result, as for the FFTs: output samples much smaller than the
+                   rest carry the error of the large ones.
+ */
+
+/**
+  @addtogroup ConvFFT
+  @{
+ */
+
+/* Largest real FFT of arm_rfft_fast_f32 */
+#define ARM_CONV_FFT_MAX_LEN  4096U
+
+/*
+ * Samples offset .. offset + len - 1 of pSrc, read backwards from its end when
+ * reverse is set, into pDst padded with zeros to fftLen.
+ */
+static void arm_conv_fft_load_f32(
+        float32_t * pDst,
+  const float32_t * pSrc,
+        uint32_t srcLen,
+        uint8_t reverse,
+        uint32_t offset,
+        uint32_t len,
+        uint32_t fftLen)
+{
+    if (reverse)
+    {
+        const float32_t *pIn = pSrc + (srcLen - 1U - offset);
+
+        for (uint32_t j = 0; j < len; j++)
+        {
+            pDst[j] = pIn[-(int32_t)j];
+        }
+    }
+    else
+    {
+        arm_copy_f32(pSrc + offset, pDst, len);
+    }
+    arm_fill_f32(0.0f, pDst + len, fftLen - len);
+}
+
+/*
+ * Full convolution of the sequences x (length xLen) and h (length hLen <= xLen),
+ * each read backwards when its flag is set, into pDst: xLen + hLen - 1 values.
+ */
+static arm_status arm_conv_fft_ola_f32(
+  const float32_t * pX,
+        uint32_t xLen,
+        uint8_t reverseX,
+  const float32_t * pH,
+        uint32_t hLen,
+        uint8_t reverseH,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+    const uint32_t fftLen = arm_conv_fft_len_f32(xLen, hLen);
+    const uint32_t step = fftLen - hLen + 1U;   /* Input samples per block */
+    float32_t *pH_f = pScratch;                 /* Spectrum of h */
+    float32_t *pBlock = pScratch + fftLen;
+    float32_t *pSpectrum = pScratch + 2U * fftLen;
+    arm_rfft_fast_instance_f32 S;
+
+    if (fftLen == 0U || arm_rfft_fast_init_f32(&S, (uint16_t)fftLen) != ARM_MATH_SUCCESS)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    arm_conv_fft_load_f32(pBlock, pH, hLen, reverseH, 0, hLen, fftLen);
+    arm_rfft_fast_f32(&S, pBlock, pH_f, 0);
+
+    arm_fill_f32(0.0f, pDst, xLen + hLen - 1U);
+    for (uint32_t offset = 0; offset < xLen; offset += step)
+    {
+        const uint32_t len = (xLen - offset < step) ? xLen - offset : step;
+
+        arm_conv_fft_load_f32(pBlock, pX, xLen, reverseX, offset, len, fftLen);
+        arm_rfft_fast_f32(&S, pBlock, pSpectrum, 0);
+
+        /* Packed spectra: the real values at 0 and fftLen / 2 first */
+        pBlock[0] = pSpectrum[0] * pH_f[0];
+        pBlock[1] = pSpectrum[1] * pH_f[1];
+        arm_cmplx_mult_cmplx_f32(pSpectrum + 2, pH_f + 2, pBlock + 2, fftLen / 2U - 1U);
+        arm_rfft_fast_f32(&S, pBlock, pSpectrum, 1);
+
+        /* Overlap-add of the len + hLen - 1 values of the block */
+        arm_add_f32(pDst + offset, pSpectrum, pDst + offset, len + hLen - 1U);
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         FFT length used for two sequences by the FFT convolution and correlation.
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @return        fftLen, from 32 to 4096, or 0 if a length is 0 or both are above 2048
+
+  @par
+                   A power of two of about 4 times the shorter length, not above the one
+                   the whole result fits in. The scratch of the FFT functions is
+                   3 * fftLen floats.
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_conv_fft_len_f32(
+        uint32_t srcALen,
+        uint32_t srcBLen)
+{
+    const uint32_t hLen = (srcALen < srcBLen) ? srcALen : srcBLen;
+    const uint32_t outLen = srcALen + srcBLen - 1U;
+    uint32_t fftLen = 32U;
+
+    if (hLen == 0U || hLen > ARM_CONV_FFT_MAX_LEN / 2U)
+    {
+        return 0U;
+    }
+
+    while (fftLen < 4U * hLen && fftLen < outLen && fftLen < ARM_CONV_FFT_MAX_LEN)
+    {
+        fftLen <<= 1;
+    }
+    return fftLen;
+}
+
+/**
+  @brief         Convolution of floating-point sequences through the FFT.
+  @param[in]     pSrcA      points to the first input sequence
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     pSrcB      points to the second input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @param[out]    pDst       points to the output, srcALen + srcBLen - 1 values
+  @param[in]     pScratch   points to 3 * arm_conv_fft_len_f32(srcALen, srcBLen) floats
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a length is 0 or both are above 2048
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_conv_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+    if (srcALen >= srcBLen)
+    {
+        return arm_conv_fft_ola_f32(pSrcA, srcALen, 0, pSrcB, srcBLen, 0, pDst, pScratch);
+    }
+    return arm_conv_fft_ola_f32(pSrcB, srcBLen, 0, pSrcA, srcALen, 0, pDst, pScratch);
+}
+
+/**
+  @brief         Correlation of floating-point sequences through the FFT.
+  @param[in]     pSrcA      points to the first input sequence
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     pSrcB      points to the second input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @param[out]    pDst       points to the output, 2 * max(srcALen, srcBLen) - 1 values
+  @param[in]     pScratch   points to 3 * arm_conv_fft_len_f32(srcALen, srcBLen) floats
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a length is 0 or both are above 2048
+
+  @par
+                   The layout of arm_correlate_f32: the convolution of a with b reversed,
+                   after srcALen - srcBLen zeros when a is longer, followed by
+                   srcBLen - srcALen zeros when b is longer. The zeros are written, pDst
+                   needs no initialization.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_correlate_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+    const uint32_t outLen = srcALen + srcBLen - 1U;
+
+    if (arm_conv_fft_len_f32(srcALen, srcBLen) == 0U)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    if (srcALen >= srcBLen)
+    {
+        arm_fill_f32(0.0f, pDst, srcALen - srcBLen);
+        return arm_conv_fft_ola_f32(pSrcA, srcALen, 0, pSrcB, srcBLen, 1, pDst + (srcALen - srcBLen), pScratch);
+    }
+
+    /* conv(a, reverse(b)) = conv(reverse(b), a) */
+    arm_fill_f32(0.0f, pDst + outLen, srcBLen - srcALen);
+    return arm_conv_fft_ola_f32(pSrcB, srcBLen, 1, pSrcA, srcALen, 0, pDst, pScratch);
+}
+
+/**
+  @} end of ConvFFT group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_partitioned_f32.c
+ * Description:  Uniformly partitioned overlap-save FIR, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIRPartitioned Partitioned FFT FIR
+
+  @par
+                   FIR filter for long impulse responses (room responses, long
+                   equalizers: thousands to tens of thousands of taps) in the
+                   frequency domain, uniformly partitioned overlap-save. The taps are
+                   split into numPartitions partitions of partitionSize; each block of
+                   partitionSize input samples takes one real FFT and one inverse real
+                   FFT of 2 * partitionSize points, and one complex multiply-accumulate
+                   per partition and frequency bin with the spectra of the previous
+                   input blocks. The cost per sample is about 4 * numTaps / partitionSize
+                   multiply-accumulates plus the FFTs, instead of numTaps for arm_fir_f32.
+  @par
+                   The output is that of arm_fir_f32 with the same coefficients, within
+                   the rounding of the FFTs, with no added delay: blocks are processed
+                   when complete, so pSrc and pDst must hold a multiple of partitionSize
+                   samples, and the latency of a block based system is partitionSize.
+  @par           Memory
+                   arm_fir_partitioned_filter_init_f32 computes the spectra of the
+                   partitions once, 2 * partitionSize * numPartitions floats; any number
+                   of channels (instances) filter with the same spectra. Each channel
+                   has a state of 2 * partitionSize * (numPartitions + 3) floats: the
+                   spectra of the last numPartitions input blocks, the last two input
+                   blocks and two work buffers. Nothing is allocated.
+ */
+
+/**
+  @addtogroup FIRPartitioned
+  @{
+ */
+
+/*
+ * pAcc += pX * pH for the packed spectra of arm_rfft_fast_f32 of fftLen points:
+ * the real values at 0 and fftLen / 2 first, then fftLen / 2 - 1 complex values.
+ * Restrict parameters, so that the loop vectorizes.
+ */
+__STATIC_FORCEINLINE void arm_fir_partitioned_cmac_f32(
+  const float32_t * __RESTRICT pX,
+  const float32_t * __RESTRICT pH,
+        float32_t * __RESTRICT pAcc,
+        uint32_t fftLen)
+{
+    pAcc[0] += pX[0] * pH[0];
+    pAcc[1] += pX[1] * pH[1];
+    for (uint32_t k = 2; k < fftLen; k += 2U)
+    {
+        pAcc[k]      += pX[k] * pH[k] - pX[k + 1U] * pH[k + 1U];
+        pAcc[k + 1U] += pX[k] * pH[k + 1U] + pX[k + 1U] * pH[k];
+    }
+}
+
+/**
+  @brief         Processing function for the partitioned FIR.
+  @param[in,out] S          points to an instance set up by arm_fir_partitioned_init_f32
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data, may be pSrc
+  @param[in]     blockSize  number of samples, a multiple of partitionSize
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS
+                   - \ref ARM_MATH_ARGUMENT_ERROR : blockSize not a multiple of partitionSize, nothing done
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_fir_partitioned_f32(
+        arm_fir_partitioned_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+    const arm_fir_partitioned_filter_f32 *F = S->pFilter;
+    const uint32_t B = F->partitionSize;
+    const uint32_t fftLen = 2U * B;
+    const uint32_t P = F->numPartitions;
+    float32_t *pFdl = S->pState;                /* Spectra of the last P input blocks */
+    float32_t *pIn = pFdl + P * fftLen;         /* Last two input blocks */
+    float32_t *pWork = pIn + fftLen;
+    float32_t *pAcc = pWork + fftLen;
+    uint32_t pos = S->pos;
+
+    if (blockSize % B != 0U)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (uint32_t n = 0; n < blockSize; n += B)
+    {
+        /* arm_rfft_fast_f32 modifies its input: transform a copy */
+        arm_copy_f32(pSrc + n, pIn + B, B);
+        arm_copy_f32(pIn, pWork, fftLen);
+        arm_rfft_fast_f32(&F->Srfft, pWork, pFdl + pos * fftLen, 0);
+
+        /* Partition p with the input block p blocks ago, slot pos - p of the ring */
+        arm_fill_f32(0.0f, pAcc, fftLen);
+        for (uint32_t p = 0; p <= pos; p++)
+        {
+            arm_fir_partitioned_cmac_f32(pFdl + (pos - p) * fftLen, F->pSpectra + p * fftLen, pAcc, fftLen);
+        }
+        for (uint32_t p = pos + 1U; p < P; p++)
+        {
+            arm_fir_partitioned_cmac_f32(pFdl + (P + pos - p) * fftLen, F->pSpectra + p * fftLen, pAcc, fftLen);
+        }
+
+        /* Overlap-save: the second half is the linear convolution */
+        arm_rfft_fast_f32(&F->Srfft, pAcc, pWork, 1);
+        arm_copy_f32(pWork + B, pDst + n, B);
+
+        arm_copy_f32(pIn + B, pIn, B);
+        pos = (pos + 1U == P) ? 0U : pos + 1U;
+    }
+
+    S->pos = (uint16_t)pos;
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIRPartitioned group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_partitioned_init_f32.c
+ * Description:  Initialization of the partitioned frequency-domain FIR, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIRPartitioned
+  @{
+ */
+
+/**
+  @brief         Computes the filter spectra of the partitioned FIR.
+  @param[out]    F              points to the filter structure
+  @param[in]     numTaps        number of filter coefficients, 1 to 65535 * partitionSize
+  @param[in]     pCoeffs        points to the coefficients, time reversed as for arm_fir_f32:
+                                {b[numTaps-1], ..., b[1], b[0]}
+  @param[in]     partitionSize  power of two from 16 to 2048
+  @param[out]    pSpectra       points to 2 * partitionSize * numPartitions floats,
+                                numPartitions = ceil(numTaps / partitionSize)
+  @param[in]     pScratch       points to 2 * partitionSize floats, only used here
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS
+                   - \ref ARM_MATH_ARGUMENT_ERROR : partitionSize or numTaps not supported
+
+  @par
+                   Partition p holds the taps b[p * partitionSize] to
+                   b[(p + 1) * partitionSize - 1], zero padded to 2 * partitionSize, as
+                   the packed spectrum of arm_rfft_fast_f32. The coefficients are not
+                   used after this call, the spectra are, by every channel set up with
+                   arm_fir_partitioned_init_f32 on F.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_fir_partitioned_filter_init_f32(
+        arm_fir_partitioned_filter_f32 * F,
+        uint32_t numTaps,
+  const float32_t * pCoeffs,
+        uint16_t partitionSize,
+        float32_t * pSpectra,
+        float32_t * pScratch)
+{
+    const uint32_t B = partitionSize;
+    uint32_t numPartitions;
+
+    if (B < 16U || B > 2048U || (B & (B - 1U)) != 0U || numTaps == 0U)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    numPartitions = (numTaps + B - 1U) / B;
+    if (numPartitions > UINT16_MAX
+        || arm_rfft_fast_init_f32(&F->Srfft, (uint16_t)(2U * B)) != ARM_MATH_SUCCESS)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (uint32_t p = 0; p < numPartitions; p++)
+    {
+        const uint32_t first = p * B;
+        const uint32_t len = (numTaps - first < B) ? numTaps - first : B;
+
+        for (uint32_t j = 0; j < len; j++)
+        {
+            pScratch[j] = pCoeffs[numTaps - 1U - (first + j)];
+        }
+        arm_fill_f32(0.0f, pScratch + len, 2U * B - len);
+        arm_rfft_fast_f32(&F->Srfft, pScratch, pSpectra + 2U * B * p, 0);
+    }
+
+    F->pSpectra = pSpectra;
+    F->partitionSize = partitionSize;
+    F->numPartitions = (uint16_t)numPartitions;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Initialization function for one channel of the partitioned FIR.
+  @param[out]    S        points to the instance
+  @param[in]     pFilter  points to filter spectra set up by arm_fir_partitioned_filter_init_f32
+  @param[in]     pState   points to 2 * partitionSize * (numPartitions + 3) floats
+
+  @par
+                   The state is cleared: the filter starts from zero input, as
+                   arm_fir_f32 after arm_fir_init_f32.
+ */
+ARM_DSP_ATTRIBUTE void arm_fir_partitioned_init_f32(
+        arm_fir_partitioned_instance_f32 * S,
+  const arm_fir_partitioned_filter_f32 * pFilter,
+        float32_t * pState)
+{
+    S->pFilter = pFilter;
+    S->pState = pState;
+    S->pos = 0;
+    arm_fill_f32(0.0f, pState, 2U * pFilter->partitionSize * (pFilter->numPartitions + 3U));
+}
+
+/**
+  @} end of FIRPartitioned group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_f32.c
+ * Description:  Rational polyphase resampler, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup Resample Resamplers
+
+  @par
+                   Sample rate conversion of a stream by a rational factor L / M
+                   (arm_resample_f32) or by any ratio that may change while running, to
+                   follow the drift between two clocks (arm_resample_farrow_f32).
+  @par           Rational ratio
+                   The output of arm_resample_f32 is that of arm_fir_interpolate_f32 by L
+                   with the same coefficients, keeping one output in M: output m is
+                   upsampled sample M * m. Only the kept outputs are computed, each with
+                   the numTaps / L coefficients of its phase: L / M outputs per input
+                   sample, numTaps / M multiply-accumulates, instead of numTaps plus the
+                   decimation filter when chaining arm_fir_interpolate_f32 and
+                   arm_fir_decimate_f32. One state buffer, no intermediate buffer.
+  @par
+                   The coefficients are designed as for arm_fir_interpolate_f32: a
+                   lowpass at the upsampled rate with a cutoff at the lower of the two
+                   Nyquist frequencies, pi / max(L, M), and a gain of L.
+  @par           Farrow ratio
+                   arm_resample_farrow_f32 computes output m at input time m / ratio
+                   (integer part n, fraction mu) as
+                   <pre>
+                       y[m] = sum_k mu^k sum_t c_k[t] x[n - numTaps + 1 + t]
+                   </pre>
+                   with order + 1 FIR filters c_k, time reversed as for arm_fir_f32: a
+                   filter whose taps are polynomials of the fractional delay. The
+                   position is kept in 32.32 fixed point, so that it does not drift, and
+                   arm_resample_farrow_set_ratio_f32 changes the ratio between two
+                   calls. Cubic Lagrange interpolation, delay 2 samples, is numTaps 4,
+                   order 3:
+                   <pre>
+                       c_0 = {    0,    1,    0,    0 }
+                       c_1 = { -1/3, -1/2,    1, -1/6 }
+                       c_2 = {  1/2,   -1,  1/2,    0 }
+                       c_3 = { -1/6,  1/2, -1/2,  1/6 }
+                   </pre>
+                   For a large ratio change with little aliasing, arm_resample_f32 by the
+                   nearest rational factor is followed by a Farrow resampler with a
+                   ratio close to 1.
+  @par           Streaming
+                   Both take any number of input samples per call and return the number
+                   of outputs written, blockSize * L / M or blockSize * ratio rounded
+                   either way. The input is copied into the state blockSize samples at a
+                   time, blockSize being the one given to the initialization function.
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/*
+ * Dot product of len coefficients read every stride values with len
+ * consecutive samples.
+ */
+__STATIC_FORCEINLINE float32_t arm_resample_dot_f32(
+  const float32_t * __RESTRICT pCoeffs,
+        uint32_t stride,
+  const float32_t * __RESTRICT pSamples,
+        uint32_t len)
+{
+    float32_t acc0 = 0.0f, acc1 = 0.0f;
+    uint32_t t = 0;
+
+    for (; t + 1U < len; t += 2U)
+    {
+        acc0 += pCoeffs[t * stride] * pSamples[t];
+        acc1 += pCoeffs[(t + 1U) * stride] * pSamples[t + 1U];
+    }
+    if (t < len)
+    {
+        acc0 += pCoeffs[t * stride] * pSamples[t];
+    }
+    return acc0 + acc1;
+}
+
+/**
+  @brief         Processing function for the floating-point rational polyphase resampler.
+  @param[in,out] S          points to an instance set up by arm_resample_init_f32
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data, room for
+                            floor(blockSize * L / M) + 1 values
+  @param[in]     blockSize  number of input samples, any number
+  @return        number of output samples written
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_resample_f32(
+        arm_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+    const uint32_t L = S->L;
+    const uint32_t stepInt = S->M / L;          /* Input samples from one output to the next */
+    const uint32_t stepPhase = S->M % L;        /* and phases */
+    const uint32_t P = S->phaseLength;
+    float32_t *pState = S->pState;
+    uint32_t phase = S->phase;
+    uint32_t skip = S->skip;
+    uint32_t count = 0;
+
+    while (blockSize > 0U)
+    {
+        const uint32_t len = (blockSize < S->blockSize) ? blockSize : S->blockSize;
+
+        /* The P - 1 previous samples are at the start of the state */
+        arm_copy_f32(pSrc, pState + (P - 1U), len);
+
+        /*
+         * Output at upsampled index L * q + phase, q the input skip samples into
+         * this pass: taps phase, phase + L, ... with x[q], x[q - 1], ...; time
+         * reversed, the taps of the phase start at L - 1 - phase.
+         */
+        while (skip < len)
+        {
+            pDst[count++] = arm_resample_dot_f32(S->pCoeffs + (L - 1U - phase), L, pState + skip, P);
+
+            skip += stepInt;
+            phase += stepPhase;
+            if (phase >= L)
+            {
+                phase -= L;
+                skip++;
+            }
+        }
+        skip -= len;
+
+        /* Forward copy, the ranges overlap when len < P - 1 */
+        for (uint32_t i = 0; i + 1U < P; i++)
+        {
+            pState[i] = pState[i + len];
+        }
+        pSrc += len;
+        blockSize -= len;
+    }
+
+    S->phase = (uint16_t)phase;
+    S->skip = skip;
+    return count;
+}
+
+/**
+  @} end of Resample group
+ */
@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_farrow_f32.c
+ * Description:  Farrow resampler for any ratio, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/* Dot product of len coefficients with len samples */
+__STATIC_FORCEINLINE float32_t arm_resample_farrow_dot_f32(
+  const float32_t * __RESTRICT pCoeffs,
+  const float32_t * __RESTRICT pSamples,
+        uint32_t len)
+{
+    float32_t acc0 = 0.0f, acc1 = 0.0f;
+    uint32_t t = 0;
+
+    for (; t + 1U < len; t += 2U)
+    {
+        acc0 += pCoeffs[t] * pSamples[t];
+        acc1 += pCoeffs[t + 1U] * pSamples[t + 1U];
+    }
+    if (t < len)
+    {
+        acc0 += pCoeffs[t] * pSamples[t];
+    }
+    return acc0 + acc1;
+}
+
+/**
+  @brief         Processing function for the floating-point Farrow resampler.
+  @param[in,out] S          points to an instance set up by arm_resample_farrow_init_f32
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data, room for
+                            floor(blockSize * ratio) + 1 values
+  @param[in]     blockSize  number of input samples, any number
+  @return        number of output samples written
+
+  @par
+                   (order + 1) * numTaps multiply-accumulates per output.
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_resample_farrow_f32(
+        arm_resample_farrow_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+    const uint32_t T = S->numTaps;
+    const uint64_t step = S->step;
+    float32_t *pState = S->pState;
+    uint64_t pos = S->pos;
+    uint32_t count = 0;
+
+    while (blockSize > 0U)
+    {
+        const uint32_t len = (blockSize < S->blockSize) ? blockSize : S->blockSize;
+
+        /* The T - 1 previous samples are at the start of the state */
+        arm_copy_f32(pSrc, pState + (T - 1U), len);
+
+        while ((pos >> 32) < len)
+        {
+            const float32_t *pWindow = pState + (uint32_t)(pos >> 32);
+            const float32_t mu = (float32_t)(uint32_t)pos * 2.3283064365386963e-10f;   /* 2^-32 */
+            const float32_t *pC = S->pCoeffs + (uint32_t)S->order * T;
+            float32_t acc = arm_resample_farrow_dot_f32(pC, pWindow, T);
+
+            /* Horner in mu, from the highest power */
+            for (uint32_t k = S->order; k > 0U; k--)
+            {
+                pC -= T;
+                acc = acc * mu + arm_resample_farrow_dot_f32(pC, pWindow, T);
+            }
+            pDst[count++] = acc;
+            pos += step;
+        }
+        pos -= (uint64_t)len << 32;
+
+        /* Forward copy, the ranges overlap when len < T - 1 */
+        for (uint32_t i = 0; i + 1U < T; i++)
+        {
+            pState[i] = pState[i + len];
+        }
+        pSrc += len;
+        blockSize -= len;
+    }
+
+    S->pos = pos;
+    return count;
+}
+
+/**
+  @} end of Resample group
+ */
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_init_f32.c
+ * Description:  Initialization of the rational and Farrow resamplers, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point rational polyphase resampler.
+  @param[out]    S          points to the instance
+  @param[in]     L          upsample factor, 1 or more
+  @param[in]     M          downsample factor, 1 or more
+  @param[in]     numTaps    number of coefficients, a multiple of L, up to 65535 * L
+  @param[in]     pCoeffs    points to the coefficients, time reversed as for
+                            arm_fir_interpolate_f32: {b[numTaps-1], ..., b[1], b[0]}
+  @param[in]     pState     points to numTaps / L - 1 + blockSize floats
+  @param[in]     blockSize  input samples copied into the state per pass, 1 or more
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS
+                   - \ref ARM_MATH_LENGTH_ERROR   : numTaps is not a multiple of L
+                   - \ref ARM_MATH_ARGUMENT_ERROR : L, M, numTaps or blockSize not supported
+
+  @par
+                   L and M need not be coprime, but dividing both by their greatest
+                   common divisor gives the same outputs for fewer coefficients. The
+                   state is cleared and the first output is upsampled sample 0, that of
+                   the first input sample, as for arm_fir_interpolate_f32.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_resample_init_f32(
+        arm_resample_instance_f32 * S,
+        uint16_t L,
+        uint16_t M,
+        uint32_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+    if (L == 0U || M == 0U || numTaps == 0U || blockSize == 0U)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    if (numTaps % L != 0U)
+    {
+        return ARM_MATH_LENGTH_ERROR;
+    }
+    if (numTaps / L > UINT16_MAX)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    S->L = L;
+    S->M = M;
+    S->phaseLength = (uint16_t)(numTaps / L);
+    S->phase = 0;
+    S->skip = 0;
+    S->blockSize = blockSize;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    arm_fill_f32(0.0f, pState, numTaps / L - 1U + blockSize);
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Changes the ratio of the floating-point Farrow resampler.
+  @param[in,out] S          points to the instance
+  @param[in]     ratio      output rate over input rate, from 1/65536 to 4294967296
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS
+                   - \ref ARM_MATH_ARGUMENT_ERROR : ratio out of range, nothing changed
+
+  @par
+                   Takes effect from the next output on, the position of which is kept:
+                   calling it between blocks with a ratio following a clock drift
+                   estimate changes the rate without a jump. The step 1 / ratio is
+                   rounded to 2^-32 input samples.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_resample_farrow_set_ratio_f32(
+        arm_resample_farrow_instance_f32 * S,
+        float64_t ratio)
+{
+    float64_t step;
+
+    if (!(ratio >= 1.0 / 65536.0) || ratio > 4294967296.0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* Input samples per output in 32.32 fixed point, at most 2^48 */
+    step = 4294967296.0 / ratio;
+    S->step = (uint64_t)(step + 0.5);
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Initialization function for the floating-point Farrow resampler.
+  @param[out]    S          points to the instance
+  @param[in]     numTaps    taps of each filter, 1 or more
+  @param[in]     order      degree of the polynomials in the fractional position
+  @param[in]     pCoeffs    points to (order + 1) * numTaps coefficients: the filter of
+                            mu^0, then that of mu^1, ..., each time reversed as for arm_fir_f32
+  @param[in]     ratio      output rate over input rate, from 1/65536 to 4294967296
+  @param[in]     pState     points to numTaps - 1 + blockSize floats
+  @param[in]     blockSize  input samples copied into the state per pass, 1 or more
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS
+                   - \ref ARM_MATH_ARGUMENT_ERROR : numTaps, ratio or blockSize not supported
+
+  @par
+                   The state is cleared and the first output is at input time 0, that of
+                   the first input sample, less the delay of the filters.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_resample_farrow_init_f32(
+        arm_resample_farrow_instance_f32 * S,
+        uint16_t numTaps,
+        uint16_t order,
+  const float32_t * pCoeffs,
+        float64_t ratio,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+    if (numTaps == 0U || blockSize == 0U
+        || arm_resample_farrow_set_ratio_f32(S, ratio) != ARM_MATH_SUCCESS)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    S->pos = 0;
+    S->numTaps = numTaps;
+    S->order = order;
+    S->blockSize = blockSize;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    arm_fill_f32(0.0f, pState, numTaps - 1U + blockSize);
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Resample group
+ */
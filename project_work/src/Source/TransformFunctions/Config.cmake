@@ -75,6 +75,29 @@ target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_radix8_f32.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_fast_f64.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_fast_init_f64.c)
 
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_mr_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_mr_init_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_mr_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_mr_init_f32.c)
+
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_4step_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_4step_init_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_4step_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_4step_init_f32.c)
+
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_init_tables_f32.c)
+
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_cfft_batch_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_fast_batch_f32.c)
+
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_stft_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_stft_init_f32.c)
+
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct_init_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct_q31.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_dct_init_q31.c)
+
 if ((NOT ARMAC5) AND (NOT DISABLEFLOAT16))
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_fast_f16.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_rfft_fast_init_f16.c)
@@ -119,6 +142,8 @@ endif()
 
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_mfcc_init_f32.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_mfcc_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_mfcc_stream_f32.c)
+target_sources(CMSISDSP PRIVATE TransformFunctions/arm_mfcc_stream_init_f32.c)
 
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_mfcc_init_q31.c)
 target_sources(CMSISDSP PRIVATE TransformFunctions/arm_mfcc_q31.c)
@@ -47,9 +47,28 @@
 #include "arm_rfft_fast_f64.c"
 #include "arm_rfft_fast_init_f32.c"
 #include "arm_rfft_fast_init_f64.c"
+#include "arm_cfft_mr_f32.c"
+#include "arm_cfft_mr_init_f32.c"
+#include "arm_rfft_mr_f32.c"
+#include "arm_rfft_mr_init_f32.c"
+#include "arm_cfft_4step_f32.c"
+#include "arm_cfft_4step_init_f32.c"
+#include "arm_rfft_4step_f32.c"
+#include "arm_rfft_4step_init_f32.c"
+#include "arm_cfft_init_tables_f32.c"
+#include "arm_cfft_batch_f32.c"
+#include "arm_rfft_fast_batch_f32.c"
+#include "arm_stft_f32.c"
+#include "arm_stft_init_f32.c"
+#include "arm_dct_f32.c"
+#include "arm_dct_init_f32.c"
+#include "arm_dct_q31.c"
+#include "arm_dct_init_q31.c"
 
 #include "arm_mfcc_init_f32.c"
 #include "arm_mfcc_f32.c"
+#include "arm_mfcc_stream_f32.c"
+#include "arm_mfcc_stream_init_f32.c"
 
 #include "arm_mfcc_init_q31.c"
 #include "arm_mfcc_q31.c"
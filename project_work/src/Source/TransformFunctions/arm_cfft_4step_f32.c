@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_4step_f32.c
+ * Description:  Four-step complex FFT for large lengths, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup FourStepFFTF32 Four-Step FFT F32
+
+  @par
+                   arm_cfft_f32 and arm_rfft_fast_f32 stop at 4096 points, the size of
+                   the tables in CommonTables. The four-step functions take powers of two
+                   from 256 up to 16M complex points (32M real), for offline analysis of
+                   long logs, with arm_cfft_f32 as the inner transform.
+  @par
+                   The output is in natural order and has the same scaling as
+                   arm_cfft_f32 and arm_rfft_fast_f32: the inverse transforms divide by
+                   the length. arm_rfft_4step_f32 uses the packed spectrum of
+                   arm_rfft_fast_f32.
+  @par
+                   The data is seen as a matrix of N1 rows by N2 columns. The N2 columns
+                   are transformed (length N1) and multiplied by twiddles, then the N1
+                   rows (length N2), and the result is transposed. The columns are
+                   gathered and the rows transposed by blocks of 8 (one 64 byte cache
+                   line), so every transform works on contiguous data that fits in the
+                   cache and the large arrays are streamed through a few times only.
+                   The functions are not built with ARM_MATH_NEON, whose arm_cfft_f32
+                   takes any length.
+ */
+
+/**
+  @addtogroup FourStepFFTF32
+  @{
+ */
+
+/* Columns gathered, rows transposed at a time: 8 complex values are a 64 byte line */
+#define ARM_CFFT_4STEP_BLOCK 8U
+
+/*
+ * With x[N2 * n1 + n2] and X[k1 + N1 * k2], W = exp(-2*pi*i / N):
+ *
+ *   X[k1 + N1 * k2] = sum_n2 W_N2^(n2 * k2) * W^(n2 * k1) * sum_n1 W_N1^(n1 * k1) * x[N2 * n1 + n2]
+ *
+ * Columns: the inner sums for ARM_CFFT_4STEP_BLOCK values of n2, copied to pBuf,
+ * transformed, multiplied by W^(n2 * k1) and stored back in place, at [k1][n2].
+ */
+static void arm_cfft_4step_columns_f32(
+  const arm_cfft_4step_instance_f32 * S,
+        float32_t * p,
+        float32_t * pBuf,
+        uint8_t ifftFlag)
+{
+    const uint32_t N1 = S->fftLenCol;
+    const uint32_t N2 = S->fftLenRow;
+    const uint32_t mask = N1 - 1U;
+    const float32_t *lo = S->pTwiddleLo;
+    const float32_t *hi = S->pTwiddleHi;
+    const float32_t dir = ifftFlag ? -1.0f : 1.0f;
+
+    for (uint32_t c = 0; c < N2; c += ARM_CFFT_4STEP_BLOCK)
+    {
+        for (uint32_t n1 = 0; n1 < N1; n1++)
+        {
+            const float32_t *src = p + 2U * (N2 * n1 + c);
+
+            for (uint32_t b = 0; b < ARM_CFFT_4STEP_BLOCK; b++)
+            {
+                pBuf[2U * (N1 * b + n1)]      = src[2U * b];
+                pBuf[2U * (N1 * b + n1) + 1U] = src[2U * b + 1U];
+            }
+        }
+
+        for (uint32_t b = 0; b < ARM_CFFT_4STEP_BLOCK; b++)
+        {
+            arm_cfft_f32(&S->Scol, pBuf + 2U * N1 * b, ifftFlag, 1);
+        }
+
+        for (uint32_t k1 = 0; k1 < N1; k1++)
+        {
+            float32_t *dst = p + 2U * (N2 * k1 + c);
+
+            for (uint32_t b = 0; b < ARM_CFFT_4STEP_BLOCK; b++)
+            {
+                /* W^e = W^(e mod N1) * W^(N1 * (e / N1)), e = n2 * k1 < N */
+                uint32_t e = (c + b) * k1;
+                const float32_t *wl = lo + 2U * (e & mask);
+                const float32_t *wh = hi + 2U * (e >> S->log2Col);
+                float32_t wr = wl[0] * wh[0] - wl[1] * wh[1];
+                float32_t wi = dir * (wl[0] * wh[1] + wl[1] * wh[0]);
+                float32_t xr = pBuf[2U * (N1 * b + k1)];
+                float32_t xi = pBuf[2U * (N1 * b + k1) + 1U];
+
+                /* Forward multiplies by cos - i sin, inverse by cos + i sin */
+                dst[2U * b]      = xr * wr + xi * wi;
+                dst[2U * b + 1U] = xi * wr - xr * wi;
+            }
+        }
+    }
+}
+
+/* Rows: the outer sums, in place, transposed from [k1][k2] to [k2][k1] into pOut */
+static void arm_cfft_4step_rows_f32(
+  const arm_cfft_4step_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag)
+{
+    const uint32_t N1 = S->fftLenCol;
+    const uint32_t N2 = S->fftLenRow;
+
+    for (uint32_t r = 0; r < N1; r += ARM_CFFT_4STEP_BLOCK)
+    {
+        for (uint32_t b = 0; b < ARM_CFFT_4STEP_BLOCK; b++)
+        {
+            arm_cfft_f32(&S->Srow, p + 2U * N2 * (r + b), ifftFlag, 1);
+        }
+
+        for (uint32_t k2 = 0; k2 < N2; k2++)
+        {
+            float32_t *dst = pOut + 2U * (N1 * k2 + r);
+
+            for (uint32_t b = 0; b < ARM_CFFT_4STEP_BLOCK; b++)
+            {
+                dst[2U * b]      = p[2U * (N2 * (r + b) + k2)];
+                dst[2U * b + 1U] = p[2U * (N2 * (r + b) + k2) + 1U];
+            }
+        }
+    }
+}
+
+/**
+  @brief         Processing function for the floating-point four-step complex FFT.
+  @param[in]     S         points to an instance of the four-step CFFT structure
+  @param[in]     p         points to the input, fftLen complex values (Source buffer is modified by this function.)
+  @param[out]    pOut      points to the output, fftLen complex values
+  @param[in]     ifftFlag
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+
+  @par
+                   pOut is also the working buffer of the column transforms, so no
+                   scratch buffer is needed. p and pOut must not overlap.
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_4step_f32(
+  const arm_cfft_4step_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag)
+{
+    /* Each inner arm_cfft_f32 inverse divides by its length, together by fftLen */
+    arm_cfft_4step_columns_f32(S, p, pOut, ifftFlag);
+    arm_cfft_4step_rows_f32(S, p, pOut, ifftFlag);
+}
+
+/**
+  @} end of FourStepFFTF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_4step_init_f32.c
+ * Description:  Initialization function for the four-step cfft f32 instance
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include <math.h>
+
+#if !defined(ARM_MATH_NEON)
+
+/* In double: PI from arm_math_types.h is a float */
+#define ARM_CFFT_4STEP_2PI 6.28318530717958647692
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup FourStepFFTF32
+  @{
+ */
+
+/* cos and sin of 2*pi*j*step/fftLen for j = 0 .. count-1, computed in double */
+static float32_t * arm_cfft_4step_table_f32(
+  float32_t * pDst,
+  uint32_t count,
+  uint32_t step,
+  uint32_t fftLen)
+{
+    for (uint32_t j = 0; j < count; j++)
+    {
+        double theta = ARM_CFFT_4STEP_2PI * (double)j * (double)step / (double)fftLen;
+
+        *pDst++ = (float32_t)cos(theta);
+        *pDst++ = (float32_t)sin(theta);
+    }
+    return pDst;
+}
+
+/**
+  @brief         Initialization function for the floating-point four-step complex FFT.
+  @param[out]    S         points to an instance of the four-step CFFT structure
+  @param[in]     fftLen    length of the FFT: a power of two from 256 to 16777216
+  @param[in]     pTwiddle  points to 2 * (N1 + N2) floats (at most 4 * 4096), filled here
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen is not supported
+                   - \ref ARM_MATH_LENGTH_ERROR   : ARM_FFT_RUNTIME_TABLES build, the tables pool is full
+
+  @par           Plan
+                   fftLen = N1 * N2 with N1 = 2^floor(log2(fftLen) / 2) and N2 = fftLen / N1,
+                   e.g. 1024 * 1024 for 1M points or 1024 * 2048 for 2M. Both lengths are
+                   arm_cfft_f32 lengths, 16 to 4096.
+  @par
+                   The twiddles W^e, e = 0 .. fftLen-1, are the product of two tables,
+                   W^(e mod N1) and W^(N1 * (e / N1)), so they take N1 + N2 complex values
+                   instead of fftLen. pTwiddle must stay valid while the instance is used
+                   and can be shared by instances of the same length.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_cfft_4step_init_f32(
+  arm_cfft_4step_instance_f32 * S,
+  uint32_t fftLen,
+  float32_t * pTwiddle)
+{
+    uint32_t log2Len = 0;
+    float32_t *pHi;
+    arm_status status;
+
+    if (fftLen < 256U || fftLen > 16777216U || (fftLen & (fftLen - 1U)) != 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    while ((1U << log2Len) < fftLen)
+    {
+        log2Len++;
+    }
+
+    S->fftLen = fftLen;
+    S->log2Col = (uint16_t)(log2Len / 2);
+    S->fftLenCol = (uint16_t)(1U << S->log2Col);
+    S->fftLenRow = (uint16_t)(fftLen >> S->log2Col);
+
+    /* LENGTH_ERROR with ARM_FFT_RUNTIME_TABLES and no room left in the tables pool */
+    status = arm_cfft_init_f32(&S->Scol, S->fftLenCol);
+    if (status == ARM_MATH_SUCCESS)
+    {
+        status = arm_cfft_init_f32(&S->Srow, S->fftLenRow);
+    }
+    if (status != ARM_MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    pHi = arm_cfft_4step_table_f32(pTwiddle, S->fftLenCol, 1, fftLen);
+    arm_cfft_4step_table_f32(pHi, S->fftLenRow, S->fftLenCol, fftLen);
+    S->pTwiddleLo = pTwiddle;
+    S->pTwiddleHi = pHi;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FourStepFFTF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,312 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_batch_f32.c
+ * Description:  Multi-channel complex FFT, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/basic_math_functions.h"
+
+#if !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE))
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup BatchFFTF32 Multi-Channel FFT F32
+
+  @par
+                   Transform numChannels buffers of the same length in one call, with
+                   one arm_cfft_instance_f32 or arm_rfft_fast_instance_f32 for all of
+                   them, e.g. the 8 sensor channels of a frame.
+  @par           Interleaved
+                   arm_cfft_batch_f32 and arm_rfft_fast_batch_f32 take the channels
+                   interleaved: value j of channel c is at p[j * numChannels + c], j
+                   counting the floats of the channel's single-channel buffer, so the
+                   real and imaginary parts of a complex value are numChannels apart.
+                   This is the layout of a sample frame of numChannels real values.
+                   The butterflies go over the channels in their inner loop, so a
+                   twiddle is read once for all the channels and the loop over the
+                   channels vectorizes, where numChannels calls of arm_cfft_f32 read
+                   the twiddles numChannels times. It pays from 4 channels on; with 2
+                   or 3 the loop is too short and the strided version is as fast.
+  @par
+                   The results are those of arm_cfft_f32 / arm_rfft_fast_f32 for each
+                   channel, within a few roundings: the interleaved transform is its
+                   own radix-4 algorithm. Only the twiddles of the instance are used,
+                   not its bit reversal table.
+  @par           Strided
+                   arm_cfft_batch_strided_f32 and arm_rfft_fast_batch_strided_f32
+                   take the channels one after the other, channel c at
+                   p + c * stride, and run the single-channel transform on each.
+ */
+
+/**
+  @addtogroup BatchFFTF32
+  @{
+ */
+
+/* Complex value e of the interleaved buffer: real parts of all channels, then imaginary parts */
+#define ARM_CFFT_BATCH_RE(p, e, numChannels) ((p) + 2U * (e) * (numChannels))
+
+/*
+ * The loops over the channels take their buffers as restrict parameters: the
+ * compiler then knows that they are disjoint and vectorizes the loops, which it
+ * does not from pointers computed in the loop.
+ */
+
+/*
+ * Two radix-2 decimation in frequency stages on x0..x3, numChannels values each
+ * (real parts, then imaginary parts), the values j, j+q, j+2q and j+3q of a block
+ * of L = 4 * q: with W = exp(-+2*pi*i/L),
+ *
+ *   y0 = (x0 + x2) + (x1 + x3)
+ *   y1 = ((x0 + x2) - (x1 + x3)) W^2j
+ *   y2 = ((x0 - x2) -+ i (x1 - x3)) W^j
+ *   y3 = ((x0 - x2) +- i (x1 - x3)) W^3j
+ *
+ * written back in place, so the output is in bit reversed order as with radix-2
+ * stages. pW holds cos and sin of the angles of W^j, W^2j and W^3j, sg is 1 for the
+ * forward transform and -1 for the inverse, which conjugates.
+ */
+__STATIC_FORCEINLINE void arm_cfft_batch_butterfly4_f32(
+        float32_t * __RESTRICT x0,
+        float32_t * __RESTRICT x1,
+        float32_t * __RESTRICT x2,
+        float32_t * __RESTRICT x3,
+  const float32_t * pW,
+        float32_t sg,
+        uint32_t numChannels)
+{
+    /* Imaginary parts: derived from the restrict pointers, indexed like them */
+    float32_t *y0 = x0 + numChannels;
+    float32_t *y1 = x1 + numChannels;
+    float32_t *y2 = x2 + numChannels;
+    float32_t *y3 = x3 + numChannels;
+    const float32_t c1 = pW[0], s1 = sg * pW[1];
+    const float32_t c2 = pW[2], s2 = sg * pW[3];
+    const float32_t c3 = pW[4], s3 = sg * pW[5];
+
+    for (uint32_t c = 0; c < numChannels; c++)
+    {
+        float32_t ar = x0[c] + x2[c], ai = y0[c] + y2[c];
+        float32_t br = x0[c] - x2[c], bi = y0[c] - y2[c];
+        float32_t cr = x1[c] + x3[c], ci = y1[c] + y3[c];
+        /* -+ i (x1 - x3) */
+        float32_t dr = sg * (y1[c] - y3[c]), di = sg * (x3[c] - x1[c]);
+        float32_t tr, ti;
+
+        x0[c] = ar + cr;
+        y0[c] = ai + ci;
+
+        tr = ar - cr;
+        ti = ai - ci;
+        x1[c] = tr * c2 + ti * s2;
+        y1[c] = ti * c2 - tr * s2;
+
+        tr = br + dr;
+        ti = bi + di;
+        x2[c] = tr * c1 + ti * s1;
+        y2[c] = ti * c1 - tr * s1;
+
+        tr = br - dr;
+        ti = bi - di;
+        x3[c] = tr * c3 + ti * s3;
+        y3[c] = ti * c3 - tr * s3;
+    }
+}
+
+/* Radix-2 butterfly without twiddle on x0 and x1 */
+__STATIC_FORCEINLINE void arm_cfft_batch_butterfly2_f32(
+        float32_t * __RESTRICT x0,
+        float32_t * __RESTRICT x1,
+        uint32_t numChannels)
+{
+    for (uint32_t c = 0; c < 2U * numChannels; c++)
+    {
+        float32_t t = x0[c] - x1[c];
+
+        x0[c] += x1[c];
+        x1[c] = t;
+    }
+}
+
+__STATIC_FORCEINLINE void arm_cfft_batch_swap_f32(
+        float32_t * __RESTRICT a,
+        float32_t * __RESTRICT b,
+        uint32_t numChannels)
+{
+    for (uint32_t c = 0; c < 2U * numChannels; c++)
+    {
+        float32_t t = a[c];
+
+        a[c] = b[c];
+        b[c] = t;
+    }
+}
+
+/* One radix-4 stage on blocks of L values */
+static void arm_cfft_batch_radix4_f32(
+  const float32_t * pTwiddle,
+        float32_t * p,
+        uint32_t fftLen,
+        uint32_t L,
+        uint32_t numChannels,
+        uint8_t ifftFlag)
+{
+    const uint32_t q = L / 4U;
+    const uint32_t step = fftLen / L;
+    /* Forward: W = cos - i sin and -i (x1 - x3). Inverse: conjugates. */
+    const float32_t sg = ifftFlag ? -1.0f : 1.0f;
+    float32_t w[6];
+
+    for (uint32_t j = 0; j < q; j++)
+    {
+        w[0] = pTwiddle[2U * j * step];
+        w[1] = pTwiddle[2U * j * step + 1U];
+        w[2] = pTwiddle[4U * j * step];
+        w[3] = pTwiddle[4U * j * step + 1U];
+        w[4] = pTwiddle[6U * j * step];
+        w[5] = pTwiddle[6U * j * step + 1U];
+
+        for (uint32_t base = j; base < fftLen; base += L)
+        {
+            arm_cfft_batch_butterfly4_f32(ARM_CFFT_BATCH_RE(p, base, numChannels),
+                                          ARM_CFFT_BATCH_RE(p, base + q, numChannels),
+                                          ARM_CFFT_BATCH_RE(p, base + 2U * q, numChannels),
+                                          ARM_CFFT_BATCH_RE(p, base + 3U * q, numChannels),
+                                          w, sg, numChannels);
+        }
+    }
+}
+
+/* Last stage when log2(fftLen) is odd: radix-2 butterflies on pairs, no twiddles */
+static void arm_cfft_batch_radix2_f32(
+        float32_t * p,
+        uint32_t fftLen,
+        uint32_t numChannels)
+{
+    for (uint32_t base = 0; base < fftLen; base += 2U)
+    {
+        arm_cfft_batch_butterfly2_f32(ARM_CFFT_BATCH_RE(p, base, numChannels),
+                                      ARM_CFFT_BATCH_RE(p, base + 1U, numChannels),
+                                      numChannels);
+    }
+}
+
+/* Bit reversal of the complex values, each one 2 * numChannels floats */
+static void arm_cfft_batch_bitreversal_f32(
+        float32_t * p,
+        uint32_t fftLen,
+        uint32_t numChannels)
+{
+    for (uint32_t i = 1, j = 0; i < fftLen; i++)
+    {
+        uint32_t bit = fftLen >> 1;
+
+        for (; (j & bit) != 0; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j |= bit;
+
+        if (i < j)
+        {
+            arm_cfft_batch_swap_f32(ARM_CFFT_BATCH_RE(p, i, numChannels),
+                                    ARM_CFFT_BATCH_RE(p, j, numChannels),
+                                    numChannels);
+        }
+    }
+}
+
+/**
+  @brief         Processing function for the multi-channel floating-point complex FFT, channels interleaved.
+  @param[in]     S            points to an instance of the floating-point CFFT structure
+  @param[in,out] p            points to numChannels * 2 * fftLen floats, value j of channel c at p[j * numChannels + c]
+  @param[in]     numChannels  number of channels
+  @param[in]     ifftFlag     flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+
+  @par
+                   The output is in normal order, the inverse is scaled by 1 / fftLen, as
+                   with arm_cfft_f32 and bitReverseFlag set. With one channel the layout
+                   is that of arm_cfft_f32, which is called.
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_batch_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p,
+        uint32_t numChannels,
+        uint8_t ifftFlag)
+{
+    const uint32_t fftLen = S->fftLen;
+    uint32_t L;
+
+    if (numChannels == 1U)
+    {
+        arm_cfft_f32(S, p, ifftFlag, 1);
+        return;
+    }
+
+    for (L = fftLen; L >= 4U; L /= 4U)
+    {
+        arm_cfft_batch_radix4_f32(S->pTwiddle, p, fftLen, L, numChannels, ifftFlag);
+    }
+    if (L == 2U)
+    {
+        arm_cfft_batch_radix2_f32(p, fftLen, numChannels);
+    }
+    arm_cfft_batch_bitreversal_f32(p, fftLen, numChannels);
+
+    if (ifftFlag)
+    {
+        arm_scale_f32(p, 1.0f / (float32_t)fftLen, p, 2U * fftLen * numChannels);
+    }
+}
+
+/**
+  @brief         Processing function for the multi-channel floating-point complex FFT, channels one after the other.
+  @param[in]     S            points to an instance of the floating-point CFFT structure
+  @param[in,out] p            points to the first channel, channel c at p + c * stride
+  @param[in]     numChannels  number of channels
+  @param[in]     stride       distance between the channels in floats, at least 2 * fftLen
+  @param[in]     ifftFlag     flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_batch_strided_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p,
+        uint32_t numChannels,
+        uint32_t stride,
+        uint8_t ifftFlag)
+{
+    for (uint32_t c = 0; c < numChannels; c++)
+    {
+        arm_cfft_f32(S, p + c * stride, ifftFlag, 1);
+    }
+}
+
+/**
+  @} end of BatchFFTF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE)) */
@@ -114,6 +114,14 @@ ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_##LEN##_f32(arm_cfft_instance_f32 * S
   S->last_twiddles = NULL;                                                       \
   return status;                                                                 \
 }
+#elif defined(ARM_FFT_RUNTIME_TABLES)
+
+/* No tables in CommonTables: computed at the first init of a length, see FFTTablesF32 */
+#define CFFTINIT_F32(LEN,LENTWIDDLE)                                             \
+ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_##LEN##_f32(arm_cfft_instance_f32 * S)\
+{                                                                                \
+  return arm_cfft_init_pooled_f32(S, LEN);                                       \
+}
 #else 
 
 #define FFTINIT(EXT,SIZE)                                           \
@@ -290,6 +298,9 @@ CFFTINIT_F32(16,16)
                 If you use CMSIS-DSP as a static library, and if you know the FFT sizes 
                 that you need at build time, then it is better to use the initialization
                 functions defined for each FFT size.
+  @par
+                Built with ARM_FFT_RUNTIME_TABLES, the tables are computed into the pool
+                of arm_fft_tables_pool_f32 instead, once per length.
  */
 ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_f32(
   arm_cfft_instance_f32 * S,
@@ -0,0 +1,471 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_init_tables_f32.c
+ * Description:  Run-time generated tables and plan cache for the cfft and rfft fast f32
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include <math.h>
+
+#if !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE))
+
+/* In double: PI from arm_math_types.h is a float */
+#define ARM_FFT_TABLES_2PI 6.28318530717958647692
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup FFTTablesF32 Run-Time FFT Tables F32
+
+  @par
+                   arm_cfft_f32 and arm_rfft_fast_f32 read their twiddles and bit
+                   reversal swaps from the tables of CommonTables, which hold every
+                   length from 16 to 4096. An image that links the tables object gets
+                   all of them (about 120 KB for f32), whatever length it uses.
+  @par
+                   The functions here compute the tables of one length at init
+                   instead, into caller buffers (arm_cfft_init_tables_f32,
+                   arm_rfft_fast_init_tables_f32) or into a pool given once by the
+                   application (arm_fft_tables_pool_f32). Pooled tables are kept in a
+                   plan cache keyed by transform and length: a second init of the same
+                   length, or an RFFT of twice the length of a CFFT, reuses them.
+  @par
+                   Built with ARM_FFT_RUNTIME_TABLES, the f32 tables are left out of
+                   CommonTables and arm_cfft_init_f32, arm_rfft_fast_init_f32 and their
+                   per-length variants take their tables from the pool, so
+                   arm_fft_tables_pool_f32 must be called before them. The results are
+                   those of the tables, within one float rounding of the twiddles.
+  @par
+                   The pool is not locked: initialize the instances from one task,
+                   as at startup. Not available with the Neon and Helium versions.
+ */
+
+/**
+  @addtogroup FFTTablesF32
+  @{
+ */
+
+/* Twiddles of the CFFT: cos and sin of 2*pi*k/fftLen, k = 0 .. fftLen-1 (twiddleCoef_N) */
+static void arm_cfft_tables_twiddle_f32(
+  float32_t * pTwiddle,
+  uint32_t fftLen)
+{
+    const uint32_t quarter = fftLen / 4U;
+
+    /* A quarter in double, the others by symmetry so they are exact negations */
+    for (uint32_t k = 0; k < quarter; k++)
+    {
+        double theta = ARM_FFT_TABLES_2PI * (double)k / (double)fftLen;
+        float32_t c = (float32_t)cos(theta);
+        float32_t s = (float32_t)sin(theta);
+
+        pTwiddle[2U * k]                       = c;
+        pTwiddle[2U * k + 1U]                  = s;
+        pTwiddle[2U * (k + quarter)]           = -s;
+        pTwiddle[2U * (k + quarter) + 1U]      = c;
+        pTwiddle[2U * (k + 2U * quarter)]      = -c;
+        pTwiddle[2U * (k + 2U * quarter) + 1U] = -s;
+        pTwiddle[2U * (k + 3U * quarter)]      = s;
+        pTwiddle[2U * (k + 3U * quarter) + 1U] = -c;
+    }
+}
+
+/* Twiddles of the RFFT split stage: i * exp(-2*pi*i*k/fftLen), k = 0 .. fftLen/2-1 (twiddleCoef_rfft_N) */
+static void arm_rfft_tables_twiddle_f32(
+  float32_t * pTwiddle,
+  uint32_t fftLen)
+{
+    const uint32_t quarter = fftLen / 4U;
+
+    for (uint32_t k = 0; k < quarter; k++)
+    {
+        double theta = ARM_FFT_TABLES_2PI * (double)k / (double)fftLen;
+        float32_t c = (float32_t)cos(theta);
+        float32_t s = (float32_t)sin(theta);
+
+        pTwiddle[2U * k]                  = s;
+        pTwiddle[2U * k + 1U]             = c;
+        pTwiddle[2U * (k + quarter)]      = c;
+        pTwiddle[2U * (k + quarter) + 1U] = -s;
+    }
+}
+
+/*
+ * arm_cfft_f32 does one radix-2 or radix-4 stage when fftLen is 2 or 4 times a power
+ * of 8, then radix-8 stages, so X[k] ends at (k mod R) * fftLen / R + rev8(k / R),
+ * rev8 reversing the base 8 digits. Position of X[k]:
+ */
+__STATIC_FORCEINLINE uint32_t arm_cfft_tables_position_f32(
+  uint32_t k,
+  uint32_t log2Len)
+{
+    const uint32_t radixBits = log2Len % 3U;
+    uint32_t digits = k >> radixBits;
+    uint32_t rev = 0;
+
+    for (uint32_t i = 0; i < log2Len / 3U; i++)
+    {
+        rev = (rev << 3) | (digits & 7U);
+        digits >>= 3;
+    }
+    return ((k & ((1U << radixBits) - 1U)) << (log2Len - radixBits)) + rev;
+}
+
+/*
+ * Bit reversal swaps of the CFFT (armBitRevIndexTableN). The permutation moves the
+ * index bits around, so its cycles are short: each one is walked from its smallest
+ * index, swapping q with the position of X[q]. Entries are byte offsets of complex
+ * values, as arm_bitreversal_32 reads them. Returns the table length.
+ */
+static uint16_t arm_cfft_tables_bitrev_f32(
+  uint16_t * pBitRevTable,
+  uint32_t fftLen)
+{
+    uint32_t log2Len = 0;
+    uint16_t length = 0;
+
+    while ((1U << log2Len) < fftLen)
+    {
+        log2Len++;
+    }
+
+    for (uint32_t start = 0; start < fftLen; start++)
+    {
+        uint32_t q = arm_cfft_tables_position_f32(start, log2Len);
+
+        while (q > start)
+        {
+            q = arm_cfft_tables_position_f32(q, log2Len);
+        }
+        if (q < start)
+        {
+            /* Cycle already done from a smaller index */
+            continue;
+        }
+
+        for (q = start; ; )
+        {
+            uint32_t next = arm_cfft_tables_position_f32(q, log2Len);
+
+            if (next == start)
+            {
+                break;
+            }
+            pBitRevTable[length++] = (uint16_t)(q * 8U);
+            pBitRevTable[length++] = (uint16_t)(next * 8U);
+            q = next;
+        }
+    }
+
+    return length;
+}
+
+/**
+  @brief         Initialization function for the cfft f32 function, with the tables computed here.
+  @param[out]    S             points to an instance of the floating-point CFFT structure
+  @param[in]     fftLen        fft length (number of complex samples): 16 to 4096, a power of two
+  @param[out]    pTwiddle      points to 2 * fftLen floats for the twiddles
+  @param[out]    pBitRevTable  points to 2 * fftLen values for the bit reversal swaps
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen is not supported
+
+  @par
+                   The buffers must stay valid while the instance is used. Up to 2 * fftLen
+                   values of pBitRevTable are written, S->bitRevLength are used.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_tables_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+    if (fftLen < 16U || fftLen > 4096U || (fftLen & (fftLen - 1U)) != 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    arm_cfft_tables_twiddle_f32(pTwiddle, fftLen);
+    S->fftLen = fftLen;
+    S->pTwiddle = pTwiddle;
+    S->pBitRevTable = pBitRevTable;
+    S->bitRevLength = arm_cfft_tables_bitrev_f32(pBitRevTable, fftLen);
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Initialization function for the rfft fast f32 function, with the tables computed here.
+  @param[out]    S             points to an arm_rfft_fast_instance_f32 structure
+  @param[in]     fftLen        length of the real sequence: 32 to 4096, a power of two
+  @param[out]    pTwiddle      points to 2 * fftLen floats for the twiddles
+  @param[out]    pBitRevTable  points to fftLen values for the bit reversal swaps
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen is not supported
+
+  @par
+                   The first fftLen floats of pTwiddle are the twiddles of the CFFT of
+                   fftLen / 2, the next fftLen those of the split stage.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_tables_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+    if (fftLen < 32U || fftLen > 4096U || (fftLen & (fftLen - 1U)) != 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    if (arm_cfft_init_tables_f32(&S->Sint, fftLen / 2U, pTwiddle, pBitRevTable) != ARM_MATH_SUCCESS)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    arm_rfft_tables_twiddle_f32(pTwiddle + fftLen, fftLen);
+    S->fftLenRFFT = fftLen;
+    S->pTwiddleRFFT = pTwiddle + fftLen;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/* Tables in the pool, keyed by kind and length */
+typedef struct arm_fft_tables_plan_f32
+{
+    struct arm_fft_tables_plan_f32 *pNext;
+    const float32_t *pTwiddle;
+    const uint16_t *pBitRevTable;
+    uint16_t kind;
+    uint16_t fftLen;
+    uint16_t bitRevLength;
+} arm_fft_tables_plan_f32;
+
+#define ARM_FFT_TABLES_CFFT 0U    /* twiddles and bit reversal swaps of arm_cfft_f32 */
+#define ARM_FFT_TABLES_RFFT 1U    /* twiddles of the arm_rfft_fast_f32 split stage */
+#define ARM_FFT_TABLES_ALIGN 8U
+
+static struct
+{
+    uint8_t *pFree;
+    uint8_t *pStart;
+    uint8_t *pEnd;
+    arm_fft_tables_plan_f32 *pPlans;
+} arm_fft_tables_pool;
+
+static void * arm_fft_tables_alloc_f32(
+  uint32_t size)
+{
+    uint8_t *p = arm_fft_tables_pool.pFree;
+
+    size = (size + ARM_FFT_TABLES_ALIGN - 1U) & ~(ARM_FFT_TABLES_ALIGN - 1U);
+    if (p == NULL || (uint32_t)(arm_fft_tables_pool.pEnd - p) < size)
+    {
+        return NULL;
+    }
+    arm_fft_tables_pool.pFree = p + size;
+    return p;
+}
+
+/* Finds the tables in the cache, or computes them into the pool. NULL if it is full. */
+static const arm_fft_tables_plan_f32 * arm_fft_tables_get_f32(
+  uint16_t kind,
+  uint16_t fftLen)
+{
+    uint8_t *pMark = arm_fft_tables_pool.pFree;
+    arm_fft_tables_plan_f32 *plan;
+    float32_t *pTwiddle;
+
+    for (plan = arm_fft_tables_pool.pPlans; plan != NULL; plan = plan->pNext)
+    {
+        if (plan->kind == kind && plan->fftLen == fftLen)
+        {
+            return plan;
+        }
+    }
+
+    plan = arm_fft_tables_alloc_f32(sizeof(arm_fft_tables_plan_f32));
+    pTwiddle = arm_fft_tables_alloc_f32((kind == ARM_FFT_TABLES_CFFT ? 2U : 1U) * fftLen * sizeof(float32_t));
+    if (plan == NULL || pTwiddle == NULL)
+    {
+        arm_fft_tables_pool.pFree = pMark;
+        return NULL;
+    }
+
+    plan->kind = kind;
+    plan->fftLen = fftLen;
+    plan->pTwiddle = pTwiddle;
+    plan->pBitRevTable = NULL;
+    plan->bitRevLength = 0;
+
+    if (kind == ARM_FFT_TABLES_CFFT)
+    {
+        /* Room for the longest table, then the unused part goes back to the pool */
+        uint16_t *pBitRev = arm_fft_tables_alloc_f32(2U * fftLen * sizeof(uint16_t));
+
+        if (pBitRev == NULL)
+        {
+            arm_fft_tables_pool.pFree = pMark;
+            return NULL;
+        }
+        arm_cfft_tables_twiddle_f32(pTwiddle, fftLen);
+        plan->bitRevLength = arm_cfft_tables_bitrev_f32(pBitRev, fftLen);
+        plan->pBitRevTable = pBitRev;
+        arm_fft_tables_pool.pFree = (uint8_t *)pBitRev;
+        arm_fft_tables_alloc_f32(plan->bitRevLength * sizeof(uint16_t));
+    }
+    else
+    {
+        arm_rfft_tables_twiddle_f32(pTwiddle, fftLen);
+    }
+
+    plan->pNext = arm_fft_tables_pool.pPlans;
+    arm_fft_tables_pool.pPlans = plan;
+    return plan;
+}
+
+/**
+  @brief         Gives the memory of the pooled FFT tables.
+  @param[in]     pMem     points to the pool, NULL to release it
+  @param[in]     memSize  size of the pool in bytes
+
+  @par
+                   The plan cache starts empty: instances initialized from a previous
+                   pool must not be used any more. A CFFT of fftLen takes
+                   8 * fftLen + 2 * S->bitRevLength bytes and a header of a few words,
+                   less than 12 * fftLen + 64 bytes; an RFFT of fftLen the CFFT of
+                   fftLen / 2 and 4 * fftLen bytes and a header.
+                   arm_fft_tables_pool_used_f32 gives the size actually used.
+ */
+ARM_DSP_ATTRIBUTE void arm_fft_tables_pool_f32(
+  void * pMem,
+  uint32_t memSize)
+{
+    uintptr_t start = ((uintptr_t)pMem + ARM_FFT_TABLES_ALIGN - 1U) & ~(uintptr_t)(ARM_FFT_TABLES_ALIGN - 1U);
+
+    arm_fft_tables_pool.pPlans = NULL;
+    if (pMem == NULL || start - (uintptr_t)pMem > memSize)
+    {
+        arm_fft_tables_pool.pStart = NULL;
+        arm_fft_tables_pool.pFree = NULL;
+        arm_fft_tables_pool.pEnd = NULL;
+        return;
+    }
+    arm_fft_tables_pool.pStart = (uint8_t *)start;
+    arm_fft_tables_pool.pFree = (uint8_t *)start;
+    arm_fft_tables_pool.pEnd = (uint8_t *)pMem + memSize;
+}
+
+/**
+  @brief         Size of the pool used by the cached FFT tables.
+  @return        bytes used since arm_fft_tables_pool_f32
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_fft_tables_pool_used_f32(void)
+{
+    return (uint32_t)(arm_fft_tables_pool.pFree - arm_fft_tables_pool.pStart);
+}
+
+/**
+  @brief         Initialization function for the cfft f32 function, with the tables from the pool.
+  @param[out]    S       points to an instance of the floating-point CFFT structure
+  @param[in]     fftLen  fft length (number of complex samples): 16 to 4096, a power of two
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen is not supported
+                   - \ref ARM_MATH_LENGTH_ERROR   : no pool, or not enough memory left in it
+
+  @par
+                   The tables are computed at the first init of a length and shared by
+                   the next ones, which only fill S.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_pooled_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen)
+{
+    const arm_fft_tables_plan_f32 *plan;
+
+    if (fftLen < 16U || fftLen > 4096U || (fftLen & (fftLen - 1U)) != 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    plan = arm_fft_tables_get_f32(ARM_FFT_TABLES_CFFT, fftLen);
+    if (plan == NULL)
+    {
+        return ARM_MATH_LENGTH_ERROR;
+    }
+
+    S->fftLen = fftLen;
+    S->pTwiddle = plan->pTwiddle;
+    S->pBitRevTable = plan->pBitRevTable;
+    S->bitRevLength = plan->bitRevLength;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Initialization function for the rfft fast f32 function, with the tables from the pool.
+  @param[out]    S       points to an arm_rfft_fast_instance_f32 structure
+  @param[in]     fftLen  length of the real sequence: 32 to 4096, a power of two
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen is not supported
+                   - \ref ARM_MATH_LENGTH_ERROR   : no pool, or not enough memory left in it
+
+  @par
+                   The CFFT tables of fftLen / 2 are shared with arm_cfft_init_pooled_f32.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_pooled_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen)
+{
+    const arm_fft_tables_plan_f32 *plan;
+    arm_status status;
+
+    if (fftLen < 32U || fftLen > 4096U || (fftLen & (fftLen - 1U)) != 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    status = arm_cfft_init_pooled_f32(&S->Sint, fftLen / 2U);
+    if (status != ARM_MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    plan = arm_fft_tables_get_f32(ARM_FFT_TABLES_RFFT, fftLen);
+    if (plan == NULL)
+    {
+        return ARM_MATH_LENGTH_ERROR;
+    }
+
+    S->fftLenRFFT = fftLen;
+    S->pTwiddleRFFT = plan->pTwiddle;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FFTTablesF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE)) */
@@ -0,0 +1,361 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mr_f32.c
+ * Description:  Mixed-radix (2, 3, 4, 5, 7) complex FFT, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include <string.h>
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup MixedRadixFFTF32 Mixed-Radix FFT F32
+
+  @par
+                   arm_cfft_f32 and arm_rfft_fast_f32 take powers of two up to 4096
+                   (other lengths only in the Neon version). The mixed-radix functions
+                   take any length up to 65535 whose prime factors are 2, 3, 5 and 7,
+                   e.g. acquisition frames of 3000 or 4800 samples that would otherwise
+                   be zero-padded to 4096 or 8192.
+  @par
+                   The output is in natural order and has the same scaling as
+                   arm_cfft_f32 and arm_rfft_fast_f32: the inverse transforms divide by
+                   the length. arm_rfft_mr_f32 uses the packed spectrum of
+                   arm_rfft_fast_f32.
+  @par
+                   The transform is a Stockham autosort FFT: every stage reads one
+                   buffer and writes the other, so there is no bit reversal, at the cost
+                   of a scratch buffer of the transform size. The twiddles are computed
+                   by the init function into a buffer supplied by the caller.
+ */
+
+/**
+  @addtogroup MixedRadixFFTF32
+  @{
+ */
+
+/*
+ * Stage of a Stockham decimation-in-frequency FFT. n = P * m is the length of the
+ * sub-transforms at this stage and s the number of them (s * n = fftLen). For
+ * q = 0 .. m-1 and each sub-transform k0 = 0 .. s-1:
+ *
+ *   a[k] = x[k0 + s * (q + m * k)],  k = 0 .. P-1
+ *   y[k0 + s * (P * q + j)] = w^(j * q) * sum_k a[k] * exp(-dir * 2*pi*i * j * k / P)
+ *
+ * with w = exp(-dir * 2*pi*i / n), dir = 1 forward and -1 inverse. The radix
+ * functions below compute the inner sum; the twiddle for q = 0 is 1 and skipped.
+ */
+
+/* y = b * conj-or-not(w): the table holds (cos, sin), forward multiplies by cos - i sin */
+__STATIC_FORCEINLINE void arm_cfft_mr_store_f32(
+        float32_t * y,
+        float32_t br,
+        float32_t bi,
+  const float32_t * w,
+        float32_t dir)
+{
+    float32_t wr = w[0];
+    float32_t wi = dir * w[1];
+
+    y[0] = br * wr + bi * wi;
+    y[1] = bi * wr - br * wi;
+}
+
+static void arm_cfft_mr_radix2_f32(
+  const float32_t * x,
+        float32_t * y,
+        uint32_t s,
+        uint32_t m,
+  const float32_t * tw,
+        float32_t dir)
+{
+    for (uint32_t q = 0; q < m; q++)
+    {
+        const float32_t *w = tw + 2 * q;
+
+        for (uint32_t k0 = 0; k0 < s; k0++)
+        {
+            const float32_t *a0 = x + 2 * (k0 + s * q);
+            const float32_t *a1 = a0 + 2 * s * m;
+            float32_t *y0 = y + 2 * (k0 + s * 2 * q);
+            float32_t *y1 = y0 + 2 * s;
+
+            y0[0] = a0[0] + a1[0];
+            y0[1] = a0[1] + a1[1];
+            if (q == 0)
+            {
+                y1[0] = a0[0] - a1[0];
+                y1[1] = a0[1] - a1[1];
+            }
+            else
+            {
+                arm_cfft_mr_store_f32(y1, a0[0] - a1[0], a0[1] - a1[1], w, dir);
+            }
+        }
+    }
+}
+
+static void arm_cfft_mr_radix4_f32(
+  const float32_t * x,
+        float32_t * y,
+        uint32_t s,
+        uint32_t m,
+  const float32_t * tw,
+        float32_t dir)
+{
+    for (uint32_t q = 0; q < m; q++)
+    {
+        const float32_t *w = tw + 6 * q;
+
+        for (uint32_t k0 = 0; k0 < s; k0++)
+        {
+            const float32_t *a0 = x + 2 * (k0 + s * q);
+            const float32_t *a1 = a0 + 2 * s * m;
+            const float32_t *a2 = a1 + 2 * s * m;
+            const float32_t *a3 = a2 + 2 * s * m;
+            float32_t *y0 = y + 2 * (k0 + s * 4 * q);
+            float32_t *y1 = y0 + 2 * s;
+            float32_t *y2 = y1 + 2 * s;
+            float32_t *y3 = y2 + 2 * s;
+
+            float32_t s02r = a0[0] + a2[0], s02i = a0[1] + a2[1];
+            float32_t d02r = a0[0] - a2[0], d02i = a0[1] - a2[1];
+            float32_t s13r = a1[0] + a3[0], s13i = a1[1] + a3[1];
+            /* (a1 - a3) * -i * dir */
+            float32_t d13r = dir * (a1[1] - a3[1]), d13i = dir * (a3[0] - a1[0]);
+
+            y0[0] = s02r + s13r;
+            y0[1] = s02i + s13i;
+            if (q == 0)
+            {
+                y1[0] = d02r + d13r;
+                y1[1] = d02i + d13i;
+                y2[0] = s02r - s13r;
+                y2[1] = s02i - s13i;
+                y3[0] = d02r - d13r;
+                y3[1] = d02i - d13i;
+            }
+            else
+            {
+                arm_cfft_mr_store_f32(y1, d02r + d13r, d02i + d13i, w, dir);
+                arm_cfft_mr_store_f32(y2, s02r - s13r, s02i - s13i, w + 2, dir);
+                arm_cfft_mr_store_f32(y3, d02r - d13r, d02i - d13i, w + 4, dir);
+            }
+        }
+    }
+}
+
+/*
+ * Odd radix P = 3, 5 or 7, with the symmetric form of the DFT: for k = 1 .. (P-1)/2,
+ * t[k] = a[k] + a[P-k] and u[k] = a[k] - a[P-k], then for j = 1 .. (P-1)/2
+ *
+ *   A = a[0] + sum_k t[k] cos(2*pi*j*k/P),  B = dir * sum_k u[k] sin(2*pi*j*k/P)
+ *   b[j] = A - i B,  b[P-j] = A + i B
+ *
+ * cs and sn hold cos and sin of 2*pi*r/P for r = 0 .. P-1. Inlined with a constant P
+ * so the loops unroll.
+ */
+__STATIC_FORCEINLINE void arm_cfft_mr_radix_odd_f32(
+  const float32_t * x,
+        float32_t * y,
+        uint32_t s,
+        uint32_t m,
+  const float32_t * tw,
+        float32_t dir,
+        uint32_t P,
+  const float32_t * cs,
+  const float32_t * sn)
+{
+    const uint32_t H = (P - 1) / 2;
+    float32_t sd[4];
+
+    for (uint32_t r = 0; r <= H; r++)
+    {
+        sd[r] = dir * sn[r];
+    }
+
+    for (uint32_t q = 0; q < m; q++)
+    {
+        const float32_t *w = tw + 2 * (P - 1) * q;
+
+        for (uint32_t k0 = 0; k0 < s; k0++)
+        {
+            const float32_t *a = x + 2 * (k0 + s * q);
+            float32_t *yq = y + 2 * (k0 + s * P * q);
+            float32_t tr[4], ti[4], ur[4], ui[4];
+            float32_t b0r = a[0], b0i = a[1];
+
+            for (uint32_t k = 1; k <= H; k++)
+            {
+                const float32_t *ak = a + 2 * s * m * k;
+                const float32_t *an = a + 2 * s * m * (P - k);
+
+                tr[k] = ak[0] + an[0];
+                ti[k] = ak[1] + an[1];
+                ur[k] = ak[0] - an[0];
+                ui[k] = ak[1] - an[1];
+                b0r += tr[k];
+                b0i += ti[k];
+            }
+            yq[0] = b0r;
+            yq[1] = b0i;
+
+            for (uint32_t j = 1; j <= H; j++)
+            {
+                float32_t Ar = a[0], Ai = a[1], Br = 0.0f, Bi = 0.0f;
+
+                for (uint32_t k = 1; k <= H; k++)
+                {
+                    uint32_t r = (j * k) % P;
+                    /* sin(2*pi*(P-r)/P) = -sin(2*pi*r/P), cos is symmetric */
+                    float32_t c = (r <= H) ? cs[r] : cs[P - r];
+                    float32_t v = (r <= H) ? sd[r] : -sd[P - r];
+
+                    Ar += tr[k] * c;
+                    Ai += ti[k] * c;
+                    Br += ur[k] * v;
+                    Bi += ui[k] * v;
+                }
+
+                float32_t *yj = yq + 2 * s * j;
+                float32_t *yn = yq + 2 * s * (P - j);
+
+                if (q == 0)
+                {
+                    yj[0] = Ar + Bi;
+                    yj[1] = Ai - Br;
+                    yn[0] = Ar - Bi;
+                    yn[1] = Ai + Br;
+                }
+                else
+                {
+                    arm_cfft_mr_store_f32(yj, Ar + Bi, Ai - Br, w + 2 * (j - 1), dir);
+                    arm_cfft_mr_store_f32(yn, Ar - Bi, Ai + Br, w + 2 * (P - j - 1), dir);
+                }
+            }
+        }
+    }
+}
+
+static void arm_cfft_mr_radix3_f32(const float32_t * x, float32_t * y, uint32_t s, uint32_t m,
+                                   const float32_t * tw, float32_t dir)
+{
+    static const float32_t cs[2] = { 1.0f, -0.5f };
+    static const float32_t sn[2] = { 0.0f, 0.866025403784438646764f };
+
+    arm_cfft_mr_radix_odd_f32(x, y, s, m, tw, dir, 3, cs, sn);
+}
+
+static void arm_cfft_mr_radix5_f32(const float32_t * x, float32_t * y, uint32_t s, uint32_t m,
+                                   const float32_t * tw, float32_t dir)
+{
+    static const float32_t cs[3] = { 1.0f, 0.309016994374947424102f, -0.809016994374947424102f };
+    static const float32_t sn[3] = { 0.0f, 0.951056516295153572116f, 0.587785252292473129169f };
+
+    arm_cfft_mr_radix_odd_f32(x, y, s, m, tw, dir, 5, cs, sn);
+}
+
+static void arm_cfft_mr_radix7_f32(const float32_t * x, float32_t * y, uint32_t s, uint32_t m,
+                                   const float32_t * tw, float32_t dir)
+{
+    static const float32_t cs[4] = { 1.0f, 0.623489801858733530525f, -0.222520933956314404289f,
+                                     -0.900968867902419126236f };
+    static const float32_t sn[4] = { 0.0f, 0.781831482468029808708f, 0.974927912181823607018f,
+                                     0.433883739117558120475f };
+
+    arm_cfft_mr_radix_odd_f32(x, y, s, m, tw, dir, 7, cs, sn);
+}
+
+/**
+  @brief         Processing function for the floating-point mixed-radix complex FFT.
+  @param[in]     S         points to an instance of the mixed-radix CFFT structure
+  @param[in,out] p1        points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag  flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform, scaled by 1/fftLen
+  @return        none
+
+  @par
+                   The output is in natural order, there is no bit reversal flag.
+                   The instance's scratch buffer is used, so an instance must not be
+                   used by two threads at a time.
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_mr_f32(
+  const arm_cfft_mr_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag)
+{
+    const float32_t *tw = S->pTwiddle;
+    float32_t dir = ifftFlag ? -1.0f : 1.0f;
+    float32_t *x = p1;
+    float32_t *y = S->pScratch;
+    uint32_t n = S->fftLen;
+    uint32_t s = 1;
+
+    for (uint32_t stage = 0; stage < S->numStages; stage++)
+    {
+        uint32_t P = S->radix[stage];
+        uint32_t m = n / P;
+        float32_t *t;
+
+        switch (P)
+        {
+        case 2:
+            arm_cfft_mr_radix2_f32(x, y, s, m, tw, dir);
+            break;
+        case 3:
+            arm_cfft_mr_radix3_f32(x, y, s, m, tw, dir);
+            break;
+        case 4:
+            arm_cfft_mr_radix4_f32(x, y, s, m, tw, dir);
+            break;
+        case 5:
+            arm_cfft_mr_radix5_f32(x, y, s, m, tw, dir);
+            break;
+        default:
+            arm_cfft_mr_radix7_f32(x, y, s, m, tw, dir);
+            break;
+        }
+
+        tw += 2 * (P - 1) * m;
+        n = m;
+        s *= P;
+        t = x;
+        x = y;
+        y = t;
+    }
+
+    /* With an odd number of stages the result is in the scratch buffer */
+    if (ifftFlag)
+    {
+        arm_scale_f32(x, 1.0f / (float32_t)S->fftLen, p1, 2U * S->fftLen);
+    }
+    else if (x != p1)
+    {
+        memcpy(p1, x, 2U * S->fftLen * sizeof(float32_t));
+    }
+}
+
+/**
+  @} end of MixedRadixFFTF32 group
+ */
@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mr_init_f32.c
+ * Description:  Initialization function for the mixed-radix cfft f32 instance
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include <math.h>
+
+/* In double: PI from arm_math_types.h is a float */
+#define ARM_CFFT_MR_2PI 6.28318530717958647692
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MixedRadixFFTF32
+  @{
+ */
+
+/*
+ * Twiddles of all the stages. A stage of length n and radix P, m = n / P, stores
+ * cos and sin of 2*pi*j*q/n for q = 0 .. m-1 and j = 1 .. P-1. The stage lengths
+ * shrink by their radix, so together they hold sum(n - n / P) = fftLen - 1 values.
+ */
+static void arm_cfft_mr_twiddles_f32(
+  const arm_cfft_mr_instance_f32 * S,
+        float32_t * pTwiddle)
+{
+    uint32_t n = S->fftLen;
+
+    for (uint32_t stage = 0; stage < S->numStages; stage++)
+    {
+        uint32_t P = S->radix[stage];
+        uint32_t m = n / P;
+
+        for (uint32_t q = 0; q < m; q++)
+        {
+            for (uint32_t j = 1; j < P; j++)
+            {
+                /* Computed in double: the twiddles are the accuracy floor of the transform */
+                double theta = ARM_CFFT_MR_2PI * (double)(j * q) / (double)n;
+
+                *pTwiddle++ = (float32_t)cos(theta);
+                *pTwiddle++ = (float32_t)sin(theta);
+            }
+        }
+        n = m;
+    }
+}
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix complex FFT.
+  @param[out]    S         points to an instance of the mixed-radix CFFT structure
+  @param[in]     fftLen    length of the FFT: 2 to 65535, a product of 2, 3, 5 and 7
+  @param[in]     pTwiddle  points to 2 * fftLen floats, filled here and used by every transform
+  @param[in]     pScratch  points to 2 * fftLen floats of working memory
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen has another prime factor or is below 2
+
+  @par           Plan
+                   fftLen is split into radix-4 stages first, then at most one radix-2
+                   stage, then radix-3, 5 and 7 stages. The twiddles of every stage are
+                   computed here, so there are no tables and any such length works,
+                   e.g. 3000 = 4 * 2 * 3 * 5 * 5 * 5 or 4800 = 4 * 4 * 4 * 3 * 5 * 5.
+  @par
+                   pTwiddle and pScratch must stay valid while the instance is used.
+                   Instances can share a twiddle buffer when they have the same length,
+                   but not a scratch buffer if they run concurrently.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_cfft_mr_init_f32(
+  arm_cfft_mr_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pScratch)
+{
+    static const uint8_t radices[] = { 4, 2, 3, 5, 7 };
+    uint32_t rest = fftLen;
+
+    if (fftLen < 2)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    S->fftLen = fftLen;
+    S->numStages = 0;
+    for (uint32_t r = 0; r < sizeof(radices); r++)
+    {
+        while (rest % radices[r] == 0)
+        {
+            /* 65535 needs at most 15 stages, ARM_CFFT_MR_MAX_STAGES is 16 */
+            S->radix[S->numStages++] = radices[r];
+            rest /= radices[r];
+            if (radices[r] == 2)
+            {
+                /* 2 * 2 went into a radix-4 stage */
+                break;
+            }
+        }
+    }
+    if (rest != 1)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    arm_cfft_mr_twiddles_f32(S, pTwiddle);
+    S->pTwiddle = pTwiddle;
+    S->pScratch = pScratch;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of MixedRadixFFTF32 group
+ */
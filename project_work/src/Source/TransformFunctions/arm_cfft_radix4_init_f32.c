@@ -52,6 +52,7 @@
   @return        execution status
                    - \ref ARM_MATH_SUCCESS        : Operation successful
                    - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+                   - \ref ARM_MATH_LENGTH_ERROR   : ARM_FFT_RUNTIME_TABLES build, the tables pool is full
 
   @par           Details
                    The parameter <code>ifftFlag</code> controls whether a forward or inverse transform is computed.
@@ -63,6 +64,9 @@
                    The parameter <code>fftLen</code> Specifies length of CFFT/CIFFT process. Supported FFT Lengths are 16, 64, 256, 1024.
   @par
                    This Function also initializes Twiddle factor table pointer and Bit reversal table pointer.
+  @par
+                   Built with ARM_FFT_RUNTIME_TABLES, the twiddles are those of arm_cfft_init_pooled_f32
+                   for fftLen, so arm_fft_tables_pool_f32 must be called before.
  */
 
 ARM_DSP_ATTRIBUTE arm_status arm_cfft_radix4_init_f32(
@@ -80,8 +84,10 @@ ARM_DSP_ATTRIBUTE arm_status arm_cfft_radix4_init_f32(
   /*  Initialise the FFT length */
   S->fftLen = fftLen;
 
+#if !defined(ARM_FFT_RUNTIME_TABLES)
   /*  Initialise the Twiddle coefficient pointer */
   S->pTwiddle = (float32_t *) twiddleCoef;
+#endif
 
   /*  Initialise the Flag for selection of CFFT or CIFFT */
   S->ifftFlag = ifftFlag;
@@ -151,6 +157,21 @@ ARM_DSP_ATTRIBUTE arm_status arm_cfft_radix4_init_f32(
     break;
   }
 
+#if defined(ARM_FFT_RUNTIME_TABLES)
+  /*  No twiddleCoef in CommonTables: the twiddles of fftLen itself, from the pool, every one of them */
+  if (status == ARM_MATH_SUCCESS)
+  {
+    arm_cfft_instance_f32 tables;
+
+    status = arm_cfft_init_pooled_f32(&tables, fftLen);
+    if (status == ARM_MATH_SUCCESS)
+    {
+      S->pTwiddle = (float32_t *) tables.pTwiddle;
+      S->twidCoefModifier = 1U;
+    }
+  }
+#endif
+
   
   return (status);
 }
@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dct_f32.c
+ * Description:  DCT-II, DCT-III and DCT-IV through the real FFT, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup DCTF32 DCT F32
+
+  @par
+                   Discrete cosine transforms of N = 32 to 4096 points (powers of two)
+                   in O(N log N), through arm_rfft_fast_f32 with a twiddle pass before
+                   or after it, instead of the N * N products of a DCT matrix. The
+                   transforms are not normalized:
+  @par
+                   DCT-II:  X[k] = sum(x[n] * cos(pi * (2n + 1) * k / (2N)), n = 0 .. N-1)
+  @par
+                   DCT-III: x[n] = X[0] / 2 + sum(X[k] * cos(pi * (2n + 1) * k / (2N)), k = 1 .. N-1)
+  @par
+                   DCT-IV:  X[k] = sum(x[n] * cos(pi * (2n + 1) * (2k + 1) / (4N)), n = 0 .. N-1)
+  @par
+                   so the DCT-III of the DCT-II of x is N/2 * x and the DCT-IV of the
+                   DCT-IV of x is N/2 * x. The orthonormal DCT-II scales X[0] by
+                   sqrt(1/N) and the other outputs by sqrt(2/N).
+  @par           Algorithms
+                   DCT-II (Makhoul): the even samples in order then the odd ones reversed,
+                   a real FFT of N, and X[k] = Re(V[k] * exp(-i*pi*k/(2N))); X[N-k] comes
+                   from the same V[k]. DCT-III runs these steps backwards with the
+                   inverse real FFT. DCT-IV: x[2n] + i * x[N-1-2n], twiddled, a complex FFT
+                   of N/2 (the one inside the real FFT instance), twiddled again.
+ */
+
+/**
+  @addtogroup DCTF32
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point DCT-II.
+  @param[in]     S     points to an instance of the floating-point DCT structure
+  @param[in]     pSrc  points to N input values
+  @param[out]    pDst  points to N output values, not overlapping pSrc
+  @param[in]     pTmp  points to a temporary buffer of N floats
+ */
+ARM_DSP_ATTRIBUTE void arm_dct2_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp)
+{
+    const uint32_t N = S->N;
+    const uint32_t half = N / 2U;
+    const float32_t *pW = S->pTwiddle;
+
+    /* Even samples forward, odd samples backward */
+    for (uint32_t n = 0; n < half; n++)
+    {
+        pDst[n] = pSrc[2U * n];
+        pDst[N - 1U - n] = pSrc[2U * n + 1U];
+    }
+
+    arm_rfft_fast_f32(&S->Srfft, pDst, pTmp, 0);
+
+    /* V[0] and V[N/2] are real */
+    pDst[0] = pTmp[0];
+    pDst[half] = pTmp[1] * pW[N];
+
+    for (uint32_t k = 1; k < half; k++)
+    {
+        float32_t vr = pTmp[2U * k];
+        float32_t vi = pTmp[2U * k + 1U];
+        float32_t c = pW[2U * k];
+        float32_t s = pW[2U * k + 1U];
+
+        pDst[k] = vr * c + vi * s;
+        pDst[N - k] = vr * s - vi * c;
+    }
+}
+
+/**
+  @brief         Processing function for the floating-point DCT-III, the inverse of the DCT-II up to N/2.
+  @param[in]     S     points to an instance of the floating-point DCT structure
+  @param[in]     pSrc  points to N input values
+  @param[out]    pDst  points to N output values, not overlapping pSrc
+  @param[in]     pTmp  points to a temporary buffer of N floats
+ */
+ARM_DSP_ATTRIBUTE void arm_dct3_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp)
+{
+    const uint32_t N = S->N;
+    const uint32_t half = N / 2U;
+    const float32_t *pW = S->pTwiddle;
+    /* The inverse real FFT scales by 1/N, the DCT-III of the DCT-II is N/2 */
+    const float32_t scale = 0.5f * (float32_t)N;
+
+    /* Spectrum packed as by arm_rfft_fast_f32: V[0] = X[0], V[N/2] = sqrt(2) * X[N/2] */
+    pDst[0] = scale * pSrc[0];
+    pDst[1] = scale * 2.0f * pW[N] * pSrc[half];
+
+    for (uint32_t k = 1; k < half; k++)
+    {
+        float32_t xk = pSrc[k];
+        float32_t xn = pSrc[N - k];
+        float32_t c = pW[2U * k];
+        float32_t s = pW[2U * k + 1U];
+
+        /* (X[k] - i X[N-k]) * exp(i*pi*k/(2N)) */
+        pDst[2U * k] = scale * (xk * c + xn * s);
+        pDst[2U * k + 1U] = scale * (xk * s - xn * c);
+    }
+
+    arm_rfft_fast_f32(&S->Srfft, pDst, pTmp, 1);
+
+    for (uint32_t n = 0; n < half; n++)
+    {
+        pDst[2U * n] = pTmp[n];
+        pDst[2U * n + 1U] = pTmp[N - 1U - n];
+    }
+}
+
+/**
+  @brief         Processing function for the floating-point DCT-IV, its own inverse up to N/2.
+  @param[in]     S     points to an instance of the floating-point DCT structure
+  @param[in]     pSrc  points to N input values
+  @param[out]    pDst  points to N output values, can be pSrc
+  @param[in]     pTmp  points to a temporary buffer of N floats
+ */
+ARM_DSP_ATTRIBUTE void arm_dct4_f32(
+  const arm_dct_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pTmp)
+{
+    const uint32_t N = S->N;
+    const uint32_t half = N / 2U;
+    const float32_t *pW = S->pTwiddle;
+    const float32_t *pPre = pW + 2U * N;
+
+    /* (x[2n] + i x[N-1-2n]) * exp(-i*pi*(4n+1)/(4N)) */
+    for (uint32_t n = 0; n < half; n++)
+    {
+        float32_t a = pSrc[2U * n];
+        float32_t b = pSrc[N - 1U - 2U * n];
+        float32_t c = pPre[2U * n];
+        float32_t s = pPre[2U * n + 1U];
+
+        pTmp[2U * n] = a * c + b * s;
+        pTmp[2U * n + 1U] = b * c - a * s;
+    }
+
+    arm_cfft_f32(&S->Srfft.Sint, pTmp, 0, 1);
+
+    /* V[k] * exp(-i*pi*k/N): the real part is X[2k], minus the imaginary part X[N-1-2k] */
+    for (uint32_t k = 0; k < half; k++)
+    {
+        float32_t vr = pTmp[2U * k];
+        float32_t vi = pTmp[2U * k + 1U];
+        float32_t c = pW[4U * k];
+        float32_t s = pW[4U * k + 1U];
+
+        pDst[2U * k] = vr * c + vi * s;
+        pDst[N - 1U - 2U * k] = vr * s - vi * c;
+    }
+}
+
+/**
+  @} end of DCTF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dct_init_f32.c
+ * Description:  Initialization function for the f32 DCT-II, DCT-III and DCT-IV
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include <math.h>
+
+#if !defined(ARM_MATH_NEON)
+
+/* In double: PI from arm_math_types.h is a float */
+#define ARM_DCT_PI 3.14159265358979323846
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup DCTF32
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point DCT-II, DCT-III and DCT-IV.
+  @param[out]    S         points to an instance of the floating-point DCT structure
+  @param[in]     N         length of the DCT: 32, 64, 128, 256, 512, 1024, 2048 or 4096
+  @param[in]     pTwiddle  points to 3 * N floats, filled here
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : N is not supported
+                   - \ref ARM_MATH_LENGTH_ERROR   : ARM_FFT_RUNTIME_TABLES build, the tables pool is full
+
+  @par
+                   pTwiddle holds exp(-i*pi*k/(2N)) for k = 0 .. N-1, then the DCT-IV pre-twiddles
+                   exp(-i*pi*(4n+1)/(4N)) for n = 0 .. N/2-1, computed in double. It must stay
+                   valid while the instance is used and can be shared by instances of the same length.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_dct_init_f32(
+  arm_dct_instance_f32 * S,
+  uint16_t N,
+  float32_t * pTwiddle)
+{
+    arm_status status;
+
+    if (N < 32U || N > 4096U || (N & (N - 1U)) != 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    status = arm_rfft_fast_init_f32(&S->Srfft, N);
+    if (status != ARM_MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    for (uint32_t k = 0; k < N; k++)
+    {
+        double theta = ARM_DCT_PI * (double)k / (2.0 * (double)N);
+
+        pTwiddle[2U * k] = (float32_t)cos(theta);
+        pTwiddle[2U * k + 1U] = (float32_t)sin(theta);
+    }
+    for (uint32_t n = 0; n < N / 2U; n++)
+    {
+        double theta = ARM_DCT_PI * (4.0 * (double)n + 1.0) / (4.0 * (double)N);
+
+        pTwiddle[2U * N + 2U * n] = (float32_t)cos(theta);
+        pTwiddle[2U * N + 2U * n + 1U] = (float32_t)sin(theta);
+    }
+
+    S->pTwiddle = pTwiddle;
+    S->N = N;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of DCTF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dct_init_q31.c
+ * Description:  Initialization function for the q31 DCT-II and DCT-IV
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include <math.h>
+
+#if !defined(ARM_MATH_NEON)
+
+/* In double: PI from arm_math_types.h is a float */
+#define ARM_DCT_PI 3.14159265358979323846
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup DCTQ31
+  @{
+ */
+
+/* cos or sin in q31, rounded, 1.0 saturated to 0x7FFFFFFF */
+static q31_t arm_dct_q31_value(double v)
+{
+    return (q31_t)clip_q63_to_q31((q63_t)floor(v * 2147483648.0 + 0.5));
+}
+
+/**
+  @brief         Initialization function for the Q31 DCT-II and DCT-IV.
+  @param[out]    S         points to an instance of the Q31 DCT structure
+  @param[in]     N         length of the DCT: 32, 64, 128, 256, 512, 1024, 2048 or 4096
+  @param[in]     pTwiddle  points to 3 * N values, filled here, laid out as those of arm_dct_init_f32
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : N is not supported
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_dct_init_q31(
+  arm_dct_instance_q31 * S,
+  uint16_t N,
+  q31_t * pTwiddle)
+{
+    arm_status status;
+
+    if (N < 32U || N > 4096U || (N & (N - 1U)) != 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    status = arm_rfft_init_q31(&S->Srfft, N, 0, 1);
+    if (status != ARM_MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    for (uint32_t k = 0; k < N; k++)
+    {
+        double theta = ARM_DCT_PI * (double)k / (2.0 * (double)N);
+
+        pTwiddle[2U * k] = arm_dct_q31_value(cos(theta));
+        pTwiddle[2U * k + 1U] = arm_dct_q31_value(sin(theta));
+    }
+    for (uint32_t n = 0; n < N / 2U; n++)
+    {
+        double theta = ARM_DCT_PI * (4.0 * (double)n + 1.0) / (4.0 * (double)N);
+
+        pTwiddle[2U * N + 2U * n] = arm_dct_q31_value(cos(theta));
+        pTwiddle[2U * N + 2U * n + 1U] = arm_dct_q31_value(sin(theta));
+    }
+
+    S->pTwiddle = pTwiddle;
+    S->N = N;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of DCTQ31 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
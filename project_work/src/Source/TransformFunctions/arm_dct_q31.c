@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dct_q31.c
+ * Description:  DCT-II and DCT-IV through the real FFT, Q31
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup DCTQ31 DCT Q31
+
+  @par
+                   The DCT-II and DCT-IV of \ref DCTF32 in Q31, through arm_rfft_q31 and
+                   arm_cfft_q31. As those transforms, they scale down to avoid saturation:
+                   the outputs are the DCT divided by N, in 1.31 for inputs in 1.31, so
+                   the result in the format of the FFT output tables is the DCT itself
+                   (e.g. 11.21 for N = 1024).
+ */
+
+/**
+  @addtogroup DCTQ31
+  @{
+ */
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+#define ARM_DCT_CFFT_Q31(S) (&(S)->Srfft.cfftInst)
+#else
+#define ARM_DCT_CFFT_Q31(S) ((S)->Srfft.pCfft)
+#endif
+
+/**
+  @brief         Processing function for the Q31 DCT-II.
+  @param[in]     S     points to an instance of the Q31 DCT structure
+  @param[in]     pSrc  points to N input values in 1.31
+  @param[out]    pDst  points to N output values, the DCT-II divided by N, not overlapping pSrc
+  @param[in]     pTmp  points to a temporary buffer of 2 * N values
+ */
+ARM_DSP_ATTRIBUTE void arm_dct2_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp)
+{
+    const uint32_t N = S->N;
+    const uint32_t half = N / 2U;
+    const q31_t *pW = S->pTwiddle;
+
+    /* Even samples forward, odd samples backward */
+    for (uint32_t n = 0; n < half; n++)
+    {
+        pDst[n] = pSrc[2U * n];
+        pDst[N - 1U - n] = pSrc[2U * n + 1U];
+    }
+
+    /* Full spectrum V / N, 2 * N values */
+    arm_rfft_q31(&S->Srfft, pDst, pTmp);
+
+    pDst[0] = pTmp[0];
+    pDst[half] = (q31_t)(((q63_t)pTmp[N] * pW[N]) >> 31);
+
+    for (uint32_t k = 1; k < half; k++)
+    {
+        q63_t vr = pTmp[2U * k];
+        q63_t vi = pTmp[2U * k + 1U];
+        q63_t c = pW[2U * k];
+        q63_t s = pW[2U * k + 1U];
+
+        pDst[k] = clip_q63_to_q31((vr * c + vi * s) >> 31);
+        pDst[N - k] = clip_q63_to_q31((vr * s - vi * c) >> 31);
+    }
+}
+
+/**
+  @brief         Processing function for the Q31 DCT-IV.
+  @param[in]     S     points to an instance of the Q31 DCT structure
+  @param[in]     pSrc  points to N input values in 1.31
+  @param[out]    pDst  points to N output values, the DCT-IV divided by N, can be pSrc
+  @param[in]     pTmp  points to a temporary buffer of N values
+ */
+ARM_DSP_ATTRIBUTE void arm_dct4_q31(
+  const arm_dct_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pTmp)
+{
+    const uint32_t N = S->N;
+    const uint32_t half = N / 2U;
+    const q31_t *pW = S->pTwiddle;
+    const q31_t *pPre = pW + 2U * N;
+
+    /* (x[2n] + i x[N-1-2n]) / 2 * exp(-i*pi*(4n+1)/(4N)): halved, the magnitude can reach sqrt(2) */
+    for (uint32_t n = 0; n < half; n++)
+    {
+        q63_t a = pSrc[2U * n];
+        q63_t b = pSrc[N - 1U - 2U * n];
+        q63_t c = pPre[2U * n];
+        q63_t s = pPre[2U * n + 1U];
+
+        pTmp[2U * n] = (q31_t)((a * c + b * s) >> 32);
+        pTmp[2U * n + 1U] = (q31_t)((b * c - a * s) >> 32);
+    }
+
+    /* Scaled by 1 / (N/2): V / N with the halving */
+    arm_cfft_q31(ARM_DCT_CFFT_Q31(S), pTmp, 0, 1);
+
+    for (uint32_t k = 0; k < half; k++)
+    {
+        q63_t vr = pTmp[2U * k];
+        q63_t vi = pTmp[2U * k + 1U];
+        q63_t c = pW[4U * k];
+        q63_t s = pW[4U * k + 1U];
+
+        pDst[2U * k] = clip_q63_to_q31((vr * c + vi * s) >> 31);
+        pDst[N - 1U - 2U * k] = clip_q63_to_q31((vr * s - vi * c) >> 31);
+    }
+}
+
+/**
+  @} end of DCTQ31 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
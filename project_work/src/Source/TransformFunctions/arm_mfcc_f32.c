@@ -62,6 +62,9 @@
 
                    The source buffer is modified by this function.
 
+                   After arm_mfcc_init_dct_f32, the cepstral coefficients come from
+                   arm_dct2_f32 instead of the product with the dctCoefs matrix.
+
  @par   Neon implementation
                  The Neon implementation has a different API.
                  There is an additional temporary buffer pTmp2.
@@ -165,6 +168,17 @@ ARM_DSP_ATTRIBUTE void arm_mfcc_f32(
   arm_offset_f32(pTmp,1.0e-6f,pTmp,S->nbMelFilters);
   arm_vlog_f32(pTmp,pTmp,S->nbMelFilters);
 
+#if !defined(ARM_MATH_NEON)
+  /* Fast DCT-II, scaled as the DCT matrix of the scripts.
+     The spectrum in pSrc and the second half of pTmp are no longer used */
+  if (S->dct != NULL)
+  {
+    arm_dct2_f32(S->dct, pTmp, pSrc, pTmp + S->nbMelFilters);
+    arm_scale_f32(pSrc, sqrtf(2.0f / (float32_t)S->nbMelFilters), pDst, S->nbDctOutputs);
+    return;
+  }
+#endif
+
   /* Multiply with the DCT matrix */
 
   pDctMat.numRows=S->nbDctOutputs;
@@ -48,6 +48,13 @@
 
 #include "dsp/transform_functions.h"
 
+/* No fast DCT until arm_mfcc_init_dct_f32: dctCoefs is used */
+#if !defined(ARM_MATH_NEON)
+#define MFCC_INIT_NO_DCT(S) ((S)->dct = NULL)
+#else
+#define MFCC_INIT_NO_DCT(S)
+#endif
+
 
 
 /**
@@ -113,6 +120,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_mfcc_init_f32(
  S->filterLengths=filterLengths;
  S->filterCoefs=filterCoefs;
  S->windowCoefs=windowCoefs;
+ MFCC_INIT_NO_DCT(S);
 
  #if defined(ARM_MFCC_USE_CFFT)
  status=arm_cfft_init_f32(&(S->cfft),fftLen);
@@ -146,6 +154,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_mfcc_init_##LEN##_f32(         \
  S->filterLengths=filterLengths;              \
  S->filterCoefs=filterCoefs;                  \
  S->windowCoefs=windowCoefs;                  \
+ MFCC_INIT_NO_DCT(S);                         \
                                               \
  status=arm_cfft_init_##LEN##_f32(&(S->cfft));\
                                               \
@@ -174,6 +183,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_mfcc_init_##LEN##_f32(              \
  S->filterLengths=filterLengths;                   \
  S->filterCoefs=filterCoefs;                       \
  S->windowCoefs=windowCoefs;                       \
+ MFCC_INIT_NO_DCT(S);                              \
                                                    \
  status=arm_rfft_fast_init_##LEN##_f32(&(S->rfft));\
                                                    \
@@ -413,6 +423,44 @@ MFCC_INIT_F32(2048)
  */
 MFCC_INIT_F32(4096)
 
+#if !defined(ARM_MATH_NEON)
+/**
+  @brief         Selects the fast DCT-II for the cepstral coefficients of an MFCC F32 instance
+  @param[in,out] S    points to the mfcc instance structure, initialized
+  @param[in]     dct  points to a DCT instance of nbMelFilters points, or NULL to go back to dctCoefs
+
+  @return        error status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : the DCT length is not nbMelFilters, nbDctOutputs is larger
+                                                    than nbMelFilters or nbMelFilters is larger than fftLen
+
+  @par           Description
+                   arm_mfcc_f32 then computes the DCT with arm_dct2_f32 in O(N log N)
+                   instead of the nbDctOutputs * nbMelFilters matrix product. The result
+                   is that of the DCT matrix of the Python scripts, sqrt(2 / nbMelFilters)
+                   times the DCT-II for every output, so dctCoefs is not read; with other
+                   coefficients in dctCoefs, keep the matrix product.
+
+                   nbMelFilters must be a DCT length: a power of two from 32 to 4096.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mfcc_init_dct_f32(
+  arm_mfcc_instance_f32 * S,
+  const arm_dct_instance_f32 *dct
+  )
+{
+ if (dct != NULL)
+ {
+   if ((dct->N != S->nbMelFilters) || (S->nbDctOutputs > S->nbMelFilters) || (S->nbMelFilters > S->fftLen))
+   {
+     return(ARM_MATH_ARGUMENT_ERROR);
+   }
+ }
+ S->dct=dct;
+
+ return(ARM_MATH_SUCCESS);
+}
+#endif
+
 /**
   @} end of MFCCF32 group
  */
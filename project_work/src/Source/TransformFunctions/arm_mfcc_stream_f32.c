@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_stream_f32.c
+ * Description:  Streaming MFCC over batches of frames, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/matrix_functions.h"
+#include "dsp/support_functions.h"
+
+#if !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE))
+
+/**
+  @ingroup MFCC
+ */
+
+/**
+  @defgroup MFCCStreamF32 Streaming MFCC F32
+
+  @par
+                   The MFCC of arm_mfcc_f32 on a stream: samples in blocks of any size,
+                   frames of fftLen samples every hopSize samples, the Mel filters, window
+                   and DCT of an arm_mfcc_instance_f32. The frames and their magnitude
+                   spectra come from the streaming STFT (\ref STFTF32), which windows the
+                   samples as it copies them out of its ring, so the input is not copied
+                   or modified.
+  @par
+                   The frames complete in a call are then processed together, up to
+                   maxFrames at a time: the spectra are transposed so that a bin of every
+                   frame is contiguous, and each Mel filter is a sum of rows scaled by its
+                   coefficients, a loop over the frames that vectorizes. The log is one
+                   call over the batch and the DCT matrix one matrix product. Give blocks
+                   of several hops to get several frames per batch.
+  @par
+                   The results are those of arm_mfcc_f32 on each frame within a few
+                   roundings: arm_mfcc_f32 scales the frame by its maximum before the FFT
+                   and back after, which does not change the magnitudes.
+ */
+
+/**
+  @addtogroup MFCCStreamF32
+  @{
+ */
+
+/* pDst[r] += a * pSrc[r] for the frames of the batch */
+__STATIC_FORCEINLINE void arm_mfcc_stream_axpy_f32(
+  const float32_t * __RESTRICT pSrc,
+        float32_t * __RESTRICT pDst,
+        float32_t a,
+        uint32_t numRows)
+{
+    for (uint32_t r = 0; r < numRows; r++)
+    {
+        pDst[r] += a * pSrc[r];
+    }
+}
+
+/* Mel filters, log and DCT of numRows magnitude spectra in pBatch, numRows * nbDctOutputs values into pDst */
+static void arm_mfcc_stream_batch_f32(
+  const arm_mfcc_stream_instance_f32 * S,
+        uint32_t numRows,
+        float32_t * pDst)
+{
+    const arm_mfcc_instance_f32 *pMfcc = S->pMfcc;
+    const uint32_t bins = pMfcc->fftLen / 2U + 1U;
+    const uint32_t M = pMfcc->nbMelFilters;
+    const uint32_t O = pMfcc->nbDctOutputs;
+    float32_t *pA = S->pBatch;
+    float32_t *pB = pA + S->maxFrames * S->Sstft.numChannels * bins;
+    const float32_t *coefs = pMfcc->filterCoefs;
+    arm_matrix_instance_f32 from, to, dct;
+
+    /* numRows x bins to bins x numRows */
+    arm_mat_init_f32(&from, (uint16_t)numRows, (uint16_t)bins, pA);
+    arm_mat_init_f32(&to, (uint16_t)bins, (uint16_t)numRows, pB);
+    arm_mat_trans_f32(&from, &to);
+
+    /* Mel energies, M x numRows in pA */
+    for (uint32_t i = 0; i < M; i++)
+    {
+        float32_t *pMel = pA + i * numRows;
+        const float32_t *pBin = pB + pMfcc->filterPos[i] * numRows;
+
+        arm_fill_f32(0.0f, pMel, numRows);
+        for (uint32_t j = 0; j < pMfcc->filterLengths[i]; j++)
+        {
+            arm_mfcc_stream_axpy_f32(pBin + j * numRows, pMel, coefs[j], numRows);
+        }
+        coefs += pMfcc->filterLengths[i];
+    }
+
+    arm_offset_f32(pA, 1.0e-6f, pA, M * numRows);
+    arm_vlog_f32(pA, pA, M * numRows);
+
+    if (pMfcc->dct != NULL)
+    {
+        /* One frame per row, the DCT in the STFT work frames, free between two calls of arm_stft_f32 */
+        float32_t *pWork = S->Sstft.pState + (uint32_t)S->Sstft.fftLen * S->Sstft.numChannels;
+        const float32_t scale = sqrtf(2.0f / (float32_t)M);
+
+        arm_mat_init_f32(&from, (uint16_t)M, (uint16_t)numRows, pA);
+        arm_mat_init_f32(&to, (uint16_t)numRows, (uint16_t)M, pB);
+        arm_mat_trans_f32(&from, &to);
+        for (uint32_t r = 0; r < numRows; r++)
+        {
+            arm_dct2_f32(pMfcc->dct, pB + r * M, pWork, pWork + M);
+            arm_scale_f32(pWork, scale, pDst + r * O, O);
+        }
+        return;
+    }
+
+    /* DCT matrix O x M times the Mel energies M x numRows, then one frame per row */
+    arm_mat_init_f32(&dct, (uint16_t)O, (uint16_t)M, (float32_t *)pMfcc->dctCoefs);
+    arm_mat_init_f32(&from, (uint16_t)M, (uint16_t)numRows, pA);
+    arm_mat_init_f32(&to, (uint16_t)O, (uint16_t)numRows, pB);
+    arm_mat_mult_f32(&dct, &from, &to);
+
+    arm_mat_init_f32(&from, (uint16_t)numRows, (uint16_t)O, pDst);
+    arm_mat_trans_f32(&to, &from);
+}
+
+/**
+  @brief         Processing function for the floating-point streaming MFCC.
+  @param[in,out] S          points to an instance of the streaming MFCC structure
+  @param[in]     pSrc       points to blockSize samples of each channel, interleaved:
+                            sample j of channel c at pSrc[j * numChannels + c]
+  @param[in]     blockSize  number of samples per channel, any value
+  @param[out]    pDst       points to room for blockSize / hopSize + 1 frames of
+                            numChannels * nbDctOutputs floats
+  @return        number of frames written to pDst
+
+  @par
+                   For each frame, the nbDctOutputs coefficients of each channel, the
+                   channels one after the other. The samples after the last complete
+                   frame stay in the instance for the next call.
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_mfcc_stream_f32(
+        arm_mfcc_stream_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst)
+{
+    const uint32_t C = S->Sstft.numChannels;
+    const uint32_t frameSize = C * S->pMfcc->nbDctOutputs;
+    uint32_t total = 0;
+
+    while (blockSize > 0U)
+    {
+        /* Samples that complete maxFrames frames at most */
+        uint32_t count = S->Sstft.toNext + (S->maxFrames - 1U) * S->Sstft.hopSize;
+        uint32_t frames;
+
+        count = (count < blockSize) ? count : blockSize;
+        frames = arm_stft_f32(&S->Sstft, pSrc, count, S->pBatch);
+        pSrc += count * C;
+        blockSize -= count;
+
+        if (frames > 0U)
+        {
+            arm_mfcc_stream_batch_f32(S, frames * C, pDst);
+            pDst += frames * frameSize;
+            total += frames;
+        }
+    }
+
+    return total;
+}
+
+/**
+  @} end of MFCCStreamF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE)) */
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_stream_init_f32.c
+ * Description:  Initialization function for the streaming MFCC f32 instance
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE))
+
+/**
+  @ingroup MFCC
+ */
+
+/**
+  @addtogroup MFCCStreamF32
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point streaming MFCC.
+  @param[out]    S            points to an instance of the streaming MFCC structure
+  @param[in]     pMfcc        points to an initialized MFCC instance: fftLen, window, Mel filters and DCT
+  @param[in]     hopSize      samples between the starts of two frames, 1 to fftLen
+  @param[in]     numChannels  number of interleaved channels, at least 1
+  @param[in]     maxFrames    frames processed together at most, at least 1, maxFrames * numChannels at most 65535
+  @param[in]     pState       points to 3 * fftLen * numChannels + 2 * maxFrames * numChannels * (fftLen/2 + 1) floats
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : an argument is not supported, or nbMelFilters or
+                                                    nbDctOutputs is larger than fftLen/2 + 1
+                   - \ref ARM_MATH_LENGTH_ERROR   : ARM_FFT_RUNTIME_TABLES build, the tables pool is full
+
+  @par
+                   pMfcc is used by reference: it and its arrays must stay valid while the
+                   instance is used, and arm_mfcc_init_dct_f32 on it applies to the stream too.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mfcc_stream_init_f32(
+        arm_mfcc_stream_instance_f32 * S,
+  const arm_mfcc_instance_f32 * pMfcc,
+        uint16_t hopSize,
+        uint32_t numChannels,
+        uint32_t maxFrames,
+        float32_t * pState)
+{
+    const uint32_t bins = pMfcc->fftLen / 2U + 1U;
+    arm_status status;
+
+    /* The Mel energies and the DCT outputs of a batch go in the spectrum buffers,
+       a batch is a matrix of maxFrames * numChannels rows */
+    if (maxFrames == 0U || maxFrames * numChannels > 65535U || pMfcc->fftLen > 4096U
+        || pMfcc->nbMelFilters > bins || pMfcc->nbDctOutputs > bins)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    status = arm_stft_init_f32(&S->Sstft, (uint16_t)pMfcc->fftLen, hopSize, numChannels,
+                               ARM_STFT_MAGNITUDE, pMfcc->windowCoefs, pState);
+    if (status != ARM_MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    S->pMfcc = pMfcc;
+    S->pBatch = pState + 3U * pMfcc->fftLen * numChannels;
+    S->maxFrames = maxFrames;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of MFCCStreamF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE)) */
@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_4step_f32.c
+ * Description:  Four-step real FFT for large lengths, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON)
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup FourStepFFTF32
+  @{
+ */
+
+/* cos and sin of 2*pi*k/N from the two tables, k < N/2 */
+__STATIC_FORCEINLINE void arm_rfft_4step_twiddle_f32(
+  const arm_rfft_4step_instance_f32 * S,
+        uint32_t k,
+        float32_t * c,
+        float32_t * sn)
+{
+    const float32_t *wl = S->pTwiddleLo + 2U * (k & (S->Sint.fftLenCol - 1U));
+    const float32_t *wh = S->pTwiddleHi + 2U * (k >> S->Sint.log2Col);
+
+    *c = wl[0] * wh[0] - wl[1] * wh[1];
+    *sn = wl[0] * wh[1] + wl[1] * wh[0];
+}
+
+/*
+ * The split of arm_rfft_mr_f32, in place: X[k] and X[N/2-k] both need Z[k] and
+ * Z[N/2-k], so they are computed together, and W^(N/2-k) = -conj(W^k).
+ */
+__STATIC_FORCEINLINE void arm_rfft_4step_split_one_f32(
+  const float32_t * zk,
+  const float32_t * zc,
+        float32_t c,
+        float32_t sn,
+        float32_t * pOut)
+{
+    float32_t evr = 0.5f * (zk[0] + zc[0]);
+    float32_t evi = 0.5f * (zk[1] - zc[1]);
+    float32_t odr = 0.5f * (zk[1] + zc[1]);
+    float32_t odi = -0.5f * (zk[0] - zc[0]);
+
+    pOut[0] = evr + odr * c + odi * sn;
+    pOut[1] = evi + odi * c - odr * sn;
+}
+
+static void arm_rfft_4step_split_f32(
+  const arm_rfft_4step_instance_f32 * S,
+        float32_t * p)
+{
+    const uint32_t half = S->fftLenRFFT / 2U;
+    float32_t z0 = p[0];
+
+    p[0] = z0 + p[1];
+    p[1] = z0 - p[1];
+
+    for (uint32_t k = 1; k <= half / 2U; k++)
+    {
+        float32_t *xk = p + 2U * k;
+        float32_t *xc = p + 2U * (half - k);
+        float32_t zk[2] = { xk[0], xk[1] };
+        float32_t zc[2] = { xc[0], xc[1] };
+        float32_t c, sn;
+
+        arm_rfft_4step_twiddle_f32(S, k, &c, &sn);
+        arm_rfft_4step_split_one_f32(zk, zc, c, sn, xk);
+        if (xc != xk)
+        {
+            arm_rfft_4step_split_one_f32(zc, zk, -c, sn, xc);
+        }
+    }
+}
+
+/* Inverse of the split, in place the same way */
+__STATIC_FORCEINLINE void arm_rfft_4step_merge_one_f32(
+  const float32_t * xk,
+  const float32_t * xc,
+        float32_t c,
+        float32_t sn,
+        float32_t * pZ)
+{
+    float32_t evr = 0.5f * (xk[0] + xc[0]);
+    float32_t evi = 0.5f * (xk[1] - xc[1]);
+    float32_t dr = 0.5f * (xk[0] - xc[0]);
+    float32_t di = 0.5f * (xk[1] + xc[1]);
+    float32_t odr = dr * c - di * sn;
+    float32_t odi = dr * sn + di * c;
+
+    pZ[0] = evr - odi;
+    pZ[1] = evi + odr;
+}
+
+static void arm_rfft_4step_merge_f32(
+  const arm_rfft_4step_instance_f32 * S,
+        float32_t * p)
+{
+    const uint32_t half = S->fftLenRFFT / 2U;
+    float32_t x0 = p[0];
+
+    p[0] = 0.5f * (x0 + p[1]);
+    p[1] = 0.5f * (x0 - p[1]);
+
+    for (uint32_t k = 1; k <= half / 2U; k++)
+    {
+        float32_t *zk = p + 2U * k;
+        float32_t *zc = p + 2U * (half - k);
+        float32_t xk[2] = { zk[0], zk[1] };
+        float32_t xc[2] = { zc[0], zc[1] };
+        float32_t c, sn;
+
+        arm_rfft_4step_twiddle_f32(S, k, &c, &sn);
+        arm_rfft_4step_merge_one_f32(xk, xc, c, sn, zk);
+        if (zc != zk)
+        {
+            arm_rfft_4step_merge_one_f32(xc, xk, -c, sn, zc);
+        }
+    }
+}
+
+/**
+  @brief         Processing function for the floating-point four-step real FFT.
+  @param[in]     S         points to an arm_rfft_4step_instance_f32 structure
+  @param[in]     p         points to input buffer (Source buffer is modified by this function.)
+  @param[out]    pOut      points to output buffer
+  @param[in]     ifftFlag
+                   - value = 0: RFFT, fftLen real values in p, packed spectrum in pOut
+                   - value = 1: RIFFT, packed spectrum in p, fftLen real values in pOut
+
+  @par
+                   The packed spectrum is the one of arm_rfft_fast_f32. The RIFFT is
+                   scaled by 1/fftLen. p and pOut must not overlap.
+ */
+ARM_DSP_ATTRIBUTE void arm_rfft_4step_f32(
+  const arm_rfft_4step_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag)
+{
+    if (ifftFlag)
+    {
+        arm_rfft_4step_merge_f32(S, p);
+        arm_cfft_4step_f32(&S->Sint, p, pOut, 1);
+    }
+    else
+    {
+        arm_cfft_4step_f32(&S->Sint, p, pOut, 0);
+        arm_rfft_4step_split_f32(S, pOut);
+    }
+}
+
+/**
+  @} end of FourStepFFTF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
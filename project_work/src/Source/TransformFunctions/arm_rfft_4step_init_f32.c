@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_4step_init_f32.c
+ * Description:  Initialization function for the four-step rfft f32 instance
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include <math.h>
+
+#if !defined(ARM_MATH_NEON)
+
+/* In double: PI from arm_math_types.h is a float */
+#define ARM_RFFT_4STEP_2PI 6.28318530717958647692
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup FourStepFFTF32
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point four-step real FFT.
+  @param[out]    S         points to an arm_rfft_4step_instance_f32 structure
+  @param[in]     fftLen    length of the real sequence: a power of two from 512 to 33554432
+  @param[in]     pTwiddle  points to 4 * (N1 + N2) floats (at most 8 * 4096), filled here
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen is not supported
+                   - \ref ARM_MATH_LENGTH_ERROR   : ARM_FFT_RUNTIME_TABLES build, the tables pool is full
+
+  @par
+                   The transform is a four-step CFFT of fftLen / 2 = N1 * N2 and a split
+                   stage, as in arm_rfft_fast_f32. The first 2 * (N1 + N2) floats of
+                   pTwiddle are the CFFT's twiddles, the next the split stage's, as the
+                   product of two tables of N1 and N2 values again.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_rfft_4step_init_f32(
+  arm_rfft_4step_instance_f32 * S,
+  uint32_t fftLen,
+  float32_t * pTwiddle)
+{
+    arm_status status;
+    float32_t *w;
+    uint32_t N1;
+    uint32_t N2;
+
+    if ((fftLen % 2U) != 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    status = arm_cfft_4step_init_f32(&S->Sint, fftLen / 2U, pTwiddle);
+    if (status != ARM_MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    N1 = S->Sint.fftLenCol;
+    N2 = S->Sint.fftLenRow;
+    w = pTwiddle + 2U * (N1 + N2);
+
+    S->fftLenRFFT = fftLen;
+    S->pTwiddleLo = w;
+    S->pTwiddleHi = w + 2U * N1;
+
+    /* cos and sin of 2*pi*k/fftLen, k = j for the first table and N1 * j for the second */
+    for (uint32_t j = 0; j < N1 + N2; j++)
+    {
+        double k = (j < N1) ? (double)j : (double)N1 * (double)(j - N1);
+        double theta = ARM_RFFT_4STEP_2PI * k / (double)fftLen;
+
+        w[2U * j] = (float32_t)cos(theta);
+        w[2U * j + 1U] = (float32_t)sin(theta);
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FourStepFFTF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) */
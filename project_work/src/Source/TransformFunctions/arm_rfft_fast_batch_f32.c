@@ -0,0 +1,210 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_batch_f32.c
+ * Description:  Multi-channel real FFT, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+#if !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE))
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup BatchFFTF32
+  @{
+ */
+
+/*
+ * Split stage of arm_rfft_fast_f32 (stage_rfft_f32) for one k on every channel:
+ * A = Z[k] and B = Z[N/2-k] of the complex FFT of the sample pairs, numChannels
+ * real parts then numChannels imaginary parts each, as in arm_cfft_batch_f32.
+ * Restrict parameters, so that the loop over the channels vectorizes.
+ */
+__STATIC_FORCEINLINE void arm_rfft_fast_batch_split_f32(
+  const float32_t * __RESTRICT pA,
+  const float32_t * __RESTRICT pB,
+        float32_t * __RESTRICT pOut,
+        float32_t twR,
+        float32_t twI,
+        uint32_t numChannels)
+{
+    const float32_t *pAI = pA + numChannels;
+    const float32_t *pBI = pB + numChannels;
+    float32_t *pOutI = pOut + numChannels;
+
+    for (uint32_t c = 0; c < numChannels; c++)
+    {
+        float32_t t1a = pB[c] - pA[c];
+        float32_t t1b = pBI[c] + pAI[c];
+
+        pOut[c]  = 0.5f * (pA[c] + pB[c] + twR * t1a + twI * t1b);
+        pOutI[c] = 0.5f * (pAI[c] - pBI[c] + twI * t1a - twR * t1b);
+    }
+}
+
+/* Merge stage of arm_rfft_fast_f32 (merge_rfft_f32) for one k, before the inverse complex FFT */
+__STATIC_FORCEINLINE void arm_rfft_fast_batch_join_f32(
+  const float32_t * __RESTRICT pA,
+  const float32_t * __RESTRICT pB,
+        float32_t * __RESTRICT pOut,
+        float32_t twR,
+        float32_t twI,
+        uint32_t numChannels)
+{
+    const float32_t *pAI = pA + numChannels;
+    const float32_t *pBI = pB + numChannels;
+    float32_t *pOutI = pOut + numChannels;
+
+    for (uint32_t c = 0; c < numChannels; c++)
+    {
+        float32_t t1a = pA[c] - pB[c];
+        float32_t t1b = pAI[c] + pBI[c];
+
+        pOut[c]  = 0.5f * (pA[c] + pB[c] - twR * t1a - twI * t1b);
+        pOutI[c] = 0.5f * (pAI[c] - pBI[c] + twI * t1a - twR * t1b);
+    }
+}
+
+static void arm_rfft_fast_batch_stage_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  const float32_t * p,
+        float32_t * pOut,
+        uint32_t numChannels)
+{
+    const uint32_t half = S->Sint.fftLen;
+    const uint32_t C = numChannels;
+
+    /* X[0] and X[N/2], both real, packed into the first complex value */
+    for (uint32_t c = 0; c < C; c++)
+    {
+        float32_t xr = p[c];
+        float32_t xi = p[C + c];
+
+        pOut[c]     = xr + xi;
+        pOut[C + c] = xr - xi;
+    }
+
+    for (uint32_t k = 1; k < half; k++)
+    {
+        arm_rfft_fast_batch_split_f32(p + 2U * k * C, p + 2U * (half - k) * C, pOut + 2U * k * C,
+                                      S->pTwiddleRFFT[2U * k], S->pTwiddleRFFT[2U * k + 1U], C);
+    }
+}
+
+static void arm_rfft_fast_batch_merge_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  const float32_t * p,
+        float32_t * pOut,
+        uint32_t numChannels)
+{
+    const uint32_t half = S->Sint.fftLen;
+    const uint32_t C = numChannels;
+
+    for (uint32_t c = 0; c < C; c++)
+    {
+        float32_t xr = p[c];
+        float32_t xi = p[C + c];
+
+        pOut[c]     = 0.5f * (xr + xi);
+        pOut[C + c] = 0.5f * (xr - xi);
+    }
+
+    for (uint32_t k = 1; k < half; k++)
+    {
+        arm_rfft_fast_batch_join_f32(p + 2U * k * C, p + 2U * (half - k) * C, pOut + 2U * k * C,
+                                     S->pTwiddleRFFT[2U * k], S->pTwiddleRFFT[2U * k + 1U], C);
+    }
+}
+
+/**
+  @brief         Processing function for the multi-channel floating-point real FFT, channels interleaved.
+  @param[in]     S            points to an arm_rfft_fast_instance_f32 structure
+  @param[in]     p            points to numChannels * fftLen floats, value j of channel c at p[j * numChannels + c]
+                              (Source buffer is modified by this function.)
+  @param[out]    pOut         points to numChannels * fftLen floats, same layout
+  @param[in]     numChannels  number of channels
+  @param[in]     ifftFlag
+                   - value = 0: RFFT, real samples in p, packed spectra of arm_rfft_fast_f32 in pOut
+                   - value = 1: RIFFT, packed spectra in p, real samples in pOut
+
+  @par
+                   With one channel the layout is that of arm_rfft_fast_f32, which is called.
+ */
+ARM_DSP_ATTRIBUTE void arm_rfft_fast_batch_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint32_t numChannels,
+        uint8_t ifftFlag)
+{
+    if (numChannels == 1U)
+    {
+        arm_rfft_fast_f32(S, p, pOut, ifftFlag);
+        return;
+    }
+
+    /* Real samples 2n and 2n+1 of a channel are numChannels apart: the real and
+       imaginary parts of complex value n in the layout of arm_cfft_batch_f32 */
+    if (ifftFlag)
+    {
+        arm_rfft_fast_batch_merge_f32(S, p, pOut, numChannels);
+        arm_cfft_batch_f32(&S->Sint, pOut, numChannels, 1);
+    }
+    else
+    {
+        arm_cfft_batch_f32(&S->Sint, p, numChannels, 0);
+        arm_rfft_fast_batch_stage_f32(S, p, pOut, numChannels);
+    }
+}
+
+/**
+  @brief         Processing function for the multi-channel floating-point real FFT, channels one after the other.
+  @param[in]     S            points to an arm_rfft_fast_instance_f32 structure
+  @param[in]     p            points to the first input channel, channel c at p + c * stride
+                              (Source buffer is modified by this function.)
+  @param[out]    pOut         points to the first output channel, channel c at pOut + c * stride
+  @param[in]     numChannels  number of channels
+  @param[in]     stride       distance between the channels in floats, at least fftLen
+  @param[in]     ifftFlag
+                   - value = 0: RFFT
+                   - value = 1: RIFFT
+ */
+ARM_DSP_ATTRIBUTE void arm_rfft_fast_batch_strided_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint32_t numChannels,
+        uint32_t stride,
+        uint8_t ifftFlag)
+{
+    for (uint32_t c = 0; c < numChannels; c++)
+    {
+        arm_rfft_fast_f32(S, p + c * stride, pOut + c * stride, ifftFlag);
+    }
+}
+
+/**
+  @} end of BatchFFTF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE)) */
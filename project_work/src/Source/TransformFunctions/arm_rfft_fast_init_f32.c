@@ -76,9 +76,19 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_##LEN##_f32( arm_rfft_fast_insta
   return ARM_MATH_SUCCESS;                                                                   \
 }
 
+#elif defined(ARM_FFT_RUNTIME_TABLES)
+
+/* No tables in CommonTables: computed at the first init of a length, see FFTTablesF32 */
+#define FAST_INIT_FUNC(LEN)                                                                  \
+ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_##LEN##_f32( arm_rfft_fast_instance_f32 * S )\
+{                                                                                            \
+  if( !S ) return ARM_MATH_ARGUMENT_ERROR;                                                   \
+                                                                                             \
+  return arm_rfft_fast_init_pooled_f32(S, LEN);                                              \
+}
 #endif 
 
-#if defined(ARM_MATH_NEON) 
+#if defined(ARM_MATH_NEON) || defined(ARM_FFT_RUNTIME_TABLES)
 
 FAST_INIT_FUNC(32)
 
@@ -108,7 +118,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_32_f32( arm_rfft_fast_instance_f
                    - \ref ARM_MATH_SUCCESS        : Operation successful
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
-#if defined(ARM_MATH_NEON) 
+#if defined(ARM_MATH_NEON) || defined(ARM_FFT_RUNTIME_TABLES)
 FAST_INIT_FUNC(64)
 #else
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_64_f32( arm_rfft_fast_instance_f32 * S ) {
@@ -138,7 +148,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_64_f32( arm_rfft_fast_instance_f
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
 
-#if defined(ARM_MATH_NEON) 
+#if defined(ARM_MATH_NEON) || defined(ARM_FFT_RUNTIME_TABLES)
 FAST_INIT_FUNC(128)
 #else
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_128_f32( arm_rfft_fast_instance_f32 * S ) {
@@ -167,7 +177,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_128_f32( arm_rfft_fast_instance_
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
 */
 
-#if defined(ARM_MATH_NEON) 
+#if defined(ARM_MATH_NEON) || defined(ARM_FFT_RUNTIME_TABLES)
 FAST_INIT_FUNC(256)
 #else
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_256_f32( arm_rfft_fast_instance_f32 * S ) {
@@ -196,7 +206,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_256_f32( arm_rfft_fast_instance_
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
 
-#if defined(ARM_MATH_NEON) 
+#if defined(ARM_MATH_NEON) || defined(ARM_FFT_RUNTIME_TABLES)
 FAST_INIT_FUNC(512)
 #else
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_512_f32( arm_rfft_fast_instance_f32 * S ) {
@@ -225,7 +235,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_512_f32( arm_rfft_fast_instance_
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
 
-#if defined(ARM_MATH_NEON) 
+#if defined(ARM_MATH_NEON) || defined(ARM_FFT_RUNTIME_TABLES)
 FAST_INIT_FUNC(1024)
 #else
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_1024_f32( arm_rfft_fast_instance_f32 * S ) {
@@ -253,7 +263,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_1024_f32( arm_rfft_fast_instance
                    - \ref ARM_MATH_SUCCESS        : Operation successful
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
-#if defined(ARM_MATH_NEON) 
+#if defined(ARM_MATH_NEON) || defined(ARM_FFT_RUNTIME_TABLES)
 FAST_INIT_FUNC(2048)
 #else
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_2048_f32( arm_rfft_fast_instance_f32 * S ) {
@@ -282,7 +292,7 @@ ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_2048_f32( arm_rfft_fast_instance
                    - \ref ARM_MATH_ARGUMENT_ERROR : an error is detected
  */
 
-#if defined(ARM_MATH_NEON) 
+#if defined(ARM_MATH_NEON) || defined(ARM_FFT_RUNTIME_TABLES)
 FAST_INIT_FUNC(4096)
 #else
 ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_4096_f32( arm_rfft_fast_instance_f32 * S ) {
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mr_f32.c
+ * Description:  Mixed-radix real FFT, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MixedRadixFFTF32
+  @{
+ */
+
+/*
+ * The real sequence x of length N is transformed as the complex sequence
+ * z[n] = x[2n] + i x[2n+1] of length N/2: with Z = FFT(z) and W = exp(-2*pi*i/N),
+ *
+ *   X[k] = (Z[k] + conj(Z[N/2-k])) / 2 - i W^k (Z[k] - conj(Z[N/2-k])) / 2
+ *
+ * The twiddle table holds cos and sin of 2*pi*k/N for k = 0 .. N/2-1.
+ */
+static void arm_rfft_mr_split_f32(
+  const arm_rfft_mr_instance_f32 * S,
+  const float32_t * pZ,
+        float32_t * pOut)
+{
+    const uint32_t half = S->fftLenRFFT / 2;
+    const float32_t *w = S->pTwiddleRFFT;
+
+    /* X[0] and X[N/2] are real, packed into the first complex value */
+    pOut[0] = pZ[0] + pZ[1];
+    pOut[1] = pZ[0] - pZ[1];
+
+    for (uint32_t k = 1; k < half; k++)
+    {
+        const float32_t *zk = pZ + 2 * k;
+        const float32_t *zc = pZ + 2 * (half - k);
+        float32_t c = w[2 * k];
+        float32_t sn = w[2 * k + 1];
+
+        /* Even part, and the odd part before the twiddle: -i (Z[k] - conj(Z[N/2-k])) / 2 */
+        float32_t evr = 0.5f * (zk[0] + zc[0]);
+        float32_t evi = 0.5f * (zk[1] - zc[1]);
+        float32_t odr = 0.5f * (zk[1] + zc[1]);
+        float32_t odi = -0.5f * (zk[0] - zc[0]);
+
+        pOut[2 * k]     = evr + odr * c + odi * sn;
+        pOut[2 * k + 1] = evi + odi * c - odr * sn;
+    }
+}
+
+/* Inverse of the split: Z[k] = E[k] + i O[k] from the packed spectrum */
+static void arm_rfft_mr_merge_f32(
+  const arm_rfft_mr_instance_f32 * S,
+  const float32_t * pIn,
+        float32_t * pZ)
+{
+    const uint32_t half = S->fftLenRFFT / 2;
+    const float32_t *w = S->pTwiddleRFFT;
+
+    pZ[0] = 0.5f * (pIn[0] + pIn[1]);
+    pZ[1] = 0.5f * (pIn[0] - pIn[1]);
+
+    for (uint32_t k = 1; k < half; k++)
+    {
+        const float32_t *xk = pIn + 2 * k;
+        const float32_t *xc = pIn + 2 * (half - k);
+        float32_t c = w[2 * k];
+        float32_t sn = w[2 * k + 1];
+
+        /* E = (X[k] + conj(X[N/2-k])) / 2, O = (X[k] - conj(X[N/2-k])) conj(W^k) / 2 */
+        float32_t evr = 0.5f * (xk[0] + xc[0]);
+        float32_t evi = 0.5f * (xk[1] - xc[1]);
+        float32_t dr = 0.5f * (xk[0] - xc[0]);
+        float32_t di = 0.5f * (xk[1] + xc[1]);
+        float32_t odr = dr * c - di * sn;
+        float32_t odi = dr * sn + di * c;
+
+        pZ[2 * k]     = evr - odi;
+        pZ[2 * k + 1] = evi + odr;
+    }
+}
+
+/**
+  @brief         Processing function for the floating-point mixed-radix real FFT.
+  @param[in]     S         points to an arm_rfft_mr_instance_f32 structure
+  @param[in]     p         points to input buffer (Source buffer is modified by this function.)
+  @param[in]     pOut      points to output buffer
+  @param[in]     ifftFlag
+                   - value = 0: RFFT, fftLen real values in p, packed spectrum in pOut
+                   - value = 1: RIFFT, packed spectrum in p, fftLen real values in pOut
+
+  @par
+                   The packed spectrum is the one of arm_rfft_fast_f32: X[0] and
+                   X[fftLen/2], both real, in the first two values, then X[1] to
+                   X[fftLen/2 - 1] as complex values. The RIFFT is scaled by 1/fftLen.
+ */
+ARM_DSP_ATTRIBUTE void arm_rfft_mr_f32(
+  const arm_rfft_mr_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag)
+{
+    if (ifftFlag)
+    {
+        arm_rfft_mr_merge_f32(S, p, pOut);
+        arm_cfft_mr_f32(&S->Sint, pOut, 1);
+    }
+    else
+    {
+        arm_cfft_mr_f32(&S->Sint, p, 0);
+        arm_rfft_mr_split_f32(S, p, pOut);
+    }
+}
+
+/**
+  @} end of MixedRadixFFTF32 group
+ */
@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mr_init_f32.c
+ * Description:  Initialization function for the mixed-radix rfft f32 instance
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include <math.h>
+
+/* In double: PI from arm_math_types.h is a float */
+#define ARM_RFFT_MR_2PI 6.28318530717958647692
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MixedRadixFFTF32
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix real FFT.
+  @param[out]    S         points to an arm_rfft_mr_instance_f32 structure
+  @param[in]     fftLen    length of the real sequence: even, 4 to 65534, fftLen / 2 a product of 2, 3, 5 and 7
+  @param[in]     pTwiddle  points to 2 * fftLen floats, filled here and used by every transform
+  @param[in]     pScratch  points to fftLen floats of working memory
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen is not supported
+
+  @par
+                   The transform is a mixed-radix CFFT of fftLen / 2 and a split stage,
+                   as in arm_rfft_fast_f32. The first fftLen floats of pTwiddle are the
+                   CFFT's twiddles, the next fftLen the split stage's.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_rfft_mr_init_f32(
+  arm_rfft_mr_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pScratch)
+{
+    arm_status status;
+    float32_t *w = pTwiddle + fftLen;
+
+    if ((fftLen % 2) != 0)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    status = arm_cfft_mr_init_f32(&S->Sint, fftLen / 2, pTwiddle, pScratch);
+    if (status != ARM_MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    S->fftLenRFFT = fftLen;
+    for (uint32_t k = 0; k < fftLen / 2U; k++)
+    {
+        double theta = ARM_RFFT_MR_2PI * (double)k / (double)fftLen;
+
+        w[2 * k] = (float32_t)cos(theta);
+        w[2 * k + 1] = (float32_t)sin(theta);
+    }
+    S->pTwiddleRFFT = w;
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of MixedRadixFFTF32 group
+ */
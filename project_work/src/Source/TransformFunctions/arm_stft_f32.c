@@ -0,0 +1,258 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_f32.c
+ * Description:  Streaming short-time Fourier transform, floating point
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/complex_math_functions.h"
+#include "dsp/fast_math_functions.h"
+#include <string.h>
+
+#if !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE))
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup STFTF32 Streaming STFT F32
+
+  @par
+                   Spectrogram of a stream: frames of fftLen samples, hopSize samples
+                   apart, windowed and transformed with arm_rfft_fast_f32 as the samples
+                   arrive, in blocks of any size. The instance keeps the last fftLen
+                   samples of each channel in a ring, so a block shorter than the hop
+                   gives no frame and a block longer than fftLen several.
+  @par
+                   Frame f covers the samples f * hopSize to f * hopSize + fftLen - 1 of the
+                   stream. The window is applied while the frame is copied out of the
+                   ring, and with several channels the frame of every channel is
+                   transformed by one call of arm_rfft_fast_batch_f32.
+  @par           Output
+                   For each frame, the channels one after the other, each one as chosen
+                   by outputType:
+                   - ARM_STFT_COMPLEX   : the packed spectrum of arm_rfft_fast_f32, fftLen values
+                   - ARM_STFT_MAGNITUDE : |X[k]| for k = 0 .. fftLen/2, fftLen/2 + 1 values
+                   - ARM_STFT_POWER     : |X[k]|^2 for k = 0 .. fftLen/2, fftLen/2 + 1 values
+ */
+
+/**
+  @addtogroup STFTF32
+  @{
+ */
+
+/* Windowed copy of count interleaved samples: pDst[j * C + c] = pSrc[j * C + c] * pWindow[j] */
+__STATIC_FORCEINLINE void arm_stft_window_f32(
+  const float32_t * __RESTRICT pSrc,
+  const float32_t * __RESTRICT pWindow,
+        float32_t * __RESTRICT pDst,
+        uint32_t count,
+        uint32_t numChannels)
+{
+    for (uint32_t j = 0; j < count; j++)
+    {
+        const float32_t w = pWindow[j];
+
+        for (uint32_t c = 0; c < numChannels; c++)
+        {
+            pDst[j * numChannels + c] = pSrc[j * numChannels + c] * w;
+        }
+    }
+}
+
+/* Samples into the ring, count <= fftLen: at most two copies */
+static void arm_stft_push_f32(
+        arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t count)
+{
+    const uint32_t C = S->numChannels;
+    const uint32_t first = S->fftLen - S->ringPos;
+    float32_t *pRing = S->pState;
+
+    if (count < first)
+    {
+        memcpy(pRing + S->ringPos * C, pSrc, count * C * sizeof(float32_t));
+        S->ringPos += (uint16_t)count;
+    }
+    else
+    {
+        memcpy(pRing + S->ringPos * C, pSrc, first * C * sizeof(float32_t));
+        memcpy(pRing, pSrc + first * C, (count - first) * C * sizeof(float32_t));
+        S->ringPos = (uint16_t)(count - first);
+    }
+}
+
+/* |X[k]|^2 or |X[k]| of channel c of the interleaved packed spectra, fftLen/2 + 1 values */
+static void arm_stft_bins_f32(
+  const float32_t * pSpec,
+        float32_t * pDst,
+        uint32_t fftLen,
+        uint32_t numChannels,
+        uint32_t c,
+        int magnitude)
+{
+    const uint32_t half = fftLen / 2U;
+    float32_t re, im;
+
+    /* X[0] and X[N/2] are real, packed into the first complex value */
+    re = pSpec[c];
+    im = pSpec[numChannels + c];
+    pDst[0] = re * re;
+    pDst[half] = im * im;
+
+    for (uint32_t k = 1; k < half; k++)
+    {
+        re = pSpec[2U * k * numChannels + c];
+        im = pSpec[(2U * k + 1U) * numChannels + c];
+        pDst[k] = re * re + im * im;
+    }
+
+    if (magnitude)
+    {
+        for (uint32_t k = 0; k <= half; k++)
+        {
+            arm_sqrt_f32(pDst[k], &pDst[k]);
+        }
+    }
+}
+
+/* One frame from the ring into pDst, as many values per channel as outputType says */
+static void arm_stft_frame_f32(
+  const arm_stft_instance_f32 * S,
+        float32_t * pDst)
+{
+    const uint32_t C = S->numChannels;
+    const uint32_t N = S->fftLen;
+    const uint32_t first = N - S->ringPos;
+    const float32_t *pRing = S->pState;
+    float32_t *pFrame = S->pState + N * C;
+    float32_t *pSpec = pFrame + N * C;
+    const uint32_t binCount = N / 2U + 1U;
+
+    /* The oldest sample of the ring is the first of the frame */
+    if (C == 1U)
+    {
+        arm_mult_f32(pRing + S->ringPos, S->pWindow, pFrame, first);
+        arm_mult_f32(pRing, S->pWindow + first, pFrame + first, S->ringPos);
+    }
+    else
+    {
+        arm_stft_window_f32(pRing + S->ringPos * C, S->pWindow, pFrame, first, C);
+        arm_stft_window_f32(pRing, S->pWindow + first, pFrame + first * C, S->ringPos, C);
+    }
+
+    if (C == 1U)
+    {
+        if (S->outputType == ARM_STFT_COMPLEX)
+        {
+            arm_rfft_fast_f32(&S->Srfft, pFrame, pDst, 0);
+            return;
+        }
+        arm_rfft_fast_f32(&S->Srfft, pFrame, pSpec, 0);
+
+        if (S->outputType == ARM_STFT_POWER)
+        {
+            pDst[0] = pSpec[0] * pSpec[0];
+            pDst[N / 2U] = pSpec[1] * pSpec[1];
+            arm_cmplx_mag_squared_f32(pSpec + 2, pDst + 1, N / 2U - 1U);
+        }
+        else
+        {
+            pDst[0] = fabsf(pSpec[0]);
+            pDst[N / 2U] = fabsf(pSpec[1]);
+            arm_cmplx_mag_f32(pSpec + 2, pDst + 1, N / 2U - 1U);
+        }
+        return;
+    }
+
+    arm_rfft_fast_batch_f32(&S->Srfft, pFrame, pSpec, C, 0);
+
+    for (uint32_t c = 0; c < C; c++)
+    {
+        if (S->outputType == ARM_STFT_COMPLEX)
+        {
+            for (uint32_t j = 0; j < N; j++)
+            {
+                pDst[c * N + j] = pSpec[j * C + c];
+            }
+        }
+        else
+        {
+            arm_stft_bins_f32(pSpec, pDst + c * binCount, N, C, c, S->outputType == ARM_STFT_MAGNITUDE);
+        }
+    }
+}
+
+/**
+  @brief         Processing function for the floating-point streaming STFT.
+  @param[in,out] S          points to an instance of the STFT structure
+  @param[in]     pSrc       points to blockSize samples of each channel, interleaved:
+                            sample j of channel c at pSrc[j * numChannels + c]
+  @param[in]     blockSize  number of samples per channel, any value
+  @param[out]    pDst       points to room for blockSize / hopSize + 1 frames, a frame being
+                            numChannels * fftLen floats for ARM_STFT_COMPLEX and
+                            numChannels * (fftLen / 2 + 1) floats otherwise
+  @return        number of frames written to pDst
+
+  @par
+                   The frames complete in this block are written one after the other. The
+                   samples after the last of them stay in the instance for the next call,
+                   so the frames do not depend on how the stream is cut into blocks.
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_stft_f32(
+        arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst)
+{
+    const uint32_t C = S->numChannels;
+    const uint32_t frameSize = C * ((S->outputType == ARM_STFT_COMPLEX) ? S->fftLen : S->fftLen / 2U + 1U);
+    uint32_t frames = 0;
+
+    while (blockSize > 0U)
+    {
+        /* toNext <= fftLen, so no sample is written over before it is used */
+        uint32_t count = (blockSize < S->toNext) ? blockSize : S->toNext;
+
+        arm_stft_push_f32(S, pSrc, count);
+        pSrc += count * C;
+        blockSize -= count;
+        S->toNext -= (uint16_t)count;
+
+        if (S->toNext == 0U)
+        {
+            arm_stft_frame_f32(S, pDst);
+            pDst += frameSize;
+            frames++;
+            S->toNext = S->hopSize;
+        }
+    }
+
+    return frames;
+}
+
+/**
+  @} end of STFTF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE)) */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_init_f32.c
+ * Description:  Initialization function for the streaming STFT f32 instance
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include <string.h>
+
+#if !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE))
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup STFTF32
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point streaming STFT.
+  @param[out]    S            points to an instance of the STFT structure
+  @param[in]     fftLen       frame length, an arm_rfft_fast_f32 length: 32 to 4096
+  @param[in]     hopSize      samples between the starts of two frames, 1 to fftLen
+  @param[in]     numChannels  number of interleaved channels, at least 1
+  @param[in]     outputType   what arm_stft_f32 writes for each frame and channel
+  @param[in]     pWindow      points to fftLen window values, e.g. from arm_hanning_f32
+  @param[in]     pState       points to 3 * fftLen * numChannels floats of state
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : fftLen, hopSize or numChannels is not supported
+                   - \ref ARM_MATH_LENGTH_ERROR   : ARM_FFT_RUNTIME_TABLES build, the tables pool is full
+
+  @par
+                   The state is cleared: the first frame is output once fftLen samples
+                   have been given. pWindow and pState must stay valid while the instance
+                   is used; the window is not copied and can be shared by instances.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_stft_init_f32(
+        arm_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+        uint32_t numChannels,
+        arm_stft_output outputType,
+  const float32_t * pWindow,
+        float32_t * pState)
+{
+    arm_status status;
+
+    if (hopSize == 0U || hopSize > fftLen || numChannels == 0U)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    status = arm_rfft_fast_init_f32(&S->Srfft, fftLen);
+    if (status != ARM_MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    S->pWindow = pWindow;
+    S->pState = pState;
+    S->numChannels = numChannels;
+    S->fftLen = fftLen;
+    S->hopSize = hopSize;
+    S->ringPos = 0;
+    S->toNext = fftLen;
+    S->outputType = outputType;
+
+    memset(pState, 0, 3U * fftLen * numChannels * sizeof(float32_t));
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of STFTF32 group
+ */
+
+#endif /* !defined(ARM_MATH_NEON) && (!defined(ARM_MATH_MVEF) || defined(ARM_MATH_AUTOVECTORIZE)) */
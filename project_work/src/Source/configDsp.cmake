@@ -28,6 +28,22 @@ if (NEON)
 
 endif()
 
+# x86 variants for host builds, see arm_x86_utils.h. AVX2 takes precedence.
+# DISPATCH builds all of them, see DispatchFunctions/Config.cmake.
+if (AVX2 AND NOT DISPATCH)
+    target_compile_definitions(${project} PRIVATE ARM_MATH_AVX2)
+    target_compile_options(${project} PRIVATE -mavx2)
+elseif (SSE AND NOT DISPATCH)
+    target_compile_definitions(${project} PRIVATE ARM_MATH_SSE)
+    target_compile_options(${project} PRIVATE -msse2)
+endif()
+
+# The f32 CFFT/RFFT tables are left out of CommonTables, see arm_cfft_init_tables_f32.c.
+# PUBLIC: arm_const_structs.h must not declare the table instances to users either.
+if (RUNTIMETABLES)
+    target_compile_definitions(${project} PUBLIC ARM_FFT_RUNTIME_TABLES)
+endif()
+
 if (NEONEXPERIMENTAL)
     # Used in arm_vec_math.h
     target_include_directories(${project} PUBLIC "${DSP}/ComputeLibrary/Include")
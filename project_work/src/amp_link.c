@@ -0,0 +1,136 @@
+/**
+ * @file amp_link.c
+ * @brief CPU0 side of AMP mode. See amp_link.h.
+ */
+
+#include "amp_link.h"
+#include "amp_mailbox.h"
+#include "controller.h"
+#include "plant.h"
+#include "system_params.h"
+#include "data_logger.h"
+#include "boot_profile.h"
+#include "trajectory.h"
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Xilinx includes. */
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "xil_mmu.h"
+#include "xpseudo_asm.h"
+#include "xtime_l.h"
+#include "sleep.h"
+
+// CPU1 waits in the boot ROM for an event and then jumps to the address stored here.
+#define AMP_CPU1_RELEASE_ADDR	0xFFFFFFF0U
+#define AMP_READY_TIMEOUT_MS	100
+
+static const int print_interval = 500;
+
+static AmpMailbox_t *mailbox;
+
+int AmpLink_Start(void)
+{
+	// Shareable, non-cacheable on this core. CPU1 maps it the same way.
+	Xil_SetTlbAttributes(AMP_MAILBOX_BASE, NORM_NONCACHE);
+	mailbox = AmpMailbox_Init((void *)AMP_MAILBOX_BASE);
+
+	Xil_Out32(AMP_CPU1_RELEASE_ADDR, AMP_CPU1_START_ADDR);
+	dmb();
+	__asm__ __volatile__("sev");
+
+	for (int ms = 0; ms < AMP_READY_TIMEOUT_MS; ms++)
+	{
+		if (__atomic_load_n(&mailbox->cpu1_ready, __ATOMIC_ACQUIRE))
+		{
+			return XST_SUCCESS;
+		}
+		usleep(1000);
+	}
+	return XST_FAILURE;
+}
+
+/// @brief This is the AMP bridge task. Replaces control_task and plant_model_task on CPU0.
+void amp_link_task(void *pvParameters)
+{
+	TickType_t xLastWakeTime;
+	const TickType_t xInterval = pdMS_TO_TICKS(controller_interval);
+
+	AmpSetpoint_t sent = { 0, 0, -1.0f };	// Never matches, so the first period sends
+	PIDGains_t sent_gains = { -1.0f, -1.0f, -1.0f };
+	AmpTelemetry_t telemetry = { 0 };
+	XTime sent_time = 0;
+	u32 rtt_us = 0;
+	int i_print = 0;
+
+	xLastWakeTime = xTaskGetTickCount();
+
+	for (;;)
+	{
+		AmpSetpoint_t setpoint;
+		PIDGains_t gains;
+		float target;
+
+		// Only changes go over the mailbox. A full ring just retries next period.
+		// A failed read sends nothing, CPU1 keeps the last values until the next period.
+		setpoint.seq = sent.seq + 1;
+		setpoint.run = (getSystemMode() == MODE_MODULATION);
+		// Trajectories are sampled here, CPU1 gets one reference per period like control_task uses.
+		if (getTargetVoltage(&target) == XST_SUCCESS)
+		{
+			setpoint.u_ref = Trajectory_Sample(target);
+			if ((setpoint.run != sent.run || setpoint.u_ref != sent.u_ref) &&
+				AmpMailbox_SendSetpoint(mailbox, &setpoint))
+			{
+				sent = setpoint;
+				XTime_GetTime(&sent_time);
+			}
+		}
+
+		if (getParameters(&gains.kp, &gains.ki, &gains.kd) == XST_SUCCESS &&
+			(gains.kp != sent_gains.kp || gains.ki != sent_gains.ki || gains.kd != sent_gains.kd) &&
+			AmpMailbox_SendGains(mailbox, &gains))
+		{
+			sent_gains = gains;
+		}
+
+		// Drain the telemetry, the newest record drives the LEDs and the print.
+		while (AmpMailbox_ReceiveTelemetry(mailbox, &telemetry))
+		{
+			BootProfile_FirstSample();
+
+			// CPU1 steps go to the data logger like control_task samples do.
+			LogSample_t sample = { telemetry.step * xInterval, telemetry.u_ref, telemetry.u_meas, telemetry.u_out };
+			if (DataLogger_Record(&sample))
+			{
+				xTaskNotifyGive(log_task_handle);
+			}
+			if (telemetry.seq == sent.seq && sent_time != 0)
+			{
+				XTime now;
+				XTime_GetTime(&now);
+				rtt_us = (u32)((now - sent_time) * 1000000 / COUNTS_PER_SECOND);
+				sent_time = 0;
+			}
+		}
+		updatePWMBrightness(telemetry.u_meas);
+
+		if (++i_print >= print_interval && setpoint.run)
+		{
+			i_print = 0;
+			xil_printf("\rAMP Step: %d | Tgt: %d (mV) | PI: %d (mV) | Plant: %d (mV) | RTT: %d (us) | Drop: %d | Late: %d      ",
+					   (int)telemetry.step,
+					   (int)(telemetry.u_ref * 1000),
+					   (int)(telemetry.u_out * 1000),
+					   (int)(telemetry.u_meas * 1000),
+					   (int)rtt_us,
+					   (int)mailbox->telemetry_dropped,
+					   (int)mailbox->overruns);
+		}
+
+		vTaskDelayUntil(&xLastWakeTime, xInterval);
+	}
+}
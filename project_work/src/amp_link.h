@@ -0,0 +1,26 @@
+/**
+ * @file amp_link.h
+ * @brief CPU0 side of AMP mode: starts CPU1 and bridges the UI to its control loop.
+ *
+ * Built in with -DAMP_MODE=1. main.c then creates amp_link_task in place of
+ * control_task and plant_model_task. The task forwards target voltage, mode and gain
+ * changes to the mailbox and collects the telemetry CPU1 pushes every control step.
+ */
+
+#ifndef AMP_LINK_H
+#define AMP_LINK_H
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+// Entry point of the CPU1 image, matches the origin of its linker script.
+#define AMP_CPU1_START_ADDR		0x30000000U
+
+/// @brief Sets up the mailbox and wakes CPU1 at AMP_CPU1_START_ADDR.
+/// @return XST_FAILURE if CPU1 doesn't report ready in time.
+int AmpLink_Start(void);
+
+/// @brief Mailbox bridge task, runs at the control interval.
+void amp_link_task(void *pvParameters);
+
+#endif
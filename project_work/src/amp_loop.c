@@ -0,0 +1,48 @@
+/**
+ * @file amp_loop.c
+ * @brief The control / plant step run on CPU1 in AMP mode. See amp_loop.h.
+ */
+
+#include "amp_loop.h"
+#include <string.h>
+
+void AmpLoop_Init(AmpLoop_t *loop, const PIDGains_t *gains)
+{
+	memset(loop, 0, sizeof(*loop));
+	loop->gains = *gains;
+}
+
+void AmpLoop_Step(AmpLoop_t *loop, AmpMailbox_t *mailbox)
+{
+	AmpTelemetry_t telemetry;
+	float u_out = 0;
+
+	// Only the newest setpoint and gains matter, drain the rings.
+	while (AmpMailbox_ReceiveSetpoint(mailbox, &loop->setpoint))
+	{
+	}
+	while (AmpMailbox_ReceiveGains(mailbox, &loop->gains))
+	{
+	}
+
+	if (loop->setpoint.run)
+	{
+		u_out = PID_controller(loop->u_meas, loop->setpoint.u_ref,
+							   loop->gains.kd, loop->gains.ki, loop->gains.kp, 0, &loop->pid);
+	}
+	else
+	{
+		// Same as control_task outside modulation: reset and output zero.
+		PID_controller(0, 0, 0, 0, 0, 1, &loop->pid);
+	}
+	loop->u_meas = PlantModel_Step(loop->plant_state, u_out);
+
+	telemetry.step = loop->step++;
+	telemetry.seq = loop->setpoint.seq;
+	telemetry.u_ref = loop->setpoint.u_ref;
+	telemetry.u_meas = loop->u_meas;
+	telemetry.u_out = u_out;
+	AmpMailbox_SendTelemetry(mailbox, &telemetry);
+
+	__atomic_store_n(&mailbox->heartbeat, loop->step, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,33 @@
+/**
+ * @file amp_loop.h
+ * @brief The control / plant step run on CPU1 in AMP mode.
+ *
+ * One AmpLoop_Step() per control interval: take the newest setpoint and gains from
+ * the mailbox, run PID_controller and the plant model, push one telemetry record.
+ * Pure computation on caller owned state, paced by the caller, so the host benchmark
+ * runs exactly the code CPU1 runs.
+ */
+
+#ifndef AMP_LOOP_H
+#define AMP_LOOP_H
+
+#include "amp_mailbox.h"
+#include "pid_controller.h"
+#include "plant_model.h"
+
+typedef struct {
+	PIDControllerState_t pid;
+	float plant_state[PLANT_STATE_SIZE];
+	PIDGains_t gains;
+	AmpSetpoint_t setpoint;		// Newest one received
+	float u_meas;
+	u32 step;
+} AmpLoop_t;
+
+/// @brief Stopped loop at rest, with the given starting gains.
+void AmpLoop_Init(AmpLoop_t *loop, const PIDGains_t *gains);
+
+/// @brief One control interval. Never waits on the other core.
+void AmpLoop_Step(AmpLoop_t *loop, AmpMailbox_t *mailbox);
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * @file amp_mailbox.c
+ * @brief Shared-memory mailbox between the two cores. See amp_mailbox.h.
+ */
+
+#include "amp_mailbox.h"
+#include <string.h>
+
+_Static_assert(sizeof(AmpMailbox_t) <= 0xFE00, "AmpMailbox_t does not fit in high OCM");
+
+AmpMailbox_t *AmpMailbox_Init(void *base)
+{
+	AmpMailbox_t *mailbox = (AmpMailbox_t *)base;
+
+	__atomic_store_n(&mailbox->magic, 0, __ATOMIC_RELEASE);
+	memset(mailbox, 0, sizeof(*mailbox));
+
+	SpscRing_Init(&mailbox->setpoints, mailbox->setpoint_storage, AMP_SETPOINT_DEPTH, sizeof(AmpSetpoint_t));
+	SpscRing_Init(&mailbox->gains, mailbox->gains_storage, AMP_GAINS_DEPTH, sizeof(PIDGains_t));
+	SpscRing_Init(&mailbox->telemetry, mailbox->telemetry_storage, AMP_TELEMETRY_DEPTH, sizeof(AmpTelemetry_t));
+
+	// Release: CPU1 sees initialised rings once it sees the magic.
+	__atomic_store_n(&mailbox->magic, AMP_MAILBOX_MAGIC, __ATOMIC_RELEASE);
+	return mailbox;
+}
+
+AmpMailbox_t *AmpMailbox_Attach(void *base)
+{
+	AmpMailbox_t *mailbox = (AmpMailbox_t *)base;
+
+	if (__atomic_load_n(&mailbox->magic, __ATOMIC_ACQUIRE) != AMP_MAILBOX_MAGIC)
+	{
+		return NULL;
+	}
+	return mailbox;
+}
+
+bool AmpMailbox_SendSetpoint(AmpMailbox_t *mailbox, const AmpSetpoint_t *setpoint)
+{
+	return SpscRing_Push(&mailbox->setpoints, setpoint);
+}
+
+bool AmpMailbox_ReceiveSetpoint(AmpMailbox_t *mailbox, AmpSetpoint_t *setpoint)
+{
+	return SpscRing_Pop(&mailbox->setpoints, setpoint);
+}
+
+bool AmpMailbox_SendGains(AmpMailbox_t *mailbox, const PIDGains_t *gains)
+{
+	return SpscRing_Push(&mailbox->gains, gains);
+}
+
+bool AmpMailbox_ReceiveGains(AmpMailbox_t *mailbox, PIDGains_t *gains)
+{
+	return SpscRing_Pop(&mailbox->gains, gains);
+}
+
+void AmpMailbox_SendTelemetry(AmpMailbox_t *mailbox, const AmpTelemetry_t *telemetry)
+{
+	if (!SpscRing_Push(&mailbox->telemetry, telemetry))
+	{
+		// Only CPU1 writes the counter.
+		__atomic_store_n(&mailbox->telemetry_dropped, mailbox->telemetry_dropped + 1, __ATOMIC_RELAXED);
+	}
+}
+
+bool AmpMailbox_ReceiveTelemetry(AmpMailbox_t *mailbox, AmpTelemetry_t *telemetry)
+{
+	return SpscRing_Pop(&mailbox->telemetry, telemetry);
+}
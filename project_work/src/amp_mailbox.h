@@ -0,0 +1,78 @@
+/**
+ * @file amp_mailbox.h
+ * @brief Shared-memory mailbox between the FreeRTOS side (CPU0) and the bare-metal
+ * control loop on CPU1 in AMP mode.
+ *
+ * Three SpscRings, each with one producer core and one consumer core:
+ *   setpoints  CPU0 -> CPU1  target voltage and run / stop
+ *   gains      CPU0 -> CPU1  PID gains
+ *   telemetry  CPU1 -> CPU0  one record per control step
+ * The mailbox lives in the top 64 KB of OCM, which both cores map uncached, so the
+ * ring indexes and items are coherent without cache maintenance. Nothing in here calls
+ * FreeRTOS or a driver, so the same code runs on both cores and in host builds.
+ */
+
+#ifndef AMP_MAILBOX_H
+#define AMP_MAILBOX_H
+
+#include "spsc_ring.h"
+#include "gain_schedule.h"
+#include "xil_types.h"
+#include <stdbool.h>
+
+// High OCM, unused by the linker scripts of both cores.
+#define AMP_MAILBOX_BASE		0xFFFF0000U
+#define AMP_MAILBOX_MAGIC		0x414D5031U		// "AMP1"
+
+// Ring depths, powers of two.
+#define AMP_SETPOINT_DEPTH		16
+#define AMP_GAINS_DEPTH			4
+#define AMP_TELEMETRY_DEPTH		256		// 256 ms of control steps
+
+typedef struct {
+	u32 seq;		// Echoed back in the telemetry, for round-trip timing
+	u32 run;		// 0 stops the loop and resets the controller (not in modulation)
+	float u_ref;
+} AmpSetpoint_t;
+
+typedef struct {
+	u32 step;		// CPU1 control step counter
+	u32 seq;		// Newest setpoint seq applied in this step
+	float u_ref;
+	float u_meas;
+	float u_out;	// Controller output
+} AmpTelemetry_t;
+
+typedef struct {
+	volatile u32 magic;				// Written last by AmpMailbox_Init
+	volatile u32 cpu1_ready;		// Set by CPU1 once it runs its loop
+	volatile u32 heartbeat;			// CPU1 control steps
+	volatile u32 telemetry_dropped;	// Records lost because CPU0 fell behind
+	volatile u32 overruns;			// CPU1 control steps that took longer than the interval
+	SpscRing_t setpoints;
+	SpscRing_t gains;
+	SpscRing_t telemetry;
+	AmpSetpoint_t setpoint_storage[AMP_SETPOINT_DEPTH];
+	PIDGains_t gains_storage[AMP_GAINS_DEPTH];
+	AmpTelemetry_t telemetry_storage[AMP_TELEMETRY_DEPTH];
+} AmpMailbox_t;
+
+/// @brief CPU0 side: clears the mailbox and sets up the rings. Call before CPU1 is started.
+/// @param base AMP_MAILBOX_BASE on the target, any sizeof(AmpMailbox_t) block in host builds.
+AmpMailbox_t *AmpMailbox_Init(void *base);
+
+/// @brief CPU1 side: the mailbox at base once CPU0 has initialised it.
+/// @return NULL while the magic is not there yet.
+AmpMailbox_t *AmpMailbox_Attach(void *base);
+
+// CPU0 -> CPU1. Send returns false if the ring is full, Receive if it is empty.
+bool AmpMailbox_SendSetpoint(AmpMailbox_t *mailbox, const AmpSetpoint_t *setpoint);
+bool AmpMailbox_ReceiveSetpoint(AmpMailbox_t *mailbox, AmpSetpoint_t *setpoint);
+bool AmpMailbox_SendGains(AmpMailbox_t *mailbox, const PIDGains_t *gains);
+bool AmpMailbox_ReceiveGains(AmpMailbox_t *mailbox, PIDGains_t *gains);
+
+// CPU1 -> CPU0. A full ring drops the record and counts it, the loop never waits.
+void AmpMailbox_SendTelemetry(AmpMailbox_t *mailbox, const AmpTelemetry_t *telemetry);
+bool AmpMailbox_ReceiveTelemetry(AmpMailbox_t *mailbox, AmpTelemetry_t *telemetry);
+
+#endif
@@ -0,0 +1,81 @@
+/**
+ * @file boot_profile.c
+ * @brief Boot phase timestamps. See boot_profile.h.
+ */
+
+#include "boot_profile.h"
+#include "xtime_l.h"
+#include "xil_printf.h"
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+typedef struct {
+	const char *phase;
+	XTime time;
+} BootMark_t;
+
+static BootMark_t marks[BOOT_PROFILE_MAX_MARKS];
+static volatile u32 mark_count = 0;
+static volatile bool first_sample = false;
+
+static u32 counts_to_us(XTime counts)
+{
+	return (u32)(counts * 1000000 / COUNTS_PER_SECOND);
+}
+
+void BootProfile_Mark(const char *phase)
+{
+	XTime now;
+	XTime_GetTime(&now);
+
+	u32 index = __atomic_fetch_add(&mark_count, 1, __ATOMIC_ACQ_REL);
+	if (index < BOOT_PROFILE_MAX_MARKS)
+	{
+		marks[index].phase = phase;
+		marks[index].time = now;
+	}
+}
+
+void BootProfile_FirstSample(void)
+{
+	if (!__atomic_load_n(&first_sample, __ATOMIC_ACQUIRE))
+	{
+		BootProfile_Mark("first control sample");
+		__atomic_store_n(&first_sample, true, __ATOMIC_RELEASE);
+	}
+}
+
+void BootProfile_Report(void)
+{
+	u32 count = __atomic_load_n(&mark_count, __ATOMIC_ACQUIRE);
+	XTime previous = 0;
+
+	if (count > BOOT_PROFILE_MAX_MARKS)
+	{
+		count = BOOT_PROFILE_MAX_MARKS;
+	}
+
+	xil_printf("\r\nBoot profile (us since _start | phase):\r\n");
+	for (u32 i = 0; i < count; i++)
+	{
+		xil_printf("BOOT,%s,%d,+%d\r\n", marks[i].phase,
+				   (int)counts_to_us(marks[i].time), (int)counts_to_us(marks[i].time - previous));
+		previous = marks[i].time;
+	}
+}
+
+bool BootProfile_WaitFirstSample(void)
+{
+	// Polled so control_task doesn't need to know who is waiting.
+	for (int ms = 0; ms < BOOT_FIRST_SAMPLE_TIMEOUT_MS; ms++)
+	{
+		if (__atomic_load_n(&first_sample, __ATOMIC_ACQUIRE))
+		{
+			return true;
+		}
+		vTaskDelay(pdMS_TO_TICKS(1));
+	}
+	return false;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file boot_profile.h
+ * @brief Boot phase timestamps from reset to the first control sample.
+ *
+ * Marks are global timer reads (CPU clock / 2). The standalone crt0 clears the
+ * global timer in _start, so every mark is time since the application started;
+ * the BootROM / FSBL part before that (ps7_init, bitstream, image copy) is printed
+ * by an FSBL built with FSBL_PERF.
+ *
+ * boot_task in main.c prints the profile once the first control sample has been taken,
+ * as "BOOT,<phase>,<us since _start>,+<us since previous>" lines that host/boot_check
+ * compares between runs.
+ */
+
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include "xil_types.h"
+#include <stdbool.h>
+
+#define BOOT_PROFILE_MAX_MARKS		16
+#define BOOT_FIRST_SAMPLE_TIMEOUT_MS	1000	// Report anyway if the control loop never runs
+
+/// @brief Records the end of a boot phase. Marks past BOOT_PROFILE_MAX_MARKS are ignored.
+void BootProfile_Mark(const char *phase);
+
+/// @brief Marks the first control sample, from control_task. Only the first call counts.
+void BootProfile_FirstSample(void);
+
+/// @brief Prints the marks with the time since _start and since the previous mark.
+void BootProfile_Report(void);
+
+/// @brief Waits (task context) until BootProfile_FirstSample has run.
+/// @return false after BOOT_FIRST_SAMPLE_TIMEOUT_MS without a sample.
+bool BootProfile_WaitFirstSample(void);
+
+#endif
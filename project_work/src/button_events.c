@@ -0,0 +1,174 @@
+/**
+ * @file button_events.c
+ * @brief Deferred button event pipeline. See button_events.h.
+ */
+
+#include "button_events.h"
+#include "spsc_ring.h"
+
+// Raw sample captured by the ISR.
+typedef struct {
+	XTime timestamp;
+	u32 buttons;
+} ButtonSample_t;
+
+// Per button debounce / hold tracking. Only touched in task context.
+typedef struct {
+	bool raw;			// Latest state seen from the ISR
+	bool stable;		// Debounced state
+	XTime last_edge;	// Time of the latest raw edge
+	XTime last_accept;	// Time the stable state last changed
+	XTime next_repeat;	// When the next long-press / repeat event is due
+	bool long_sent;
+} ButtonState_t;
+
+#define MS_TO_COUNTS(ms) ((XTime)(ms) * (COUNTS_PER_SECOND / 1000))
+
+// ISR -> task queue (raw samples) and task-local queue (decoded events).
+static ButtonSample_t raw_storage[BTN_RAW_QUEUE_LENGTH];
+static ButtonEvent_t event_storage[BTN_EVENT_QUEUE_LENGTH];
+static SpscRing_t raw_ring;
+static SpscRing_t event_ring;
+
+static ButtonState_t button_state[BTN_COUNT];
+static volatile u32 dropped_samples = 0;
+
+void ButtonEvents_Init(void)
+{
+	SpscRing_Init(&raw_ring, raw_storage, BTN_RAW_QUEUE_LENGTH, sizeof(ButtonSample_t));
+	SpscRing_Init(&event_ring, event_storage, BTN_EVENT_QUEUE_LENGTH, sizeof(ButtonEvent_t));
+
+	for (int i = 0; i < BTN_COUNT; i++)
+	{
+		button_state[i] = (ButtonState_t){0};
+	}
+	dropped_samples = 0;
+}
+
+/// @brief Keep this as short as possible, it runs in the FIQ.
+void ButtonEvents_CaptureFromISR(u32 button_states)
+{
+	ButtonSample_t sample;
+
+	XTime_GetTime(&sample.timestamp);
+	sample.buttons = button_states;
+
+	if (!SpscRing_Push(&raw_ring, &sample))
+	{
+		dropped_samples++;
+	}
+}
+
+static void emit(ButtonEventType_t type, int button, XTime timestamp)
+{
+	ButtonEvent_t event = { type, 1UL << button, timestamp };
+
+	// If the UI falls this far behind, the newest events are the ones lost.
+	SpscRing_Push(&event_ring, &event);
+}
+
+/// @brief Accept a new stable state for one button and emit the matching event.
+static void accept(int button, bool pressed, XTime timestamp)
+{
+	ButtonState_t *s = &button_state[button];
+
+	s->stable = pressed;
+	s->last_accept = timestamp;
+
+	if (pressed)
+	{
+		s->long_sent = false;
+		s->next_repeat = timestamp + MS_TO_COUNTS(BTN_LONG_PRESS_MS);
+		emit(BTN_EVENT_PRESS, button, timestamp);
+	}
+	else
+	{
+		emit(BTN_EVENT_RELEASE, button, timestamp);
+	}
+}
+
+void ButtonEvents_Process(void)
+{
+	ButtonSample_t sample;
+	XTime now;
+
+	// Replay the raw samples in order. An edge is accepted immediately unless it
+	// comes within the debounce window of the previous accepted edge.
+	while (SpscRing_Pop(&raw_ring, &sample))
+	{
+		for (int i = 0; i < BTN_COUNT; i++)
+		{
+			ButtonState_t *s = &button_state[i];
+			bool pressed = (sample.buttons >> i) & 0x1;
+
+			if (pressed == s->raw)
+			{
+				continue;
+			}
+			s->raw = pressed;
+			s->last_edge = sample.timestamp;
+
+			if (pressed != s->stable && (sample.timestamp - s->last_accept) >= MS_TO_COUNTS(BTN_DEBOUNCE_MS))
+			{
+				accept(i, pressed, sample.timestamp);
+			}
+		}
+	}
+
+	XTime_GetTime(&now);
+
+	for (int i = 0; i < BTN_COUNT; i++)
+	{
+		ButtonState_t *s = &button_state[i];
+
+		// A bounce inside the debounce window may have left raw != stable with no
+		// further interrupt coming. Settle it once the window has passed.
+		if (s->raw != s->stable && (now - s->last_accept) >= MS_TO_COUNTS(BTN_DEBOUNCE_MS))
+		{
+			XTime settled = s->last_accept + MS_TO_COUNTS(BTN_DEBOUNCE_MS);
+			accept(i, s->raw, (s->last_edge > settled) ? s->last_edge : settled);
+		}
+
+		// Long press and auto repeat while held.
+		if (s->stable && now >= s->next_repeat)
+		{
+			if (!s->long_sent)
+			{
+				s->long_sent = true;
+				emit(BTN_EVENT_LONG_PRESS, i, s->next_repeat);
+			}
+			else
+			{
+				emit(BTN_EVENT_REPEAT, i, s->next_repeat);
+			}
+			s->next_repeat += MS_TO_COUNTS(BTN_REPEAT_MS);
+
+			// Don't try to catch up if the UI task was stalled.
+			if (s->next_repeat < now)
+			{
+				s->next_repeat = now + MS_TO_COUNTS(BTN_REPEAT_MS);
+			}
+		}
+	}
+}
+
+bool ButtonEvents_Get(ButtonEvent_t *event)
+{
+	return SpscRing_Pop(&event_ring, event);
+}
+
+void ButtonEvents_Flush(void)
+{
+	ButtonEvent_t event;
+
+	// Keep the debounce state in sync with the buttons, just throw the events away.
+	ButtonEvents_Process();
+	while (SpscRing_Pop(&event_ring, &event))
+	{
+	}
+}
+
+u32 ButtonEvents_GetDroppedCount(void)
+{
+	return dropped_samples;
+}
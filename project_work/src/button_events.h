@@ -0,0 +1,55 @@
+/**
+ * @file button_events.h
+ * @brief Deferred button event pipeline.
+ *
+ * The button FIQ only captures (timestamp, button bitmask) pairs into a lock-free
+ * queue. Debounce, long-press and repeat detection are done later in task context.
+ */
+
+#ifndef BUTTON_EVENTS_H
+#define BUTTON_EVENTS_H
+
+#include "xil_types.h"
+#include "xtime_l.h"
+#include <stdbool.h>
+
+#define BTN_COUNT				4
+#define BTN_RAW_QUEUE_LENGTH	32	// Raw ISR samples, must be a power of two
+#define BTN_EVENT_QUEUE_LENGTH	32	// Decoded events, must be a power of two
+
+// Timing (ms)
+#define BTN_DEBOUNCE_MS			20
+#define BTN_LONG_PRESS_MS		800
+#define BTN_REPEAT_MS			150
+
+typedef enum {
+	BTN_EVENT_PRESS = 0,		// Button went down
+	BTN_EVENT_RELEASE = 1,		// Button went up
+	BTN_EVENT_LONG_PRESS = 2,	// Button has been held for BTN_LONG_PRESS_MS
+	BTN_EVENT_REPEAT = 3		// Button still held, sent every BTN_REPEAT_MS after the long press
+} ButtonEventType_t;
+
+typedef struct {
+	ButtonEventType_t type;
+	u32 button_mask;	// Single bit, same bit layout as the GPIO channel (0x01 = button 0)
+	XTime timestamp;	// Global timer count of the (debounced) edge
+} ButtonEvent_t;
+
+void ButtonEvents_Init(void);
+
+/// @brief Called from the button ISR. Only timestamps the state and queues it.
+void ButtonEvents_CaptureFromISR(u32 button_states);
+
+/// @brief Task context. Runs debounce / long-press / repeat detection on everything queued so far.
+void ButtonEvents_Process(void);
+
+/// @brief Task context. Returns the next decoded event, false if there is none.
+bool ButtonEvents_Get(ButtonEvent_t *event);
+
+/// @brief Task context. Drops all queued samples and events, e.g. when buttons are blocked.
+void ButtonEvents_Flush(void);
+
+/// @brief Number of ISR samples lost because the raw queue was full.
+u32 ButtonEvents_GetDroppedCount(void);
+
+#endif
@@ -7,6 +7,12 @@
 #include "plant.h"
 #include "timer_setup.h"
 #include "ui_control.h"
+#include "gain_schedule.h"
+#include "freq_analyser.h"
+#include "meas_frontend.h"
+#include "data_logger.h"
+#include "boot_profile.h"
+#include "trajectory.h"
 
 /* FreeRTOS includes. */
 #include "FreeRTOS.h"
@@ -27,8 +33,8 @@
 
 // Variables:
 
-// Step size for integration. Mathced with "sampling interval"
-float h = (float)controller_interval / 1000.0;
+// PID_controller integrates with a fixed step, keep it matched with the loop interval.
+_Static_assert(controller_interval == PID_SAMPLE_TIME_MS, "PID_SAMPLE_TIME_MS must match controller_interval");
 
 TickType_t xTaskGetTickCount(void);
 
@@ -50,6 +56,16 @@ static float Kd = 0.01;
 // !STATIC!
 static PIDControllerState_t controller_state = {0};
 
+// State kept when modulation is left, so the loop can resume from it bumplessly
+// instead of integrating up from zero again.
+static PIDControllerState_t resume_state = {0};
+static bool resume_valid = false;
+static SystemMode_t previous_control_mode = MODE_CONFIG;
+
+// How often (controller iterations) the warm-restart snapshot in RAM is refreshed.
+static const int snapshot_interval = 100;
+static int i_snapshot = 0;
+
 volatile ConfigParam_t selected_param = PARAM_KP;
 
 /// set parameter function for UART usage - R.M.
@@ -176,6 +192,23 @@ void decreaseParameter(float step){
 
 }
 
+/// @brief Starts a trajectory from where the reference is now to the new target, if shaping
+/// is on. Call with controller_params_MUTEX held, it serialises the trajectory producers.
+static void shapeTarget(float new_target)
+{
+	if (!Trajectory_Enabled())
+	{
+		Trajectory_Cancel();
+		return;
+	}
+	// A move that doesn't fit or finds no free table becomes a step.
+	if (Trajectory_Replace(Trajectory_Position(), new_target, 0) != XST_SUCCESS)
+	{
+		Trajectory_Cancel();
+		xil_printf("\r\nTrajectory not available, target voltage stepped.\r\n");
+	}
+}
+
 // increase target voltage function - R.M.
 /// @brief This function increases the target voltage by a specified step.
 /// @param step The amount by which to increase the target voltage.
@@ -190,6 +223,7 @@ void increaseTargetVoltage(float step)
 		{
 			new_target = 400;
 		}
+		shapeTarget(new_target);
 		u_ref = new_target;
 		xSemaphoreGive(controller_params_MUTEX);
 		/* Access to the shared resource is complete, so the mutex is returned. */
@@ -213,6 +247,7 @@ void decreaseTargetVoltage(float step)
 		{
 			new_target = 0;
 		}
+		shapeTarget(new_target);
 		u_ref = new_target;
 		xSemaphoreGive(controller_params_MUTEX);
 		/* Access to the shared resource is complete, so the mutex is returned. */
@@ -238,6 +273,7 @@ void setTargetVoltage(float new_target)
 		{
 			new_target = 400;
 		}
+		shapeTarget(new_target);
 		u_ref = new_target;
 		xSemaphoreGive(controller_params_MUTEX);
 		/* Access to the shared resource is complete, so the mutex is returned. */
@@ -249,6 +285,176 @@ void setTargetVoltage(float new_target)
 	}
 }
 
+/// @brief Runs a multi-segment reference profile: each target in turn, from where the
+/// reference is now, holding holds_ms[i] at every target. Targets are clamped to 0-400 V.
+/// @return XST_FAILURE if a segment can't be precomputed. The reference then stays where it is.
+int runTargetProfile(const float *targets, const u32 *holds_ms, u32 count)
+{
+	int status = XST_SUCCESS;
+	int wait_ms = 100;
+
+	if (count == 0 || count > TRAJ_TABLE_COUNT)
+	{
+		return XST_FAILURE;
+	}
+
+	// Stop where the reference is and let the control side give the tables back.
+	stopTargetProfile();
+	while (Trajectory_Busy() && wait_ms-- > 0)
+	{
+		vTaskDelay(pdMS_TO_TICKS(1));
+	}
+
+	if (xSemaphoreTake(controller_params_MUTEX, 5) == pdTRUE)
+	{
+		float start = Trajectory_Position();
+
+		for (u32 i = 0; i < count && status == XST_SUCCESS; i++)
+		{
+			float target = targets[i];
+			if (target < 0)
+			{
+				target = 0;
+			}
+			else if (target > 400)
+			{
+				target = 400;
+			}
+			status = Trajectory_Queue(start, target, holds_ms[i]);
+			start = target;
+		}
+
+		if (status == XST_SUCCESS)
+		{
+			// Where the reference stays after the last segment.
+			u_ref = start;
+		}
+		else
+		{
+			u_ref = Trajectory_Position();
+			Trajectory_Cancel();
+		}
+		xSemaphoreGive(controller_params_MUTEX);
+	}
+	else
+	{
+		// error getting the mutex
+		xil_printf("\r\nError while setting the target voltage for controller.\r\n");
+		status = XST_FAILURE;
+	}
+	return status;
+}
+
+/// @brief Stops a running profile or move where the reference is now.
+void stopTargetProfile(void)
+{
+	if (xSemaphoreTake(controller_params_MUTEX, 5) == pdTRUE)
+	{
+		if (Trajectory_Busy())
+		{
+			u_ref = Trajectory_Position();
+		}
+		Trajectory_Cancel();
+		xSemaphoreGive(controller_params_MUTEX);
+	}
+	else
+	{
+		// error getting the mutex
+		xil_printf("\r\nError while setting the target voltage for controller.\r\n");
+	}
+}
+
+/// @brief This function allows for retrieving the controller parameters with MUTEXes implemented.
+/// Used e.g. when the parameters are saved to flash.
+/// @return XST_SUCCESS, or XST_FAILURE if the mutex timed out and kp, ki, kd were not written.
+int getParameters(float *kp, float *ki, float *kd)
+{
+	if (xSemaphoreTake(controller_params_MUTEX, 5) == pdTRUE)
+	{
+		/* The mutex was successfully obtained so the shared resource can beaccessed safely. */
+		*kp = Kp;
+		*ki = Ki;
+		*kd = Kd;
+		xSemaphoreGive(controller_params_MUTEX);
+		/* Access to the shared resource is complete, so the mutex is returned. */
+		return XST_SUCCESS;
+	}
+
+	// error getting the mutex
+	xil_printf("\r\nError while retreiving the controller parameters.\r\n");
+	return XST_FAILURE;
+}
+
+/// @brief This function allows for retrieving the target voltage with MUTEXes implemented.
+/// @return XST_SUCCESS, or XST_FAILURE if the mutex timed out and target was not written.
+int getTargetVoltage(float *target)
+{
+	if (xSemaphoreTake(controller_params_MUTEX, 5) == pdTRUE)
+	{
+		/* The mutex was successfully obtained so the shared resource can beaccessed safely. */
+		*target = u_ref;
+		xSemaphoreGive(controller_params_MUTEX);
+		/* Access to the shared resource is complete, so the mutex is returned. */
+		return XST_SUCCESS;
+	}
+
+	// error getting the mutex
+	xil_printf("\r\nError while retreiving the target voltage.\r\n");
+	return XST_FAILURE;
+}
+
+/// @brief Copies the controller part of a warm-restart snapshot (PID state, gains, reference, output).
+/// Called from the control task, which is the only writer of the PID state.
+/// @return XST_SUCCESS, or XST_FAILURE if the gains or the reference could not be read;
+/// snap is then incomplete and must not be used.
+int getControllerSnapshot(ControlSnapshot_t *snap)
+{
+	// Outside modulation the live state is held at zero, the meaningful one is the resume state.
+	if (previous_control_mode != MODE_MODULATION && resume_valid)
+	{
+		snap->pid = resume_state;
+	}
+	else
+	{
+		snap->pid = controller_state;
+	}
+
+	snap->u_out = u_out_controller;
+	if (getParameters(&snap->kp, &snap->ki, &snap->kd) != XST_SUCCESS ||
+		getTargetVoltage(&snap->u_ref) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+	return XST_SUCCESS;
+}
+
+/// @brief Loads the controller part of a warm-restart snapshot.
+/// Call from the control task or before the scheduler is started.
+void restoreControllerSnapshot(const ControlSnapshot_t *snap)
+{
+	setParameter(PARAM_KP, snap->kp);
+	setParameter(PARAM_KI, snap->ki);
+	setParameter(PARAM_KD, snap->kd);
+	setTargetVoltage(snap->u_ref);
+
+	controller_state = snap->pid;
+	resume_state = snap->pid;
+	resume_valid = true;
+	u_out_controller = snap->u_out;
+}
+
+/// @brief Continues from the state saved when modulation was left.
+/// @param err Current control error.
+static void resumeController(float err)
+{
+	controller_state = resume_state;
+
+	// The plant has moved on while we were away. Restart the error history from the
+	// current error so the D term doesn't kick, the integrator carries the operating point.
+	controller_state.err_prev_1 = err;
+	controller_state.err_prev_2 = err;
+}
+
 /// @brief This function allows for retrieving the data with MUTEXes implemented.
 /// This function allows other tasks to access the controller voltage variable
 float getCurrentControllerVoltage(void){
@@ -294,22 +500,68 @@ void control_task(void *pvParameters){
 	for (;;)
 	{ // Same as while(1) or while(true)
 
-		float u_meas = getPlantOutputVoltage();
+		// Measured voltage from the ADC front-end when it runs, the plant model otherwise.
+		float u_meas;
+		if (!MeasFrontend_GetLatest(&u_meas))
+		{
+			u_meas = getPlantOutputVoltage();
+		}
 		// Reset = 0 (final parameter)
 
 		SystemMode_t current_mode = getSystemMode();
 
+		// Reference for this step: the trajectory sample while a move plays, u_ref otherwise.
+		float u_ref_now = Trajectory_Sample(u_ref);
+
 		if(current_mode == MODE_MODULATION){
+			// Coming back to modulation: resume from where we left off.
+			if (previous_control_mode != MODE_MODULATION && resume_valid)
+			{
+				resumeController(u_ref_now - u_meas);
+			}
+			// Gains for this operating point from the schedule table, or the fixed ones if no table is loaded.
+			PIDGains_t gains;
+			if (GainSchedule_Lookup(u_ref_now, u_meas, &gains) != XST_SUCCESS)
+			{
+				gains.kp = Kp;
+				gains.ki = Ki;
+				gains.kd = Kd;
+			}
+			// Frequency-response analyser: perturb the reference and record the plant voltage.
+			// Only a table read, an add and a buffer write here, 0 when the analyser is off.
+			float u_ref_fra = u_ref_now + FRA_Sample(u_meas);
 			// Call the reentrant PID function, pass it the plant voltage, target voltage, PID parameters and controller state structure
 			// Write the output to the static controller output voltage variable via MUTEX protection.
-			setControllerOutputVoltage(PID_controller(u_meas, u_ref, Kd, Ki, Kp, 0, &controller_state));
+			setControllerOutputVoltage(PID_controller(u_meas, u_ref_fra, gains.kd, gains.ki, gains.kp, 0, &controller_state));
 		} else {
+			// Leaving modulation: keep the state for a bumpless resume.
+			if (previous_control_mode == MODE_MODULATION)
+			{
+				resume_state = controller_state;
+				resume_valid = true;
+			}
 			// IF WE GET OUT OF MODULATION:
 			// ZERO THE SYSTEM!!
 			PID_controller(0,0,0,0,0,1, &controller_state);
 			// ALWAYS FORCE CONTROLLER OUTPUT DIRECTLY TO ZERO!
 			setControllerOutputVoltage(0);
 		}
+		previous_control_mode = current_mode;
+		BootProfile_FirstSample();
+
+		// Every sample to the data logger. Only a block write here, log_task does the I/O.
+		LogSample_t sample = { xLastWakeTime, u_ref_now, u_meas, u_out_controller };
+		if (DataLogger_Record(&sample))
+		{
+			xTaskNotifyGive(log_task_handle);
+		}
+
+		// Refresh the warm-restart snapshot that survives a watchdog reset.
+		if (++i_snapshot >= snapshot_interval)
+		{
+			i_snapshot = 0;
+			Snapshot_Retain();
+		}
 
 		// Print only after print_interval and if modulation print is set as active
 		if ((i_print == print_interval))
@@ -330,7 +582,7 @@ void control_task(void *pvParameters){
 				// Write new controller output value to plant:
 				xil_printf("\rRnd: %d (s) | Tgt: %d (mV) | PI: %d (mV) | Plant: %d (mV)      ",
 						   (int)(xLastWakeTime / 10000),
-						   (int)(u_ref * 1000),
+						   (int)(u_ref_now * 1000),
 						   (int)(u_out_controller * 1000),
 						   (int)(u_meas * 1000));
 				break;
@@ -347,74 +599,3 @@ void control_task(void *pvParameters){
 		vTaskDelayUntil(&xLastWakeTime, xInterval);
 	}
 }
-
-/// @brief This is the PID controller function
-/// @param plant voltage, ref voltage, Kp, Ki, Kd, ref, reset, PID state structure
-/// @return PI controller output
-// This function was refactored couple days before the return to be reentrant and to use the
-// controller state struct to store the state of the controller.
-// This was done due to input from course assistant in a short meeting.
-// Help with the refactoring came from Claude AI, but the implementation is by -R.M.
-float PID_controller(float u_meas, float u_ref, float Kd, float Ki, float Kp, uint32_t reset, PIDControllerState_t *state){
-
-	// If reset command sent, reset all!
-	if(reset){
-		state->err = 0;
-		state->err_prev_1 = 0;
-		state->err_prev_2 = 0;
-		state->yi_prev = 0;
-		state->yp = 0;
-		state->yi = 0;
-		state->yd = 0;
-		state->PI_out = 0;
-	}
-
-	// Saturation limits
-	float u_max = 400.0;
-	float u_min = 0.0;
-
-	state->err = u_ref - u_meas; // Calculate the error value
-
-	// Calculate
-	// YP //
-	state->yp = Kp * state->err;
-	// YI //
-	state->yi = Ki * (h / 2) * (state->err + state->err_prev_1) + state->yi_prev;
-
-	// YD //
-	// Calculate mean for the d to reduce noise.
-	float err_d = ((state->err - state->err_prev_1) + (state->err_prev_1 - state->err_prev_2)) / 2;
-	state->yd = Kd * (err_d) / h;
-
-	// Anti-winding for integrator (https://codepal.ai/code-generator/query/MjweSyOx/pid-regulator-with-anti-windup)
-	if (state->yi > WINDUP_LIMIT)
-	{
-		state->yi = WINDUP_LIMIT;
-	}
-	else if (state->yi < -WINDUP_LIMIT)
-	{
-		state->yi = -WINDUP_LIMIT;
-	}
-
-	float unsat_out = state->yp + state->yi + state->yd;
-
-	// Saturate the output of the controller
-	state->PI_out = unsat_out;
-
-	if (state->PI_out > u_max)
-	{
-		state->PI_out = u_max;
-	}
-	else if (state->PI_out < u_min)
-	{
-		state->PI_out = u_min;
-	}
-
-	// Update the old values
-	state->yi_prev = state->yi;
-	// yd_prev = yd;
-	state->err_prev_2 = state->err_prev_1;
-	state->err_prev_1 = state->err;
-
-	return state->PI_out;
-}
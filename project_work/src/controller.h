@@ -18,18 +18,24 @@
 #include "zynq_registers.h"
 
 #include "system_params.h"
+#include "state_snapshot.h"
 
 void increaseTargetVoltage(float step);
 void decreaseTargetVoltage(float step);
 void setTargetVoltage(float target_voltage);
+int runTargetProfile(const float *targets, const u32 *holds_ms, u32 count);
+void stopTargetProfile(void);
 void increaseParameter(float step);
 void decreaseParameter(float step);
 void setParameter(int param, float target_value);
 void toggleParameter(void);
+int getParameters(float *kp, float *ki, float *kd);
+int getTargetVoltage(float *target);
+int getControllerSnapshot(ControlSnapshot_t *snap);
+void restoreControllerSnapshot(const ControlSnapshot_t *snap);
 
 ConfigParam_t getSelectedParameter(void);
 
 void control_task(void *pvParameters);
-float PID_controller(float u_meas, float u_ref, float Kd, float Ki, float Kp, uint32_t reset, PIDControllerState_t *state);
 void PWM_control(void);
 #endif
@@ -0,0 +1,28 @@
+/**
+ * @file crc32.c
+ * @brief CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320).
+ */
+
+#include "crc32.h"
+
+// Nibble table: 64 bytes instead of 1 KB, plenty fast for records of a few dozen bytes.
+static const u32 crc_table[16] = {
+	0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+	0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+	0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+	0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+u32 Crc32_Update(u32 crc, const void *data, u32 len)
+{
+	const u8 *p = (const u8 *)data;
+
+	crc = ~crc;
+	while (len--)
+	{
+		crc ^= *p++;
+		crc = (crc >> 4) ^ crc_table[crc & 0x0F];
+		crc = (crc >> 4) ^ crc_table[crc & 0x0F];
+	}
+	return ~crc;
+}
@@ -0,0 +1,20 @@
+/**
+ * @file crc32.h
+ * @brief CRC-32 (IEEE 802.3, same as zlib) for checking stored data.
+ */
+
+#ifndef CRC32_H
+#define CRC32_H
+
+#include "xil_types.h"
+
+/// @brief Continues a CRC over more data. Start with crc = 0.
+u32 Crc32_Update(u32 crc, const void *data, u32 len);
+
+/// @brief CRC of one buffer.
+static inline u32 Crc32(const void *data, u32 len)
+{
+	return Crc32_Update(0, data, len);
+}
+
+#endif
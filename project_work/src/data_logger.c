@@ -0,0 +1,272 @@
+/**
+ * @file data_logger.c
+ * @brief Block data logger. See data_logger.h.
+ */
+
+#include "data_logger.h"
+#include "spsc_ring.h"
+#include "crc32.h"
+#include "xtime_l.h"
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+_Static_assert(sizeof(LogBlockHeader_t) == 24, "LogBlockHeader_t is part of the file format");
+_Static_assert(LOG_BLOCK_SIZE % 512 == 0, "LOG_BLOCK_SIZE must be whole SD sectors");
+
+typedef enum {
+	LOG_STOPPED = 0,
+	LOG_RUNNING = 1,
+	LOG_STOPPING = 2,	// Set by DataLogger_Stop, the producer closes its partial block
+	LOG_DRAINING = 3	// Producer done, the flush side writes the rest and closes the backend
+} LogState_t;
+
+static u8 blocks[LOG_BLOCK_COUNT][LOG_BLOCK_SIZE] __attribute__((aligned(32)));
+
+// Block indexes: free ones to the producer, full ones to the flush side. Every block is
+// always in exactly one ring or being filled, so neither push can fail.
+static u32 free_storage[LOG_BLOCK_COUNT];
+static u32 full_storage[LOG_BLOCK_COUNT];
+static SpscRing_t free_ring;
+static SpscRing_t full_ring;
+
+static volatile u32 state = LOG_STOPPED;
+static const LogBackend_t *active_backend = NULL;
+static u32 session;
+
+// Producer side
+static bool filling;
+static u32 fill_block;
+static u8 *fill_ptr;
+static u32 fill_samples;
+static u32 fill_first_tick;
+static u32 next_seq;
+static u32 prev_tick;
+static s32 prev_values[3];
+static volatile u32 recorded;
+static volatile u32 dropped;
+
+// Flush side
+static volatile u32 written;
+static volatile u32 write_errors;
+static u64 payload_bytes;
+static u64 flush_counts;
+
+/// @brief Volts to counts, saturated so NaN or a runaway value can't overflow.
+static s32 quantise(float volts)
+{
+	float counts = volts * LOG_VOLT_SCALE;
+
+	if (!(counts > -2e9f))
+	{
+		counts = -2e9f;
+	}
+	else if (counts > 2e9f)
+	{
+		counts = 2e9f;
+	}
+	return (s32)lrintf(counts);
+}
+
+/// @brief Zigzag varint: small positive and negative deltas both take one byte.
+static u8 *put_varint(u8 *p, s32 value)
+{
+	u32 v = ((u32)value << 1) ^ (u32)(value >> 31);
+
+	while (v >= 0x80)
+	{
+		*p++ = (u8)(v | 0x80);
+		v >>= 7;
+	}
+	*p++ = (u8)v;
+	return p;
+}
+
+static void begin_block(u32 tick)
+{
+	fill_ptr = blocks[fill_block] + sizeof(LogBlockHeader_t);
+	fill_samples = 0;
+	fill_first_tick = tick;
+	prev_tick = tick;
+	memset(prev_values, 0, sizeof(prev_values));
+	filling = true;
+}
+
+static void finish_block(void)
+{
+	u8 *block = blocks[fill_block];
+	LogBlockHeader_t header;
+
+	header.magic = LOG_BLOCK_MAGIC;
+	header.session = session;
+	header.seq = next_seq++;
+	header.first_tick = fill_first_tick;
+	header.samples = (u16)fill_samples;
+	header.bytes = (u16)(fill_ptr - block - sizeof(LogBlockHeader_t));
+	header.crc = Crc32_Update(Crc32(&header, offsetof(LogBlockHeader_t, crc)), block + sizeof(LogBlockHeader_t), header.bytes);
+	memcpy(block, &header, sizeof(header));
+
+	SpscRing_Push(&full_ring, &fill_block);
+	filling = false;
+}
+
+int DataLogger_Start(const LogBackend_t *backend)
+{
+	XTime now;
+
+	if (__atomic_load_n(&state, __ATOMIC_ACQUIRE) != LOG_STOPPED)
+	{
+		return XST_FAILURE;
+	}
+	if (backend->open() != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+
+	SpscRing_Init(&free_ring, free_storage, LOG_BLOCK_COUNT, sizeof(u32));
+	SpscRing_Init(&full_ring, full_storage, LOG_BLOCK_COUNT, sizeof(u32));
+	for (u32 i = 0; i < LOG_BLOCK_COUNT; i++)
+	{
+		SpscRing_Push(&free_ring, &i);
+	}
+
+	XTime_GetTime(&now);
+	session = (u32)now ^ (u32)(now >> 32);
+	filling = false;
+	next_seq = 0;
+	recorded = 0;
+	dropped = 0;
+	written = 0;
+	write_errors = 0;
+	payload_bytes = 0;
+	flush_counts = 0;
+	active_backend = backend;
+
+	// Release: the producer sees the rings set up once it sees RUNNING.
+	__atomic_store_n(&state, LOG_RUNNING, __ATOMIC_RELEASE);
+	return XST_SUCCESS;
+}
+
+void DataLogger_Stop(void)
+{
+	u32 expected = LOG_RUNNING;
+	__atomic_compare_exchange_n(&state, &expected, LOG_STOPPING, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+bool DataLogger_Active(void)
+{
+	return __atomic_load_n(&state, __ATOMIC_ACQUIRE) != LOG_STOPPED;
+}
+
+bool DataLogger_Record(const LogSample_t *sample)
+{
+	u32 current = __atomic_load_n(&state, __ATOMIC_ACQUIRE);
+
+	if (current == LOG_STOPPING)
+	{
+		if (filling)
+		{
+			finish_block();
+		}
+		__atomic_store_n(&state, LOG_DRAINING, __ATOMIC_RELEASE);
+		return true;
+	}
+	if (current != LOG_RUNNING)
+	{
+		return false;
+	}
+
+	if (!filling)
+	{
+		if (!SpscRing_Pop(&free_ring, &fill_block))
+		{
+			// log_task is behind and every block is waiting to be written.
+			dropped++;
+			return false;
+		}
+		begin_block(sample->tick);
+	}
+
+	const s32 values[3] = { quantise(sample->u_ref), quantise(sample->u_meas), quantise(sample->u_out) };
+
+	fill_ptr = put_varint(fill_ptr, (s32)(sample->tick - prev_tick));
+	for (u32 i = 0; i < 3; i++)
+	{
+		fill_ptr = put_varint(fill_ptr, (s32)((u32)values[i] - (u32)prev_values[i]));
+		prev_values[i] = values[i];
+	}
+	prev_tick = sample->tick;
+	fill_samples++;
+	recorded++;
+
+	if (fill_ptr + LOG_SAMPLE_MAX_BYTES > blocks[fill_block] + LOG_BLOCK_SIZE)
+	{
+		finish_block();
+		return true;
+	}
+	return false;
+}
+
+u32 DataLogger_Flush(void)
+{
+	// Read before draining: DRAINING is set after the last block was handed over.
+	u32 current = __atomic_load_n(&state, __ATOMIC_ACQUIRE);
+	u32 block;
+	u32 count = 0;
+
+	while (SpscRing_Pop(&full_ring, &block))
+	{
+		XTime t0, t1;
+		LogBlockHeader_t header;
+
+		XTime_GetTime(&t0);
+		memcpy(&header, blocks[block], sizeof(header));
+		if (active_backend->write(blocks[block], LOG_BLOCK_SIZE) == XST_SUCCESS)
+		{
+			written++;
+			payload_bytes += header.bytes;
+		}
+		else
+		{
+			write_errors++;
+		}
+		XTime_GetTime(&t1);
+		flush_counts += t1 - t0;
+
+		SpscRing_Push(&free_ring, &block);
+		count++;
+	}
+
+	if (current == LOG_DRAINING)
+	{
+		active_backend->close();
+		__atomic_store_n(&state, LOG_STOPPED, __ATOMIC_RELEASE);
+	}
+	return count;
+}
+
+void DataLogger_GetStats(LogStats_t *stats)
+{
+	stats->samples = recorded;
+	stats->dropped = dropped;
+	stats->blocks = written;
+	stats->write_errors = write_errors;
+	stats->payload_bytes = payload_bytes;
+	stats->flush_counts = flush_counts;
+	stats->running = DataLogger_Active();
+}
+
+/// @brief This is the logger task. Low priority, woken by control_task for every full block.
+void log_task(void *pvParameters)
+{
+	for (;;)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		DataLogger_Flush();
+	}
+}
@@ -0,0 +1,93 @@
+/**
+ * @file data_logger.h
+ * @brief Block data logger: every control sample, compressed, flushed in the background.
+ *
+ * control_task hands each sample to DataLogger_Record(). Samples are delta coded
+ * against the previous one (voltages quantised to LOG_VOLT_SCALE counts per volt)
+ * and written as zigzag varints into one of LOG_BLOCK_COUNT preallocated blocks.
+ * A full block goes to log_task through an SpscRing and the producer carries on in
+ * the next free one; if none is free the sample is dropped and counted, the producer
+ * never waits. log_task writes full blocks to a LogBackend_t: raw SD card sectors on
+ * the target (log_backend_sd.c), a plain file on Linux (host/log_backend_file.c).
+ *
+ * Every block starts with a CRC'd header, and the first sample of a block is coded
+ * against the header's first_tick and zero volts, so blocks decode on their own.
+ * See log_reader.h for the reading side.
+ */
+
+#ifndef DATA_LOGGER_H
+#define DATA_LOGGER_H
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include <stdbool.h>
+
+#define LOG_BLOCK_SIZE			4096		// Bytes, a multiple of the 512 byte SD sector
+#define LOG_BLOCK_COUNT			16			// Preallocated blocks, power of two
+#define LOG_BLOCK_MAGIC			0x4C4F4731	// "LOG1", bump when the coding changes
+#define LOG_VOLT_SCALE			10000.0f	// Counts per volt, 0.1 mV resolution
+#define LOG_SAMPLE_MAX_BYTES	20			// Four 5 byte varints
+
+typedef struct {
+	u32 tick;		// FreeRTOS tick of the control step
+	float u_ref;
+	float u_meas;
+	float u_out;	// Controller output
+} LogSample_t;
+
+typedef struct {
+	u32 magic;
+	u32 session;	// Differs per DataLogger_Start, tells runs apart on a raw card
+	u32 seq;		// Block number within the session
+	u32 first_tick;
+	u16 samples;
+	u16 bytes;		// Payload bytes used
+	u32 crc;		// CRC-32 of the header up to here and the used payload
+} LogBlockHeader_t;
+
+#define LOG_PAYLOAD_SIZE		(LOG_BLOCK_SIZE - sizeof(LogBlockHeader_t))
+#define LOG_MAX_BLOCK_SAMPLES	(LOG_PAYLOAD_SIZE / 4)	// At least one byte per field
+
+// Where full blocks go. write always gets LOG_BLOCK_SIZE bytes.
+typedef struct {
+	const char *name;
+	int (*open)(void);
+	int (*write)(const void *block, u32 len);
+	int (*close)(void);
+} LogBackend_t;
+
+typedef struct {
+	u32 samples;			// Recorded
+	u32 dropped;			// Lost because no block was free
+	u32 blocks;				// Written to the backend
+	u32 write_errors;
+	u64 payload_bytes;		// Compressed sample bytes in written blocks
+	u64 flush_counts;		// XTime counts spent in backend writes
+	bool running;
+} LogStats_t;
+
+/// @brief Opens the backend and starts recording with the next DataLogger_Record().
+/// @return XST_FAILURE if already running or the backend fails to open.
+int DataLogger_Start(const LogBackend_t *backend);
+
+/// @brief Stops recording. The producer closes the partial block on its next call and
+/// the flush side closes the backend once everything is written.
+void DataLogger_Stop(void);
+
+/// @brief true from DataLogger_Start until the backend has been closed.
+bool DataLogger_Active(void);
+
+/// @brief Producer side, from control_task. Never blocks.
+/// @return true when a block was handed over, i.e. log_task should be woken.
+bool DataLogger_Record(const LogSample_t *sample);
+
+/// @brief Flush side: writes all full blocks to the backend.
+/// @return Number of blocks written.
+u32 DataLogger_Flush(void);
+
+void DataLogger_GetStats(LogStats_t *stats);
+
+/// @brief Logger task: woken by control_task for every full block.
+void log_task(void *pvParameters);
+
+#endif
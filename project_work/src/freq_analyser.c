@@ -0,0 +1,317 @@
+/**
+ * @file freq_analyser.c
+ * @brief Online frequency-response analyser. See freq_analyser.h.
+ */
+
+#include "freq_analyser.h"
+#include "arm_math.h"
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "xil_printf.h"
+#include <math.h>
+
+// How often the background task looks for a full block. A block takes about a second.
+#define FRA_POLL_INTERVAL_MS	100
+
+// Tone bins, roughly log spaced. Exact bins of the block, so every tone has a whole
+// number of periods per block and there's no leakage between them.
+static const u16 tone_bins[FRA_MAX_TONES] = { 1, 2, 3, 5, 8, 12, 18, 27, 40, 60, 90, 135, 200 };
+
+typedef enum {
+	FRA_STOPPED = 0,
+	FRA_STARTING = 1,	// Set by FRA_Start, picked up by the control task
+	FRA_RUNNING = 2
+} FraState_t;
+
+// One period of the excitation. Written only while stopped.
+static float excitation[FRA_BLOCK_SIZE];
+static float fra_sample_rate;
+
+// Plant voltage, ping-pong. The control task fills one while the other is processed.
+static float response[2][FRA_BLOCK_SIZE];
+static u32 response_generation[2];
+
+static volatile u32 state = FRA_STOPPED;
+static volatile u32 generation = 0;		// +1 per start, so old blocks can be told apart
+static volatile s32 ready_block = -1;	// Block waiting for processing, -1 if none
+static volatile u32 overruns = 0;
+
+// Control task side
+static u32 sample_index;
+static u32 fill_block;
+
+// Background side
+typedef struct {
+	float re;
+	float im;
+} Complex_t;
+
+static u32 processed_generation;
+static u32 settle_left;
+static u32 averaged_blocks;
+static Complex_t excitation_bins[FRA_MAX_TONES];
+static Complex_t response_sums[FRA_MAX_TONES];
+
+/// @brief Goertzel: one DFT bin of a block, O(N) per bin.
+/// @param offset Subtracted from every sample. The plant voltage sits on a large DC level
+/// that would otherwise swamp the low bins through rounding of the single precision filter.
+static Complex_t goertzel(const float *x, float offset, u32 bin)
+{
+	float w = 2.0f * PI * (float)bin / FRA_BLOCK_SIZE;
+	float c = arm_cos_f32(w);
+	float coeff = 2.0f * c;
+	float s1 = 0;
+	float s2 = 0;
+	Complex_t out;
+
+	for (u32 n = 0; n < FRA_BLOCK_SIZE; n++)
+	{
+		float s = (x[n] - offset) + coeff * s1 - s2;
+		s2 = s1;
+		s1 = s;
+	}
+
+	// Same phase reference for every block, which is all the Y / D ratio needs.
+	out.re = s1 - s2 * c;
+	out.im = s2 * arm_sin_f32(w);
+	return out;
+}
+
+static Complex_t complex_div(Complex_t a, Complex_t b)
+{
+	float d = b.re * b.re + b.im * b.im;
+	Complex_t out = { (a.re * b.re + a.im * b.im) / d, (a.im * b.re - a.re * b.im) / d };
+	return out;
+}
+
+static float mag_db(Complex_t a)
+{
+	return 10.0f * log10f(a.re * a.re + a.im * a.im);
+}
+
+static float phase_deg(Complex_t a)
+{
+	return atan2f(a.im, a.re) * (180.0f / PI);
+}
+
+int FRA_Start(float amplitude, float sample_rate)
+{
+	if (!(amplitude > 0) || !(sample_rate > 0))
+	{
+		return XST_FAILURE;
+	}
+
+	// Stop first: the control task doesn't read the table while stopped.
+	__atomic_store_n(&state, FRA_STOPPED, __ATOMIC_RELEASE);
+
+	// Schroeder phases keep the crest factor low, so the sum of tones stays
+	// close to sqrt(2 * tones) times one tone instead of tones times.
+	for (u32 n = 0; n < FRA_BLOCK_SIZE; n++)
+	{
+		float sum = 0;
+		for (u32 k = 0; k < FRA_MAX_TONES; k++)
+		{
+			float phase = -PI * (float)(k * (k + 1)) / FRA_MAX_TONES;
+			float angle = 2.0f * PI * (float)((tone_bins[k] * n) % FRA_BLOCK_SIZE) / FRA_BLOCK_SIZE + phase;
+			sum += arm_cos_f32(angle);
+		}
+		excitation[n] = amplitude * sum;
+	}
+	fra_sample_rate = sample_rate;
+
+	__atomic_store_n(&generation, generation + 1, __ATOMIC_RELEASE);
+	__atomic_store_n(&state, FRA_STARTING, __ATOMIC_RELEASE);
+	return XST_SUCCESS;
+}
+
+void FRA_Stop(void)
+{
+	__atomic_store_n(&state, FRA_STOPPED, __ATOMIC_RELEASE);
+}
+
+bool FRA_Running(void)
+{
+	return __atomic_load_n(&state, __ATOMIC_ACQUIRE) != FRA_STOPPED;
+}
+
+float FRA_Sample(float u_meas)
+{
+	u32 current = __atomic_load_n(&state, __ATOMIC_ACQUIRE);
+
+	if (current == FRA_STOPPED)
+	{
+		return 0;
+	}
+	if (current == FRA_STARTING)
+	{
+		sample_index = 0;
+		fill_block = 0;
+		response_generation[0] = generation;
+		response_generation[1] = generation;
+		__atomic_store_n(&state, FRA_RUNNING, __ATOMIC_RELEASE);
+	}
+
+	response[fill_block][sample_index] = u_meas;
+	float d = excitation[sample_index];
+
+	if (++sample_index == FRA_BLOCK_SIZE)
+	{
+		sample_index = 0;
+		// Hand the block over unless the previous one is still waiting, then overwrite this one again.
+		if (__atomic_load_n(&ready_block, __ATOMIC_ACQUIRE) < 0)
+		{
+			__atomic_store_n(&ready_block, (s32)fill_block, __ATOMIC_RELEASE);
+			fill_block ^= 1;
+			response_generation[fill_block] = generation;
+		}
+		else
+		{
+			overruns++;
+		}
+	}
+	return d;
+}
+
+/// @brief Crossover and phase margin from the loop gain, interpolated between the tones.
+static void find_margin(FraResult_t *result)
+{
+	result->crossover_freq = 0;
+	result->phase_margin_deg = 0;
+
+	for (u32 k = 0; k + 1 < result->tone_count; k++)
+	{
+		const FraPoint_t *a = &result->points[k];
+		const FraPoint_t *b = &result->points[k + 1];
+
+		if (a->l_mag_db >= 0 && b->l_mag_db < 0)
+		{
+			float t = a->l_mag_db / (a->l_mag_db - b->l_mag_db);
+			float dphase = b->l_phase_deg - a->l_phase_deg;
+			if (dphase > 180.0f)
+			{
+				dphase -= 360.0f;
+			}
+			else if (dphase < -180.0f)
+			{
+				dphase += 360.0f;
+			}
+
+			float phase = a->l_phase_deg + t * dphase;
+			if (phase > 0)
+			{
+				phase -= 360.0f;
+			}
+
+			result->crossover_freq = expf(logf(a->freq) + t * (logf(b->freq) - logf(a->freq)));
+			result->phase_margin_deg = 180.0f + phase;
+			return;
+		}
+	}
+}
+
+bool FRA_Process(FraResult_t *result)
+{
+	s32 block = __atomic_load_n(&ready_block, __ATOMIC_ACQUIRE);
+
+	if (block < 0)
+	{
+		return false;
+	}
+
+	// New start: reference bins of the new excitation, drop the transient.
+	if (response_generation[block] != processed_generation)
+	{
+		processed_generation = response_generation[block];
+		settle_left = FRA_SETTLE_BLOCKS;
+		averaged_blocks = 0;
+		for (u32 k = 0; k < FRA_MAX_TONES; k++)
+		{
+			excitation_bins[k] = goertzel(excitation, 0, tone_bins[k]);
+			response_sums[k].re = 0;
+			response_sums[k].im = 0;
+		}
+	}
+
+	if (settle_left > 0)
+	{
+		settle_left--;
+	}
+	else
+	{
+		float mean;
+		arm_mean_f32(response[block], FRA_BLOCK_SIZE, &mean);
+
+		for (u32 k = 0; k < FRA_MAX_TONES; k++)
+		{
+			// The excitation is periodic in the block, so the bins add up coherently.
+			Complex_t y = goertzel(response[block], mean, tone_bins[k]);
+			response_sums[k].re += y.re;
+			response_sums[k].im += y.im;
+		}
+		averaged_blocks++;
+	}
+
+	// Block done, the control task may hand over the next one.
+	__atomic_store_n(&ready_block, -1, __ATOMIC_RELEASE);
+
+	if (averaged_blocks < FRA_AVERAGE_BLOCKS)
+	{
+		return false;
+	}
+
+	result->tone_count = FRA_MAX_TONES;
+	result->blocks = averaged_blocks;
+	result->overruns = overruns;
+	for (u32 k = 0; k < FRA_MAX_TONES; k++)
+	{
+		Complex_t y = { response_sums[k].re / averaged_blocks, response_sums[k].im / averaged_blocks };
+		Complex_t t = complex_div(y, excitation_bins[k]);
+		Complex_t one_minus_t = { 1.0f - t.re, -t.im };
+		Complex_t l = complex_div(t, one_minus_t);	// Unity feedback: T = L / (1 + L)
+		FraPoint_t *p = &result->points[k];
+
+		p->freq = (float)tone_bins[k] * fra_sample_rate / FRA_BLOCK_SIZE;
+		p->t_mag_db = mag_db(t);
+		p->t_phase_deg = phase_deg(t);
+		p->l_mag_db = mag_db(l);
+		p->l_phase_deg = phase_deg(l);
+
+		response_sums[k].re = 0;
+		response_sums[k].im = 0;
+	}
+	averaged_blocks = 0;
+
+	find_margin(result);
+	return true;
+}
+
+/// @brief This is the analyser background task. Keeps all processing out of the control loop.
+void fra_task(void *pvParameters)
+{
+	static FraResult_t result;
+
+	for (;;)
+	{
+		if (FRA_Process(&result))
+		{
+			// Streamed as CSV: frequency in mHz, magnitude in mdB, phase in millidegrees.
+			xil_printf("\r\nFRA,f_mHz,T_mdB,T_mdeg,L_mdB,L_mdeg\r\n");
+			for (u32 k = 0; k < result.tone_count; k++)
+			{
+				const FraPoint_t *p = &result.points[k];
+				xil_printf("FRA,%d,%d,%d,%d,%d\r\n",
+						   (int)(p->freq * 1000),
+						   (int)(p->t_mag_db * 1000), (int)(p->t_phase_deg * 1000),
+						   (int)(p->l_mag_db * 1000), (int)(p->l_phase_deg * 1000));
+			}
+			xil_printf("FRA crossover: %d mHz | phase margin: %d mdeg | blocks: %d | overruns: %d\r\n",
+					   (int)(result.crossover_freq * 1000), (int)(result.phase_margin_deg * 1000),
+					   (int)result.blocks, (int)result.overruns);
+		}
+
+		vTaskDelay(pdMS_TO_TICKS(FRA_POLL_INTERVAL_MS));
+	}
+}
@@ -0,0 +1,66 @@
+/**
+ * @file freq_analyser.h
+ * @brief Online frequency-response analyser for the voltage loop.
+ *
+ * A multisine (Schroeder phased tones on exact bins of a FRA_BLOCK_SIZE sample
+ * period) is added to the reference in control_task, and the plant voltage is
+ * written to a ping-pong buffer. That is all the 1 ms loop does: a table read, an
+ * add and a buffer write. A background task runs Goertzel on the tone bins of every
+ * full block, averages FRA_AVERAGE_BLOCKS periods coherently and streams the closed
+ * loop response T = Y / D and the loop gain L = T / (1 - T) per frequency, plus the
+ * crossover frequency and phase margin read from L.
+ */
+
+#ifndef FREQ_ANALYSER_H
+#define FREQ_ANALYSER_H
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include <stdbool.h>
+
+#define FRA_BLOCK_SIZE		1024	// Samples per excitation period (1.024 s at 1 kHz)
+#define FRA_MAX_TONES		13
+#define FRA_AVERAGE_BLOCKS	4		// Periods averaged per result
+#define FRA_SETTLE_BLOCKS	1		// Periods dropped after a start
+
+typedef struct {
+	float freq;			// Hz
+	float t_mag_db;		// Closed loop, reference to plant voltage
+	float t_phase_deg;
+	float l_mag_db;		// Loop gain
+	float l_phase_deg;
+} FraPoint_t;
+
+typedef struct {
+	u32 tone_count;
+	FraPoint_t points[FRA_MAX_TONES];
+	float crossover_freq;	// Hz where |L| crosses 0 dB, 0 if not within the tones
+	float phase_margin_deg;
+	u32 blocks;				// Periods averaged
+	u32 overruns;			// Full blocks dropped because the previous one wasn't processed yet
+} FraResult_t;
+
+/// @brief Builds the excitation and starts injecting it (only in modulation mode).
+/// @param amplitude Peak amplitude of each tone in volts.
+/// @param sample_rate Control loop rate in Hz.
+/// @return XST_FAILURE if the amplitude is not positive.
+int FRA_Start(float amplitude, float sample_rate);
+
+/// @brief Stops the injection. The reference is unperturbed from the next sample on.
+void FRA_Stop(void);
+
+/// @brief true while the excitation is being injected.
+bool FRA_Running(void);
+
+/// @brief Control task side: records the plant voltage and returns the perturbation to add
+/// to the reference. Returns 0 when stopped.
+float FRA_Sample(float u_meas);
+
+/// @brief Background side: processes a full block if one is waiting.
+/// @return true when a new averaged result is available in *result.
+bool FRA_Process(FraResult_t *result);
+
+/// @brief Background task: calls FRA_Process and streams the results over UART.
+void fra_task(void *pvParameters);
+
+#endif
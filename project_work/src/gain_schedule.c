@@ -0,0 +1,212 @@
+/**
+ * @file gain_schedule.c
+ * @brief Gain-scheduling table. See gain_schedule.h.
+ */
+
+#include "gain_schedule.h"
+#include <stddef.h>
+
+// One segment of a 1-D table: gains at the left grid point and the change to the next one.
+typedef struct {
+	PIDGains_t base;
+	PIDGains_t slope;	// Per grid step
+} GainSegment_t;
+
+typedef struct {
+	GainScheduleGrid_t grid;
+	float inv_x_step;
+	float inv_y_step;
+
+	// Raw points as loaded, [ny][nx] for 2-D.
+	float kp[GAIN_SCHEDULE_MAX_POINTS];
+	float ki[GAIN_SCHEDULE_MAX_POINTS];
+	float kd[GAIN_SCHEDULE_MAX_POINTS];
+
+	GainSegment_t segments[GAIN_SCHEDULE_MAX_AXIS];	// 1-D, the last one has zero slope
+} GainTable_t;
+
+// Double buffer: the control task reads *active, loads go to the other one.
+static GainTable_t tables[2];
+static GainTable_t *active = NULL;
+static GainTable_t *staging = NULL;
+static u32 staged_points;
+
+static u32 point_count(const GainScheduleGrid_t *grid)
+{
+	return grid->nx * grid->ny;
+}
+
+/// @brief Cell of grid index t on an axis of n >= 2 points: i in [0, n - 2] and frac in [0, 1].
+/// Beyond the last point this is the last cell with frac = 1, i.e. exactly the last point.
+static void grid_cell(float t, u32 n, u32 *i, float *frac)
+{
+	const float last = (float)(n - 1);
+
+	t = (t < 0.0f) ? 0.0f : (t > last) ? last : t;
+	*i = (u32)t;
+	if (*i > n - 2)
+	{
+		*i = n - 2;
+	}
+	*frac = t - (float)*i;
+}
+
+/// @brief Bilinear interpolation of a [ny][nx] plane in cell (i, j).
+static float bilinear(const float *plane, u32 nx, u32 i, u32 j, float fx, float fy)
+{
+	const float *p0 = plane + j * nx + i;
+	const float *p1 = p0 + nx;
+	// Weights (1 - f, f): exactly the grid point at f = 0 and at f = 1
+	float row0 = p0[0] * (1.0f - fx) + p0[1] * fx;
+	float row1 = p1[0] * (1.0f - fx) + p1[1] * fx;
+
+	return row0 * (1.0f - fy) + row1 * fy;
+}
+
+int GainSchedule_Begin(const GainScheduleGrid_t *grid)
+{
+	GainTable_t *current = __atomic_load_n(&active, __ATOMIC_ACQUIRE);
+	GainScheduleGrid_t checked = *grid;
+
+	if (checked.axis != SCHEDULE_AXIS_BOTH)
+	{
+		checked.ny = 1;
+	}
+	if (checked.axis > SCHEDULE_AXIS_BOTH || !(checked.x_step > 0) ||
+		checked.nx < 2 || checked.nx > GAIN_SCHEDULE_MAX_AXIS ||
+		(checked.axis == SCHEDULE_AXIS_BOTH && (!(checked.y_step > 0) || checked.ny < 2 || checked.ny > GAIN_SCHEDULE_MAX_AXIS)) ||
+		point_count(&checked) > GAIN_SCHEDULE_MAX_POINTS)
+	{
+		staging = NULL;
+		return XST_FAILURE;
+	}
+
+	staging = (current == &tables[0]) ? &tables[1] : &tables[0];
+	staging->grid = checked;
+	staged_points = 0;
+	return XST_SUCCESS;
+}
+
+int GainSchedule_AddPoint(const PIDGains_t *gains)
+{
+	if (staging == NULL || staged_points >= point_count(&staging->grid))
+	{
+		return XST_FAILURE;
+	}
+
+	staging->kp[staged_points] = gains->kp;
+	staging->ki[staged_points] = gains->ki;
+	staging->kd[staged_points] = gains->kd;
+	staged_points++;
+	return XST_SUCCESS;
+}
+
+int GainSchedule_Commit(void)
+{
+	GainTable_t *table = staging;
+
+	if (table == NULL || staged_points != point_count(&table->grid))
+	{
+		return XST_FAILURE;
+	}
+
+	table->inv_x_step = 1.0f / table->grid.x_step;
+	table->inv_y_step = (table->grid.axis == SCHEDULE_AXIS_BOTH) ? 1.0f / table->grid.y_step : 0.0f;
+
+	if (table->grid.axis != SCHEDULE_AXIS_BOTH)
+	{
+		u32 last = table->grid.nx - 1;
+
+		for (u32 i = 0; i < table->grid.nx; i++)
+		{
+			GainSegment_t *seg = &table->segments[i];
+			u32 next = (i < last) ? i + 1 : i;
+
+			seg->base.kp = table->kp[i];
+			seg->base.ki = table->ki[i];
+			seg->base.kd = table->kd[i];
+			seg->slope.kp = table->kp[next] - table->kp[i];
+			seg->slope.ki = table->ki[next] - table->ki[i];
+			seg->slope.kd = table->kd[next] - table->kd[i];
+		}
+	}
+
+	staging = NULL;
+	__atomic_store_n(&active, table, __ATOMIC_RELEASE);
+	return XST_SUCCESS;
+}
+
+void GainSchedule_Abort(void)
+{
+	staging = NULL;
+}
+
+void GainSchedule_Disable(void)
+{
+	__atomic_store_n(&active, (GainTable_t *)NULL, __ATOMIC_RELEASE);
+}
+
+int GainSchedule_GetGrid(GainScheduleGrid_t *grid)
+{
+	GainTable_t *table = __atomic_load_n(&active, __ATOMIC_ACQUIRE);
+
+	if (table == NULL)
+	{
+		return XST_FAILURE;
+	}
+	*grid = table->grid;
+	return XST_SUCCESS;
+}
+
+int GainSchedule_Lookup(float u_ref, float u_meas, PIDGains_t *gains)
+{
+	const GainTable_t *table = __atomic_load_n(&active, __ATOMIC_ACQUIRE);
+
+	if (table == NULL)
+	{
+		return XST_FAILURE;
+	}
+
+	if (table->grid.axis == SCHEDULE_AXIS_BOTH)
+	{
+		const u32 nx = table->grid.nx;
+		u32 i, j;
+		float fx, fy;
+
+		grid_cell((u_ref - table->grid.x0) * table->inv_x_step, nx, &i, &fx);
+		grid_cell((u_meas - table->grid.y0) * table->inv_y_step, table->grid.ny, &j, &fy);
+
+		gains->kp = bilinear(table->kp, nx, i, j, fx, fy);
+		gains->ki = bilinear(table->ki, nx, i, j, fx, fy);
+		gains->kd = bilinear(table->kd, nx, i, j, fx, fy);
+		return XST_SUCCESS;
+	}
+
+	float v = (table->grid.axis == SCHEDULE_AXIS_REF) ? u_ref : u_meas;
+	float t = (v - table->grid.x0) * table->inv_x_step;
+	u32 last = table->grid.nx - 1;
+	u32 i;
+	float frac;
+
+	if (t <= 0.0f)
+	{
+		i = 0;
+		frac = 0.0f;
+	}
+	else if (t >= (float)last)
+	{
+		i = last;
+		frac = 0.0f;
+	}
+	else
+	{
+		i = (u32)t;
+		frac = t - (float)i;
+	}
+
+	const GainSegment_t *seg = &table->segments[i];
+	gains->kp = seg->base.kp + seg->slope.kp * frac;
+	gains->ki = seg->base.ki + seg->slope.ki * frac;
+	gains->kd = seg->base.kd + seg->slope.kd * frac;
+	return XST_SUCCESS;
+}
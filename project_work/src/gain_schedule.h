@@ -0,0 +1,77 @@
+/**
+ * @file gain_schedule.h
+ * @brief Gain-scheduling table: PID gains interpolated per operating point.
+ *
+ * The table is a uniform grid over the reference voltage, the measured voltage, or
+ * both. 1-D tables store a precomputed slope per segment, so a lookup is one index
+ * computation and three multiply-adds. 2-D tables interpolate bilinearly in the grid
+ * cell of the point, with the grid steps inverted at load time, so no division is left
+ * in the lookup. Points outside the grid take the gains of the nearest edge, the last
+ * grid point included.
+ *
+ * Loading is a transaction: GainSchedule_Begin(), one GainSchedule_AddPoint() per grid
+ * point, then GainSchedule_Commit(). The new table is built in a second buffer and
+ * published with a single pointer store, so the control task always sees either the
+ * old or the new table, never a mix.
+ */
+
+#ifndef GAIN_SCHEDULE_H
+#define GAIN_SCHEDULE_H
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include <stdbool.h>
+
+#define GAIN_SCHEDULE_MAX_AXIS		16	// Points along one axis
+#define GAIN_SCHEDULE_MAX_POINTS	64	// Points in the whole table (e.g. 8 x 8)
+
+typedef enum {
+	SCHEDULE_AXIS_REF = 0,		// 1-D, indexed by the reference voltage
+	SCHEDULE_AXIS_MEAS = 1,		// 1-D, indexed by the measured voltage
+	SCHEDULE_AXIS_BOTH = 2		// 2-D, columns by reference, rows by measured voltage
+} ScheduleAxis_t;
+
+typedef struct {
+	float kp;
+	float ki;
+	float kd;
+} PIDGains_t;
+
+typedef struct {
+	ScheduleAxis_t axis;
+	float x0;		// First grid point of the reference axis (or the only axis for 1-D)
+	float x_step;	// Grid step in volts, > 0
+	u32 nx;			// Number of points, 2..GAIN_SCHEDULE_MAX_AXIS
+	float y0;		// Measured voltage axis, 2-D only
+	float y_step;
+	u32 ny;			// 1 for 1-D tables
+} GainScheduleGrid_t;
+
+/// @brief Starts loading a new table. Any unfinished load is discarded.
+/// @return XST_FAILURE if the grid is invalid.
+int GainSchedule_Begin(const GainScheduleGrid_t *grid);
+
+/// @brief Adds the next grid point. 2-D points go row by row (measured voltage), reference fastest.
+/// @return XST_FAILURE if no load is open or the table is already full.
+int GainSchedule_AddPoint(const PIDGains_t *gains);
+
+/// @brief Checks that every point was given, precomputes the slopes and makes the table active.
+/// @return XST_FAILURE if the load is incomplete.
+int GainSchedule_Commit(void);
+
+/// @brief Drops an unfinished load, the active table is kept.
+void GainSchedule_Abort(void);
+
+/// @brief Goes back to the fixed Kp / Ki / Kd gains.
+void GainSchedule_Disable(void);
+
+/// @brief Copies the grid of the active table.
+/// @return XST_FAILURE if no table is active.
+int GainSchedule_GetGrid(GainScheduleGrid_t *grid);
+
+/// @brief Interpolates the gains for an operating point. Inputs outside the grid are clamped.
+/// Safe to call from the control task while a new table is being loaded.
+/// @return XST_FAILURE if no table is active (gains untouched).
+int GainSchedule_Lookup(float u_ref, float u_meas, PIDGains_t *gains);
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * @file log_backend_sd.c
+ * @brief SD card backend for the data logger. See log_backend_sd.h.
+ */
+
+#include "log_backend_sd.h"
+#include "xsdps.h"
+#include "xparameters.h"
+
+#define LOG_SD_BLOCK_SECTORS	(LOG_BLOCK_SIZE / XSDPS_BLK_SIZE_512_MASK)
+
+static XSdPs sd;
+static bool sd_ready = false;
+static u32 next_sector;
+
+static int sd_open(void)
+{
+	if (!sd_ready)
+	{
+		XSdPs_Config *config = XSdPs_LookupConfig(XPAR_XSDPS_0_DEVICE_ID);
+
+		if (config == NULL ||
+			XSdPs_CfgInitialize(&sd, config, config->BaseAddress) != XST_SUCCESS ||
+			XSdPs_CardInitialize(&sd) != XST_SUCCESS)
+		{
+			return XST_FAILURE;
+		}
+		sd_ready = true;
+	}
+
+	if (sd.SectorCount < LOG_SD_FIRST_SECTOR + LOG_SD_SECTOR_COUNT)
+	{
+		return XST_FAILURE;
+	}
+	next_sector = LOG_SD_FIRST_SECTOR;
+	return XST_SUCCESS;
+}
+
+static int sd_write(const void *block, u32 len)
+{
+	(void)len;
+
+	if (next_sector + LOG_SD_BLOCK_SECTORS > LOG_SD_FIRST_SECTOR + LOG_SD_SECTOR_COUNT)
+	{
+		return XST_FAILURE;
+	}
+
+	// Standard capacity cards are byte addressed, SDHC / SDXC by sector.
+	u32 address = sd.HCS ? next_sector : next_sector * XSDPS_BLK_SIZE_512_MASK;
+	if (XSdPs_WritePolled(&sd, address, LOG_SD_BLOCK_SECTORS, (const u8 *)block) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+	next_sector += LOG_SD_BLOCK_SECTORS;
+	return XST_SUCCESS;
+}
+
+static int sd_close(void)
+{
+	return XST_SUCCESS;
+}
+
+const LogBackend_t LogBackendSd = {
+	"SD card",
+	sd_open,
+	sd_write,
+	sd_close
+};
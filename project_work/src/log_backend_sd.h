@@ -0,0 +1,20 @@
+/**
+ * @file log_backend_sd.h
+ * @brief SD card backend for the data logger: whole blocks to a raw sector region.
+ *
+ * Every DataLogger_Start writes from the start of the region again. Keep the region
+ * clear of the card's partitions (the boot partition sits well below 1 GB); read it
+ * back with e.g. dd skip=LOG_SD_FIRST_SECTOR and host/log_dump.
+ */
+
+#ifndef LOG_BACKEND_SD_H
+#define LOG_BACKEND_SD_H
+
+#include "data_logger.h"
+
+#define LOG_SD_FIRST_SECTOR		0x200000	// 1 GB into the card
+#define LOG_SD_SECTOR_COUNT		0x200000	// 1 GB, about 5 h at 10 kHz
+
+extern const LogBackend_t LogBackendSd;
+
+#endif
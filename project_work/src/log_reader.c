@@ -0,0 +1,111 @@
+/**
+ * @file log_reader.c
+ * @brief Reading side of the block data logger. See log_reader.h.
+ */
+
+#include "log_reader.h"
+#include "crc32.h"
+#include <stddef.h>
+#include <string.h>
+
+/// @brief Inverse of put_varint in data_logger.c.
+/// @return NULL if the varint runs past end or is longer than 5 bytes.
+static const u8 *get_varint(const u8 *p, const u8 *end, s32 *value)
+{
+	u32 v = 0;
+
+	for (u32 shift = 0; shift < 35; shift += 7)
+	{
+		if (p == end)
+		{
+			return NULL;
+		}
+		u8 byte = *p++;
+		v |= (u32)(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0)
+		{
+			*value = (s32)((v >> 1) ^ (0U - (v & 1)));
+			return p;
+		}
+	}
+	return NULL;
+}
+
+void LogReader_Init(LogReader_t *reader)
+{
+	memset(reader, 0, sizeof(*reader));
+}
+
+int LogReader_Block(LogReader_t *reader, const void *block, LogSample_t *samples)
+{
+	const u8 *bytes = (const u8 *)block;
+	LogBlockHeader_t header;
+
+	memcpy(&header, bytes, sizeof(header));
+	if (header.magic != LOG_BLOCK_MAGIC || header.bytes > LOG_PAYLOAD_SIZE || header.samples > LOG_MAX_BLOCK_SAMPLES)
+	{
+		return -1;
+	}
+	if (Crc32_Update(Crc32(&header, offsetof(LogBlockHeader_t, crc)), bytes + sizeof(header), header.bytes) != header.crc)
+	{
+		return -1;
+	}
+	if (reader->started && header.session != reader->session)
+	{
+		return -1;
+	}
+
+	const u8 *p = bytes + sizeof(header);
+	const u8 *end = p + header.bytes;
+	u32 tick = header.first_tick;
+	s32 values[3] = { 0, 0, 0 };
+
+	for (u32 n = 0; n < header.samples; n++)
+	{
+		s32 delta;
+
+		if ((p = get_varint(p, end, &delta)) == NULL)
+		{
+			return -1;
+		}
+		tick += (u32)delta;
+		for (u32 i = 0; i < 3; i++)
+		{
+			if ((p = get_varint(p, end, &delta)) == NULL)
+			{
+				return -1;
+			}
+			values[i] = (s32)((u32)values[i] + (u32)delta);
+		}
+
+		samples[n].tick = tick;
+		samples[n].u_ref = values[0] / LOG_VOLT_SCALE;
+		samples[n].u_meas = values[1] / LOG_VOLT_SCALE;
+		samples[n].u_out = values[2] / LOG_VOLT_SCALE;
+	}
+
+	// Continuity with the previous block.
+	if (reader->started)
+	{
+		reader->gaps += (header.seq != reader->next_seq);
+		if (reader->tick_step != 0 && header.samples > 0 && header.first_tick - reader->last_tick > reader->tick_step)
+		{
+			reader->dropped += (header.first_tick - reader->last_tick) / reader->tick_step - 1;
+		}
+	}
+	if (reader->tick_step == 0 && header.samples > 1)
+	{
+		reader->tick_step = samples[1].tick - samples[0].tick;
+	}
+	if (header.samples > 0)
+	{
+		reader->last_tick = samples[header.samples - 1].tick;
+	}
+
+	reader->started = true;
+	reader->session = header.session;
+	reader->next_seq = header.seq + 1;
+	reader->blocks++;
+	reader->samples += header.samples;
+	return header.samples;
+}
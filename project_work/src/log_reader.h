@@ -0,0 +1,35 @@
+/**
+ * @file log_reader.h
+ * @brief Reading side of the block data logger.
+ *
+ * Feed the blocks of a log in order, as read from the host file or from an image of
+ * the SD card region. The first valid block fixes the session; the log ends at the
+ * first block that is invalid or belongs to another session, which on a raw card is
+ * where an older, longer run's blocks begin. Free of RTOS calls, for host tools.
+ */
+
+#ifndef LOG_READER_H
+#define LOG_READER_H
+
+#include "data_logger.h"
+
+typedef struct {
+	bool started;
+	u32 session;
+	u32 next_seq;
+	u32 blocks;
+	u32 samples;
+	u32 gaps;		// Sequence jumps, blocks lost to write errors
+	u32 dropped;	// Samples missing between blocks, from the tick steps
+	u32 tick_step;	// Ticks per sample, taken from the first block with two samples
+	u32 last_tick;
+} LogReader_t;
+
+void LogReader_Init(LogReader_t *reader);
+
+/// @brief Checks and decodes one LOG_BLOCK_SIZE block.
+/// @param samples Room for LOG_MAX_BLOCK_SAMPLES samples.
+/// @return Number of samples decoded, -1 at the end of the log.
+int LogReader_Block(LogReader_t *reader, const void *block, LogSample_t *samples);
+
+#endif
@@ -114,8 +114,19 @@
 #include "uart_ui.h"
 #include "system_params.h"
 #include "zynq_registers.h"
+#include "param_store.h"
+#include "param_store_qspi.h"
+#include "state_snapshot.h"
+#include "freq_analyser.h"
+#include "meas_frontend.h"
+#include "data_logger.h"
+#include "boot_profile.h"
+#ifdef AMP_MODE
+#include "amp_link.h"
+#endif
 
 #include "timers.h"
+#include <stdbool.h>
 
 // Interrupt:
 #include <xscugic.h>
@@ -134,24 +145,41 @@ TimerHandle_t cooldown_timer;
 TaskHandle_t control_task_handle;
 TaskHandle_t plant_model_task_handle;
 TaskHandle_t ui_control_task_handle;
+TaskHandle_t fra_task_handle;
+TaskHandle_t meas_task_handle;
+TaskHandle_t log_task_handle;
+TaskHandle_t boot_task_handle;
 
 extern XScuGic xInterruptController;
 
 // Function decalarations
 void SetupInterrupts();
+void RestoreParameters(bool keep_controller);
+static void boot_task(void *pvParameters);
+
+// A warm-restart snapshot was applied in main, boot_task must not override it.
+static bool warm_restart = false;
 
 int main( void ) {
 
-	// Set LEDs as output
+	BootProfile_Mark("main");
+
+#ifndef FAST_START
+	// Set LEDs as output. Fast start leaves this to ui_control_task.
 	AXI_LED_TRI &= ~(0b1111UL);
+#endif
 	AXI_BTN_TRI |= 0xF;
 
 	SetupInterrupts();
+	BootProfile_Mark("interrupts");
 	SetupUART(); // setup UART for UI usage - R.M.
+	BootProfile_Mark("uart");
 	// SetupUARTInterrupt();
 	SetupPWMTimer();
+	BootProfile_Mark("pwm timer");
 	// SetupPWMHandler();
 	SetupPushButtons();
+	BootProfile_Mark("buttons");
 
     // From: FreeRTOS_Reference_Manual_V10.0.0.pdf -I.L
     // Here we are creating the timer for the Timer Mutex.
@@ -180,32 +208,57 @@ int main( void ) {
 
     // Init semaphore to "available" state
     xSemaphoreGive(uart_config_SEMAPHORE);
+	BootProfile_Mark("rtos objects");
 
+#ifndef FAST_START
     xil_printf("\n\n");
 	xil_printf( "Control System starting... \r\n" );
+#endif
 
 	/**
 	 * Create four tasks t
 	 * Each function behaves as if it had full control of the controller.
 	 * https://www.freertos.org/a00125.html
 	 */
-	xTaskCreate(control_task, 					// The function that implements the task.
-					"Controller loop", 			// Text name for the task, provided to assist debugging only.
-					4096, 						// The stack allocated to the task.
-					NULL, 						// The task parameter is not used, so set to NULL.
-					tskIDLE_PRIORITY+3,			// The task runs at the idle priority. Higher number means higher priority.
-					&control_task_handle);
-
-	// vTaskSuspend(control_task_handle);
-
-	xTaskCreate(plant_model_task, 					// The function that implements the task.
-					"Plant model loop", 		// Text name for the task, provided to assist debugging only.
-					4096, 						// The stack allocated to the task.
-					NULL, 						// The task parameter is not used, so set to NULL.
-					tskIDLE_PRIORITY+2,			// The task runs at the idle priority. Higher number means higher priority.
-					&plant_model_task_handle );
-
-	// vTaskSuspend(plant_model_task_handle);
+	bool amp_running = false;
+#ifdef AMP_MODE
+	// AMP mode: controller and plant run on CPU1, this core only bridges the UI to them.
+	if (AmpLink_Start() == XST_SUCCESS)
+	{
+		amp_running = true;
+		xTaskCreate(amp_link_task,
+						"AMP link",
+						4096,
+						NULL,
+						tskIDLE_PRIORITY+3,
+						&control_task_handle);
+	}
+	else
+	{
+		xil_printf("CPU1 not responding, running the control loop on CPU0.\r\n");
+	}
+#endif
+
+	if (!amp_running)
+	{
+		xTaskCreate(control_task, 					// The function that implements the task.
+						"Controller loop", 			// Text name for the task, provided to assist debugging only.
+						4096, 						// The stack allocated to the task.
+						NULL, 						// The task parameter is not used, so set to NULL.
+						tskIDLE_PRIORITY+3,			// The task runs at the idle priority. Higher number means higher priority.
+						&control_task_handle);
+
+		// vTaskSuspend(control_task_handle);
+
+		xTaskCreate(plant_model_task, 					// The function that implements the task.
+						"Plant model loop", 		// Text name for the task, provided to assist debugging only.
+						4096, 						// The stack allocated to the task.
+						NULL, 						// The task parameter is not used, so set to NULL.
+						tskIDLE_PRIORITY+2,			// The task runs at the idle priority. Higher number means higher priority.
+						&plant_model_task_handle );
+
+		// vTaskSuspend(plant_model_task_handle);
+	}
 
 	xTaskCreate(ui_control_task, 					// The function that implements the task.
 					"UI control loop", 			// Text name for the task, provided to assist debugging only.
@@ -214,11 +267,67 @@ int main( void ) {
 					tskIDLE_PRIORITY+1,			// The task runs at the idle priority. Higher number means higher priority.
 					&ui_control_task_handle );
 
+	// Measurement front-end filtering. Above the controller so a finished block is
+	// filtered before the next control sample reads it.
+	xTaskCreate(meas_task,
+					"Measurement front-end",
+					4096,
+					NULL,
+					tskIDLE_PRIORITY+4,
+					&meas_task_handle );
+
+	// Frequency-response analyser processing, kept out of the control loop.
+	xTaskCreate(fra_task,
+					"FRA processing",
+					4096,
+					NULL,
+					tskIDLE_PRIORITY+1,
+					&fra_task_handle );
+
+	// Data logger block writes. Lowest priority: the blocks buffer any stall of the card.
+	xTaskCreate(log_task,
+					"Data logger",
+					4096,
+					NULL,
+					tskIDLE_PRIORITY+1,
+					&log_task_handle );
+
+	// Prints the boot profile once the loop runs, does the deferred init in fast start.
+	xTaskCreate(boot_task,
+					"Boot",
+					4096,
+					NULL,
+					tskIDLE_PRIORITY,
+					&boot_task_handle );
+	BootProfile_Mark("tasks created");
+
+	// Order: saved parameters first, then the warm-restart snapshot, which overrides the
+	// saved gains and reference. Fast start loads the flash in boot_task, after the loop has
+	// started, so there it skips the gains and reference when a snapshot was applied here.
+#ifndef FAST_START
+	// Restore the values saved with the UART 'save' command.
+	// Done after the tasks are created since the setters use the mutexes.
+	RestoreParameters(false);
+	BootProfile_Mark("parameters");
+#endif
+
+	// After a watchdog / soft reset, continue from the state the loop was in instead
+	// of running the whole transient again.
+	if (Snapshot_RestoreRetained() == XST_SUCCESS)
+	{
+		warm_restart = true;
+		xil_printf("Warm restart: controller and plant state restored.\r\n");
+	}
+	BootProfile_Mark("snapshot");
+
 	// Start the tasks and timer running.
 	// https://www.freertos.org/a00132.html
 
+#ifndef FAST_START
 	xil_printf("\r\nCurrent system mode: CONFIG\r\n");
+#endif
 
+	BootProfile_Mark("scheduler start");
 	vTaskStartScheduler();
 
 	for( ;; );
@@ -240,3 +349,60 @@ void SetupInterrupts()
 	XScuGic_CfgInitialize( &xInterruptController, pxGICConfig, pxGICConfig->CpuBaseAddress );
 }
 
+/// @brief Runs once below every other task: prints the boot profile after the first control sample.
+/// In fast start it first does the init the control loop doesn't need.
+static void boot_task(void *pvParameters)
+{
+	if (!BootProfile_WaitFirstSample())
+	{
+		xil_printf("\r\nNo control sample within %d ms of boot.\r\n", BOOT_FIRST_SAMPLE_TIMEOUT_MS);
+	}
+
+#ifdef FAST_START
+	// The loop is already running from the snapshot on a warm restart: only the mode,
+	// which the snapshot does not hold, comes from flash, as in the normal build.
+	RestoreParameters(warm_restart);
+	xil_printf("\r\nControl System started (fast start), mode: CONFIG\r\n");
+	UART_SendHelp();
+	BootProfile_Mark("deferred init");
+#endif
+
+	BootProfile_Report();
+	vTaskDelete(NULL);
+}
+
+/// @brief Loads the newest saved parameters from the QSPI parameter store.
+/// Finding the record takes a fixed handful of flash reads, so this barely adds to the boot time.
+/// @param keep_controller Leave the gains and target voltage as they are (warm restart), restore the mode only.
+void RestoreParameters(bool keep_controller)
+{
+	ParamValues_t values;
+	const ParamFlash_t *flash = ParamQspi_Init();
+
+	if (flash == NULL || ParamStore_Init(flash) != XST_SUCCESS)
+	{
+		xil_printf("Parameter store not available, using defaults.\r\n");
+		return;
+	}
+
+	if (ParamStore_Load(&values) != XST_SUCCESS)
+	{
+		xil_printf("No saved parameters, using defaults.\r\n");
+		return;
+	}
+
+	if (!keep_controller)
+	{
+		setParameter(PARAM_KP, values.kp);
+		setParameter(PARAM_KI, values.ki);
+		setParameter(PARAM_KD, values.kd);
+		setTargetVoltage(values.u_ref);
+	}
+
+	if (values.mode <= MODE_MODULATION)
+	{
+		setSystemMode((SystemMode_t)values.mode);
+	}
+
+	xil_printf("Parameters restored from flash.\r\n");
+}
@@ -0,0 +1,207 @@
+/**
+ * @file meas_frontend.c
+ * @brief Measurement front-end. See meas_frontend.h.
+ */
+
+#include "meas_frontend.h"
+#include "spsc_ring.h"
+#include "arm_math.h"
+#include "xtime_l.h"
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <string.h>
+
+// Decimation filter cut-off as a fraction of the output Nyquist frequency.
+#define MEAS_CUTOFF			0.8f
+
+// Full blocks waiting for meas_task. Kept at MEAS_BLOCK_COUNT - 2 so the producer can never
+// wrap around onto the block being filtered: one is filtered, two wait, one is being filled.
+#define MEAS_READY_DEPTH	2
+
+static u16 blocks[MEAS_BLOCK_COUNT][MEAS_BLOCK_SIZE];
+static u32 ready_storage[MEAS_READY_DEPTH];
+static SpscRing_t ready_ring;
+
+// Producer (ISR) side
+static u32 fill_block;
+static u32 fill_index;
+static volatile u32 raw_samples;
+static volatile u32 dropped_blocks;
+
+// Consumer side
+static arm_fir_decimate_instance_f32 fir;
+static float fir_coeffs[MEAS_FIR_TAPS];
+static float fir_state[MEAS_FIR_TAPS + MEAS_BLOCK_SIZE - 1];
+static float volts_per_lsb;
+static u32 out_samples;
+static u32 warmup_blocks;		// Blocks until the filter history is full
+static u64 busy_counts;
+static XTime start_time;
+
+static const MeasSource_t *active_source = NULL;
+
+// Published sample. Raw bits so it can go through a plain 32-bit atomic store.
+static volatile u32 latest_bits;
+static volatile bool have_latest = false;
+
+/// @brief Hamming windowed sinc low-pass with unity DC gain.
+static void design_filter(void)
+{
+	const float fc = MEAS_CUTOFF * 0.5f / MEAS_DECIMATION;	// Cycles per raw sample
+	const float mid = (MEAS_FIR_TAPS - 1) / 2.0f;
+	float sum = 0;
+
+	for (u32 n = 0; n < MEAS_FIR_TAPS; n++)
+	{
+		float x = (float)n - mid;
+		float sinc = (x == 0.0f) ? 2.0f * fc : arm_sin_f32(2.0f * PI * fc * x) / (PI * x);
+		float window = 0.54f - 0.46f * arm_cos_f32(2.0f * PI * n / (MEAS_FIR_TAPS - 1));
+
+		fir_coeffs[n] = sinc * window;
+		sum += fir_coeffs[n];
+	}
+	for (u32 n = 0; n < MEAS_FIR_TAPS; n++)
+	{
+		fir_coeffs[n] /= sum;
+	}
+}
+
+int MeasFrontend_Start(const MeasSource_t *source)
+{
+	MeasFrontend_Stop();
+
+	design_filter();
+	memset(fir_state, 0, sizeof(fir_state));
+	if (arm_fir_decimate_init_f32(&fir, MEAS_FIR_TAPS, MEAS_DECIMATION, fir_coeffs, fir_state, MEAS_BLOCK_SIZE) != ARM_MATH_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+	SpscRing_Init(&ready_ring, ready_storage, MEAS_READY_DEPTH, sizeof(u32));
+
+	volts_per_lsb = source->volts_per_lsb;
+	fill_block = 0;
+	fill_index = 0;
+	raw_samples = 0;
+	dropped_blocks = 0;
+	out_samples = 0;
+	warmup_blocks = (MEAS_FIR_TAPS + MEAS_BLOCK_SIZE - 1) / MEAS_BLOCK_SIZE;
+	busy_counts = 0;
+	XTime_GetTime(&start_time);
+
+	active_source = source;
+	if (source->start() != XST_SUCCESS)
+	{
+		active_source = NULL;
+		return XST_FAILURE;
+	}
+	return XST_SUCCESS;
+}
+
+void MeasFrontend_Stop(void)
+{
+	if (active_source != NULL)
+	{
+		active_source->stop();
+		active_source = NULL;
+	}
+	__atomic_store_n(&have_latest, false, __ATOMIC_RELEASE);
+}
+
+bool MeasFrontend_CaptureSample(u16 code)
+{
+	blocks[fill_block][fill_index] = code;
+	raw_samples++;
+
+	if (++fill_index < MEAS_BLOCK_SIZE)
+	{
+		return false;
+	}
+
+	fill_index = 0;
+	if (SpscRing_Push(&ready_ring, &fill_block))
+	{
+		fill_block = (fill_block + 1) % MEAS_BLOCK_COUNT;
+	}
+	else
+	{
+		// meas_task is behind: drop this block and fill it again.
+		dropped_blocks++;
+	}
+	return true;
+}
+
+u32 MeasFrontend_Process(void)
+{
+	float raw[MEAS_BLOCK_SIZE];
+	float out[MEAS_BLOCK_SIZE / MEAS_DECIMATION];
+	u32 block;
+	u32 processed = 0;
+
+	while (SpscRing_Pop(&ready_ring, &block))
+	{
+		XTime t0, t1;
+		XTime_GetTime(&t0);
+
+		for (u32 i = 0; i < MEAS_BLOCK_SIZE; i++)
+		{
+			raw[i] = (float)blocks[block][i] * volts_per_lsb;
+		}
+		arm_fir_decimate_f32(&fir, raw, out, MEAS_BLOCK_SIZE);
+		out_samples += MEAS_BLOCK_SIZE / MEAS_DECIMATION;
+
+		// Publish once the filter has a full history, the first outputs ramp up from zero.
+		if (warmup_blocks > 0)
+		{
+			warmup_blocks--;
+		}
+		else if (active_source != NULL)
+		{
+			u32 bits;
+			memcpy(&bits, &out[MEAS_BLOCK_SIZE / MEAS_DECIMATION - 1], sizeof(bits));
+			__atomic_store_n(&latest_bits, bits, __ATOMIC_RELEASE);
+			__atomic_store_n(&have_latest, true, __ATOMIC_RELEASE);
+		}
+
+		XTime_GetTime(&t1);
+		busy_counts += t1 - t0;
+		processed++;
+	}
+	return processed;
+}
+
+bool MeasFrontend_GetLatest(float *voltage)
+{
+	if (!__atomic_load_n(&have_latest, __ATOMIC_ACQUIRE))
+	{
+		return false;
+	}
+
+	u32 bits = __atomic_load_n(&latest_bits, __ATOMIC_ACQUIRE);
+	memcpy(voltage, &bits, sizeof(bits));
+	return true;
+}
+
+void MeasFrontend_GetStats(MeasStats_t *stats)
+{
+	XTime now;
+	XTime_GetTime(&now);
+
+	stats->raw_samples = raw_samples;
+	stats->out_samples = out_samples;
+	stats->dropped_blocks = dropped_blocks;
+	stats->busy_counts = busy_counts;
+	stats->elapsed_counts = now - start_time;
+}
+
+/// @brief This is the measurement front-end task. The source's ISR notifies it per full block.
+void meas_task(void *pvParameters)
+{
+	for (;;)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		MeasFrontend_Process();
+	}
+}
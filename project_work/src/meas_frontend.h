@@ -0,0 +1,67 @@
+/**
+ * @file meas_frontend.h
+ * @brief Measurement front-end: oversampled ADC blocks, FIR decimation to the control rate.
+ *
+ * A source (MeasSource_t) delivers raw ADC codes at MEAS_DECIMATION times the control
+ * rate with MeasFrontend_CaptureSample(). Codes are collected into blocks of
+ * MEAS_BLOCK_SIZE; full blocks are handed to meas_task through an SpscRing and run
+ * through arm_fir_decimate_f32. The newest decimated voltage is published with a single
+ * atomic store, so the controller reads it without a mutex.
+ *
+ * Sources: the XADC on the target (meas_source_xadc.c), a synthetic signal generator in
+ * host builds (host/meas_source_synth.c).
+ */
+
+#ifndef MEAS_FRONTEND_H
+#define MEAS_FRONTEND_H
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include <stdbool.h>
+
+#define MEAS_DECIMATION		8		// Raw samples per control sample
+#define MEAS_BLOCK_SIZE		8		// Raw samples per block, multiple of MEAS_DECIMATION
+#define MEAS_BLOCK_COUNT	4		// Capture buffers
+#define MEAS_FIR_TAPS		32
+
+typedef struct {
+	const char *name;
+	float sample_rate;		// Raw samples per second
+	float volts_per_lsb;	// Scale from ADC code to plant voltage
+	int (*start)(void);		// Starts calling MeasFrontend_CaptureSample
+	void (*stop)(void);
+} MeasSource_t;
+
+typedef struct {
+	u32 raw_samples;		// Captured codes
+	u32 out_samples;		// Decimated samples published
+	u32 dropped_blocks;		// Blocks lost because meas_task fell behind
+	u64 busy_counts;		// XTime counts spent filtering
+	u64 elapsed_counts;		// XTime counts since the source was started
+} MeasStats_t;
+
+/// @brief Designs the decimation filter for the source and starts it.
+/// @return XST_FAILURE if the source fails to start.
+int MeasFrontend_Start(const MeasSource_t *source);
+
+/// @brief Stops the source. The controller goes back to the plant model voltage.
+void MeasFrontend_Stop(void);
+
+/// @brief Producer side, from the source's ISR. One load and store per sample.
+/// @return true when a block was completed, i.e. meas_task should be woken.
+bool MeasFrontend_CaptureSample(u16 code);
+
+/// @brief Consumer side: filters and publishes all full blocks.
+/// @return Number of blocks processed.
+u32 MeasFrontend_Process(void);
+
+/// @brief Newest decimated plant voltage. Lock-free, for the control task.
+/// @return false if the front-end is not running or has no sample yet.
+bool MeasFrontend_GetLatest(float *voltage);
+
+void MeasFrontend_GetStats(MeasStats_t *stats);
+
+/// @brief Front-end task: woken by the source for every full block.
+void meas_task(void *pvParameters);
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file meas_source_xadc.c
+ * @brief XADC source for the measurement front-end.
+ *
+ * The XADC wizard converts VP/VN continuously. TTC1 counter 0 (TTC device 3) raises an
+ * interrupt at the oversampling rate and the ISR stores the newest conversion into the
+ * current capture block, so the samples are evenly spaced no matter how busy the CPU is.
+ *
+ * Neither the XADC wizard nor the PS XADC interface has a DMA request line towards the
+ * PS DMA controller in this design, so a DMA copy could not be paced by conversions.
+ * The front-end only sees whole blocks, so an AXI-stream + DMA capture can replace this
+ * file without touching the filtering.
+ */
+
+#include "meas_source_xadc.h"
+#include "system_params.h"
+#include "xparameters.h"
+#include "xsysmon.h"
+#include "xttcps.h"
+#include "xscugic.h"
+
+extern XScuGic xInterruptController;
+extern TaskHandle_t meas_task_handle;
+
+static XSysMon xadc;
+static XTtcPs sample_timer;
+
+/// @brief Sample clock ISR: one register read, one store into the capture block.
+static void xadc_sample_isr(void *data)
+{
+	BaseType_t woken = pdFALSE;
+
+	XTtcPs_ClearInterruptStatus(&sample_timer, XTtcPs_GetInterruptStatus(&sample_timer));
+
+	if (MeasFrontend_CaptureSample(XSysMon_GetAdcData(&xadc, XSM_CH_VPVN)))
+	{
+		vTaskNotifyGiveFromISR(meas_task_handle, &woken);
+	}
+	portYIELD_FROM_ISR(woken);
+}
+
+static int xadc_start(void)
+{
+	XSysMon_Config *xadc_config = XSysMon_LookupConfig(XPAR_SYSMON_0_DEVICE_ID);
+	XTtcPs_Config *timer_config = XTtcPs_LookupConfig(XPAR_XTTCPS_3_DEVICE_ID);
+	XInterval interval;
+	u8 prescaler;
+
+	if (xadc_config == NULL || timer_config == NULL ||
+		XSysMon_CfgInitialize(&xadc, xadc_config, xadc_config->BaseAddress) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+
+	// VP/VN only, no averaging: the decimation filter does the averaging.
+	XSysMon_SetSequencerMode(&xadc, XSM_SEQ_MODE_SAFE);
+	XSysMon_SetAvg(&xadc, XSM_AVG_0_SAMPLES);
+	if (XSysMon_SetSingleChParams(&xadc, XSM_CH_VPVN, FALSE, FALSE, FALSE) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+	XSysMon_SetSequencerMode(&xadc, XSM_SEQ_MODE_SINGCHAN);
+
+	// Stopped by xadc_stop if this is a restart.
+	if (XTtcPs_CfgInitialize(&sample_timer, timer_config, timer_config->BaseAddress) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+	XTtcPs_SetOptions(&sample_timer, XTTCPS_OPTION_INTERVAL_MODE | XTTCPS_OPTION_WAVE_DISABLE);
+	XTtcPs_CalcIntervalFromFreq(&sample_timer, (u32)MeasSourceXadc.sample_rate, &interval, &prescaler);
+	XTtcPs_SetInterval(&sample_timer, interval);
+	XTtcPs_SetPrescaler(&sample_timer, prescaler);
+
+	XScuGic_Connect(&xInterruptController, XPAR_XTTCPS_3_INTR, (Xil_ExceptionHandler)xadc_sample_isr, NULL);
+	XScuGic_Enable(&xInterruptController, XPAR_XTTCPS_3_INTR);
+	XTtcPs_EnableInterrupts(&sample_timer, XTTCPS_IXR_INTERVAL_MASK);
+	XTtcPs_Start(&sample_timer);
+	return XST_SUCCESS;
+}
+
+static void xadc_stop(void)
+{
+	XTtcPs_Stop(&sample_timer);
+	XTtcPs_DisableInterrupts(&sample_timer, XTTCPS_IXR_INTERVAL_MASK);
+	XScuGic_Disable(&xInterruptController, XPAR_XTTCPS_3_INTR);
+}
+
+const MeasSource_t MeasSourceXadc = {
+	"xadc",
+	MEAS_DECIMATION * 1000.0f / controller_interval,
+	MEAS_XADC_FULL_SCALE / 65536.0f,	// 12-bit result, MSB aligned in 16 bits
+	xadc_start,
+	xadc_stop
+};
@@ -0,0 +1,17 @@
+/**
+ * @file meas_source_xadc.h
+ * @brief XADC source for the measurement front-end.
+ */
+
+#ifndef MEAS_SOURCE_XADC_H
+#define MEAS_SOURCE_XADC_H
+
+#include "meas_frontend.h"
+
+// Plant voltage at the XADC full scale (1 V on VP/VN through the divider).
+#define MEAS_XADC_FULL_SCALE	400.0f
+
+/// @brief VP/VN of the XADC wizard, sampled by TTC1 counter 0 at MEAS_DECIMATION x the control rate.
+extern const MeasSource_t MeasSourceXadc;
+
+#endif
@@ -0,0 +1,225 @@
+/**
+ * @file param_store.c
+ * @brief Persistent, wear-levelled parameter store. See param_store.h.
+ */
+
+#include "param_store.h"
+#include "crc32.h"
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+
+static const ParamFlash_t *flash = NULL;
+static u32 slots_per_sector;
+
+// Where the next record goes. next_slot == slots_per_sector means the active sector is full.
+static u32 active_sector;
+static u32 next_slot;
+static u32 next_seq;
+// Slot 0 of the active sector holds a valid record. Init only looks at slot 0, so no
+// record may go further into a sector until this is true.
+static bool sector_started;
+
+// RAM copy of the newest valid record, so Load never touches the flash.
+static ParamRecord_t latest;
+static bool have_latest = false;
+
+static u32 slot_offset(u32 sector, u32 slot)
+{
+	return sector * flash->sector_size + slot * sizeof(ParamRecord_t);
+}
+
+static u32 record_crc(const ParamRecord_t *record)
+{
+	return Crc32(record, offsetof(ParamRecord_t, crc));
+}
+
+static bool record_valid(const ParamRecord_t *record)
+{
+	return record->magic == PARAM_RECORD_MAGIC && record->crc == record_crc(record);
+}
+
+/// @brief A slot counts as free only if every byte is still erased. A torn write
+/// can leave any part of the record programmed.
+static bool record_erased(const ParamRecord_t *record)
+{
+	const u8 *p = (const u8 *)record;
+
+	for (u32 i = 0; i < sizeof(ParamRecord_t); i++)
+	{
+		if (p[i] != 0xFF)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static int read_slot(u32 sector, u32 slot, ParamRecord_t *record)
+{
+	return flash->read(slot_offset(sector, slot), record, sizeof(ParamRecord_t));
+}
+
+int ParamStore_Init(const ParamFlash_t *flash_dev)
+{
+	ParamRecord_t record;
+	int best_sector = -1;
+	u32 best_seq = 0;
+
+	flash = flash_dev;
+	slots_per_sector = flash->sector_size / sizeof(ParamRecord_t);
+	have_latest = false;
+
+	// 1. The newest sector is the one whose first record has the highest sequence number.
+	// Only slot 0 of every sector is read.
+	for (u32 s = 0; s < flash->sector_count; s++)
+	{
+		if (read_slot(s, 0, &record) != XST_SUCCESS)
+		{
+			return XST_FAILURE;
+		}
+		if (record_valid(&record) && (best_sector < 0 || (s32)(record.seq - best_seq) > 0))
+		{
+			best_sector = s;
+			best_seq = record.seq;
+		}
+	}
+
+	if (best_sector < 0)
+	{
+		// Empty (or never formatted). Mark the "previous" sector as full so the first
+		// save erases sector 0 before using it.
+		active_sector = flash->sector_count - 1;
+		next_slot = slots_per_sector;
+		next_seq = 1;
+		return XST_SUCCESS;
+	}
+
+	// 2. Records are appended in order, so used slots are a prefix of the sector.
+	// Binary search for the first free slot: log2(slots) reads.
+	u32 lo = 1;
+	u32 hi = slots_per_sector;
+	while (lo < hi)
+	{
+		u32 mid = lo + (hi - lo) / 2;
+		if (read_slot(best_sector, mid, &record) != XST_SUCCESS)
+		{
+			return XST_FAILURE;
+		}
+		if (record_erased(&record))
+		{
+			hi = mid;
+		}
+		else
+		{
+			lo = mid + 1;
+		}
+	}
+
+	active_sector = best_sector;
+	next_slot = lo;
+	sector_started = true;
+
+	// 3. Walk back over torn records (normally none or one) to the newest valid one.
+	// Slot 0 was valid, so this always terminates.
+	for (s32 slot = (s32)lo - 1; slot >= 0; slot--)
+	{
+		if (read_slot(best_sector, slot, &record) != XST_SUCCESS)
+		{
+			return XST_FAILURE;
+		}
+		if (record_valid(&record))
+		{
+			latest = record;
+			have_latest = true;
+			break;
+		}
+	}
+
+	next_seq = latest.seq + 1;
+	return XST_SUCCESS;
+}
+
+int ParamStore_Load(ParamValues_t *values)
+{
+	if (!have_latest)
+	{
+		return XST_FAILURE;
+	}
+	*values = latest.values;
+	return XST_SUCCESS;
+}
+
+int ParamStore_Save(const ParamValues_t *values)
+{
+	ParamRecord_t record;
+	ParamRecord_t check;
+
+	if (flash == NULL)
+	{
+		return XST_FAILURE;
+	}
+
+	record.magic = PARAM_RECORD_MAGIC;
+	record.seq = next_seq;
+	record.values = *values;
+	record.crc = record_crc(&record);
+
+	for (;;)
+	{
+		// Sector full: continue in the next one. Erasing rotates over all sectors,
+		// the newest record stays in the old sector until the new one has a valid record.
+		if (next_slot >= slots_per_sector)
+		{
+			active_sector = (active_sector + 1) % flash->sector_count;
+			next_slot = 0;
+			sector_started = false;
+			if (flash->erase(active_sector * flash->sector_size) != XST_SUCCESS)
+			{
+				return XST_FAILURE;
+			}
+		}
+		else if (next_slot > 0 && !sector_started)
+		{
+			// The first record of this sector failed: it holds no valid record, erase it
+			// and start again at slot 0 rather than write where Init would not look.
+			next_slot = 0;
+			if (flash->erase(active_sector * flash->sector_size) != XST_SUCCESS)
+			{
+				return XST_FAILURE;
+			}
+		}
+
+		// Never program on top of a slot that isn't fully erased (e.g. a torn write
+		// that left the first bytes at 0xFF and fooled the binary search).
+		if (read_slot(active_sector, next_slot, &check) != XST_SUCCESS)
+		{
+			return XST_FAILURE;
+		}
+		if (record_erased(&check))
+		{
+			break;
+		}
+		next_slot++;
+	}
+
+	// The slot is consumed even if programming fails half way.
+	u32 slot = next_slot++;
+
+	if (flash->program(slot_offset(active_sector, slot), &record, sizeof(record)) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+
+	// Verify from flash before the RAM copy is updated.
+	if (read_slot(active_sector, slot, &check) != XST_SUCCESS || memcmp(&check, &record, sizeof(record)) != 0)
+	{
+		return XST_FAILURE;
+	}
+
+	latest = record;
+	have_latest = true;
+	sector_started = true;
+	next_seq++;
+	return XST_SUCCESS;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file param_store.h
+ * @brief Persistent, wear-levelled parameter store.
+ *
+ * The store is an append-only log of fixed size, CRC'd records spread over a few
+ * flash sectors. Saving appends one record; when a sector is full the next one is
+ * erased and the log continues there, so the erases rotate over all sectors.
+ * At boot only the first slot of every sector and a binary search of the newest
+ * sector are read, so finding the latest record takes a small constant number of
+ * reads no matter how full the log is.
+ *
+ * The flash itself is behind ParamFlash_t: QSPI on the target (param_store_qspi.c),
+ * a plain file on Linux (host/param_flash_file.c).
+ */
+
+#ifndef PARAM_STORE_H
+#define PARAM_STORE_H
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+// Default layout: last 4 x 64 KB sectors of the 16 MB QSPI flash, away from the boot image.
+#define PARAM_STORE_SECTOR_SIZE		0x10000
+#define PARAM_STORE_SECTOR_COUNT	4
+#define PARAM_STORE_FLASH_OFFSET	(0x1000000 - PARAM_STORE_SECTOR_COUNT * PARAM_STORE_SECTOR_SIZE)
+
+#define PARAM_RECORD_MAGIC			0x50415231	// "PAR1", bump when ParamValues_t changes
+
+// The values that survive a power cycle.
+typedef struct {
+	float kp;
+	float ki;
+	float kd;
+	float u_ref;
+	u32 mode;		// SystemMode_t
+} ParamValues_t;
+
+// One log entry, 32 bytes. Size must divide the sector size.
+typedef struct {
+	u32 magic;
+	u32 seq;		// +1 for every saved record, used to find the newest one
+	ParamValues_t values;
+	u32 crc;		// CRC-32 of everything above
+} ParamRecord_t;
+
+// Flash access. Offsets are relative to the start of the store region.
+// program may only clear bits (NOR semantics), erase sets a whole sector to 0xFF.
+typedef struct {
+	u32 sector_size;
+	u32 sector_count;
+	int (*read)(u32 offset, void *buf, u32 len);
+	int (*program)(u32 offset, const void *buf, u32 len);
+	int (*erase)(u32 offset);
+} ParamFlash_t;
+
+/// @brief Locates the newest valid record. Call once at boot.
+/// @return XST_SUCCESS also when the store is empty, XST_FAILURE on flash errors.
+int ParamStore_Init(const ParamFlash_t *flash);
+
+/// @brief Copies the newest record found by ParamStore_Init / written by ParamStore_Save.
+/// @return XST_SUCCESS, or XST_FAILURE if nothing has been stored yet.
+int ParamStore_Load(ParamValues_t *values);
+
+/// @brief Appends a new record.
+/// @return XST_SUCCESS if the record was written and read back correctly.
+int ParamStore_Save(const ParamValues_t *values);
+
+#endif
@@ -0,0 +1,154 @@
+/**
+ * @file param_store_qspi.c
+ * @brief QSPI flash backend for the parameter store.
+ *
+ * Reads go through the linear (memory mapped) window at ps7_qspi_linear_0, which is
+ * what keeps the boot-time lookup fast. Program and erase switch the controller to
+ * I/O mode for the duration of the command and back to linear mode afterwards.
+ * Based on the Xilinx qspips polled flash example.
+ */
+
+#include "param_store_qspi.h"
+#include "xparameters.h"
+#include "xqspips.h"
+#include "xil_cache.h"
+#include <string.h>
+
+#define CMD_HEADER_SIZE		4		// Opcode + 24-bit address
+#define STATUS_WIP_MASK		0x01	// Write in progress bit of status register 1
+
+static XQspiPs qspi;
+
+static ParamFlash_t qspi_flash;
+
+/// @brief Linear mode for memory mapped reads.
+static void enter_linear_mode(void)
+{
+	XQspiPs *instance = &qspi;	// The enable / disable macros need a plain pointer
+
+	XQspiPs_Disable(instance);
+	XQspiPs_SetOptions(instance, XQSPIPS_LQSPI_MODE_OPTION | XQSPIPS_HOLD_B_DRIVE_OPTION);
+	XQspiPs_SetLqspiConfigReg(instance, XQSPIPS_LQSPI_CR_RST_STATE);
+	XQspiPs_Enable(instance);
+}
+
+/// @brief I/O mode for commands.
+static void enter_io_mode(void)
+{
+	XQspiPs *instance = &qspi;
+
+	XQspiPs_Disable(instance);
+	XQspiPs_SetOptions(instance, XQSPIPS_FORCE_SSELECT_OPTION | XQSPIPS_MANUAL_START_OPTION | XQSPIPS_HOLD_B_DRIVE_OPTION);
+	XQspiPs_SetSlaveSelect(instance);
+	XQspiPs_Enable(instance);
+}
+
+static int write_enable(void)
+{
+	u8 cmd = XQSPIPS_FLASH_OPCODE_WREN;
+	return XQspiPs_PolledTransfer(&qspi, &cmd, NULL, 1);
+}
+
+static int wait_ready(void)
+{
+	u8 cmd[2] = { XQSPIPS_FLASH_OPCODE_RDSR1, 0 };
+	u8 status[2];
+
+	do
+	{
+		if (XQspiPs_PolledTransfer(&qspi, cmd, status, sizeof(cmd)) != XST_SUCCESS)
+		{
+			return XST_FAILURE;
+		}
+	} while (status[1] & STATUS_WIP_MASK);
+
+	return XST_SUCCESS;
+}
+
+static void set_header(u8 *buf, u8 opcode, u32 offset)
+{
+	u32 address = PARAM_STORE_FLASH_OFFSET + offset;
+
+	buf[0] = opcode;
+	buf[1] = (u8)(address >> 16);
+	buf[2] = (u8)(address >> 8);
+	buf[3] = (u8)address;
+}
+
+static int qspi_read(u32 offset, void *buf, u32 len)
+{
+	return XQspiPs_LqspiRead(&qspi, (u8 *)buf, PARAM_STORE_FLASH_OFFSET + offset, len);
+}
+
+static int qspi_program(u32 offset, const void *buf, u32 len)
+{
+	// Records are 32 bytes and aligned, so they never cross a 256 byte page.
+	u8 tx[CMD_HEADER_SIZE + sizeof(ParamRecord_t)];
+	int status;
+
+	if (len > sizeof(ParamRecord_t))
+	{
+		return XST_FAILURE;
+	}
+
+	set_header(tx, XQSPIPS_FLASH_OPCODE_PP, offset);
+	memcpy(&tx[CMD_HEADER_SIZE], buf, len);
+
+	enter_io_mode();
+	status = write_enable();
+	if (status == XST_SUCCESS)
+	{
+		status = XQspiPs_PolledTransfer(&qspi, tx, NULL, CMD_HEADER_SIZE + len);
+	}
+	if (status == XST_SUCCESS)
+	{
+		status = wait_ready();
+	}
+	enter_linear_mode();
+
+	Xil_DCacheInvalidateRange(XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR + PARAM_STORE_FLASH_OFFSET + offset, len);
+	return status;
+}
+
+static int qspi_erase(u32 offset)
+{
+	u8 tx[CMD_HEADER_SIZE];
+	int status;
+
+	set_header(tx, XQSPIPS_FLASH_OPCODE_SE, offset);
+
+	enter_io_mode();
+	status = write_enable();
+	if (status == XST_SUCCESS)
+	{
+		status = XQspiPs_PolledTransfer(&qspi, tx, NULL, sizeof(tx));
+	}
+	if (status == XST_SUCCESS)
+	{
+		status = wait_ready();
+	}
+	enter_linear_mode();
+
+	Xil_DCacheInvalidateRange(XPAR_PS7_QSPI_LINEAR_0_S_AXI_BASEADDR + PARAM_STORE_FLASH_OFFSET + offset, PARAM_STORE_SECTOR_SIZE);
+	return status;
+}
+
+const ParamFlash_t *ParamQspi_Init(void)
+{
+	XQspiPs_Config *config = XQspiPs_LookupConfig(XPAR_PS7_QSPI_0_DEVICE_ID);
+
+	if (config == NULL || XQspiPs_CfgInitialize(&qspi, config, config->BaseAddress) != XST_SUCCESS)
+	{
+		return NULL;
+	}
+
+	XQspiPs_SetClkPrescaler(&qspi, XQSPIPS_CLK_PRESCALE_8);
+	enter_linear_mode();
+
+	qspi_flash.sector_size = PARAM_STORE_SECTOR_SIZE;
+	qspi_flash.sector_count = PARAM_STORE_SECTOR_COUNT;
+	qspi_flash.read = qspi_read;
+	qspi_flash.program = qspi_program;
+	qspi_flash.erase = qspi_erase;
+	return &qspi_flash;
+}
@@ -0,0 +1,15 @@
+/**
+ * @file param_store_qspi.h
+ * @brief QSPI flash backend for the parameter store.
+ */
+
+#ifndef PARAM_STORE_QSPI_H
+#define PARAM_STORE_QSPI_H
+
+#include "param_store.h"
+
+/// @brief Sets up the QSPI controller in linear mode.
+/// @return Backend for ParamStore_Init, NULL if the controller could not be initialised.
+const ParamFlash_t *ParamQspi_Init(void);
+
+#endif
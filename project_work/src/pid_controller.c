@@ -0,0 +1,81 @@
+/**
+ * @file pid_controller.c
+ * @brief The PID control law. Free of FreeRTOS and driver calls, so the same code
+ * runs in control_task, on the second core in AMP mode and in host builds.
+ */
+
+#include "pid_controller.h"
+
+// Step size for integration. Mathced with "sampling interval"
+static const float h = PID_SAMPLE_TIME_MS / 1000.0f;
+
+/// @brief This is the PID controller function
+/// @param plant voltage, ref voltage, Kp, Ki, Kd, ref, reset, PID state structure
+/// @return PI controller output
+// This function was refactored couple days before the return to be reentrant and to use the
+// controller state struct to store the state of the controller.
+// This was done due to input from course assistant in a short meeting.
+// Help with the refactoring came from Claude AI, but the implementation is by -R.M.
+float PID_controller(float u_meas, float u_ref, float Kd, float Ki, float Kp, uint32_t reset, PIDControllerState_t *state){
+
+	// If reset command sent, reset all!
+	if(reset){
+		state->err = 0;
+		state->err_prev_1 = 0;
+		state->err_prev_2 = 0;
+		state->yi_prev = 0;
+		state->yp = 0;
+		state->yi = 0;
+		state->yd = 0;
+		state->PI_out = 0;
+	}
+
+	// Saturation limits
+	float u_max = 400.0;
+	float u_min = 0.0;
+
+	state->err = u_ref - u_meas; // Calculate the error value
+
+	// Calculate
+	// YP //
+	state->yp = Kp * state->err;
+	// YI //
+	state->yi = Ki * (h / 2) * (state->err + state->err_prev_1) + state->yi_prev;
+
+	// YD //
+	// Calculate mean for the d to reduce noise.
+	float err_d = ((state->err - state->err_prev_1) + (state->err_prev_1 - state->err_prev_2)) / 2;
+	state->yd = Kd * (err_d) / h;
+
+	// Anti-winding for integrator (https://codepal.ai/code-generator/query/MjweSyOx/pid-regulator-with-anti-windup)
+	if (state->yi > WINDUP_LIMIT)
+	{
+		state->yi = WINDUP_LIMIT;
+	}
+	else if (state->yi < -WINDUP_LIMIT)
+	{
+		state->yi = -WINDUP_LIMIT;
+	}
+
+	float unsat_out = state->yp + state->yi + state->yd;
+
+	// Saturate the output of the controller
+	state->PI_out = unsat_out;
+
+	if (state->PI_out > u_max)
+	{
+		state->PI_out = u_max;
+	}
+	else if (state->PI_out < u_min)
+	{
+		state->PI_out = u_min;
+	}
+
+	// Update the old values
+	state->yi_prev = state->yi;
+	// yd_prev = yd;
+	state->err_prev_2 = state->err_prev_1;
+	state->err_prev_1 = state->err;
+
+	return state->PI_out;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file pid_controller.h
+ * @brief The PID control law and its state.
+ */
+
+#ifndef PID_CONTROLLER_H
+#define PID_CONTROLLER_H
+
+#include <stdint.h>
+
+// Sampling interval of the control law in ms. Must match controller_interval.
+#define PID_SAMPLE_TIME_MS 1
+
+// Windup limit for the controller
+#define WINDUP_LIMIT 405.0f
+
+typedef struct {
+	float err;
+	float err_prev_1;
+	float err_prev_2;
+	float yi_prev;
+	float yp;
+	float yi;
+	float yd;
+	float PI_out;
+} PIDControllerState_t;
+
+float PID_controller(float u_meas, float u_ref, float Kd, float Ki, float Kp, uint32_t reset, PIDControllerState_t *state);
+
+#endif
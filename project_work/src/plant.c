@@ -4,31 +4,17 @@
  */
 
 #include "plant.h"
+#include "plant_model.h"
+#include "pwm_output.h"
 #include "arm_math.h"
 #include "system_params.h"
 #include "zynq_registers.h"
 #include <xttcps.h>
 #include <stdint.h>
-
-// Discretized model copied from assignment instruction sheet:
-static const float A_matrix[6][6] = {{0.9652, -0.0172, 0.0057, -0.0058, 0.0052, -0.0251},
-									{0.7732, 0.1252, 0.2315, 0.07, 0.1282, 0.7754},
-									{0.8278, -0.7522, -0.0956, 0.3299, -0.4855, 0.3915},
-									{0.9948, 0.2655, -0.3848, 0.4212, 0.3927, 0.2899},
-									{0.7648, -0.4165, -0.4855, -0.3366, -0.0986, 0.7281},
-									{1.1056, 0.7587, 0.1179, 0.0748, -0.2192, 0.1491}};
-
-static const float B_matrix[6][1] = {{0.0471},
-									{0.0377},
-									{0.0404},
-									{0.0485},
-									{0.0375},
-									{0.0539}};
-
-// static const float C_matrix[1][6] = 	{{0,0,0,0,0,1}};
+#include <string.h>
 
 // This was changed from [6][1] to [6] because the [1] seemed redundant and produced an error
-static float current_state[6] = 		{0,0,0,0,0,0};
+static float current_state[PLANT_STATE_SIZE] = 		{0,0,0,0,0,0};
 
 // STATICV variables for input and output.
 static volatile float u_out_plant;
@@ -65,21 +51,41 @@ static void setPlantOutputVoltage(float u_out){
 	 }
 }
 
-/// @brief Calculates the plant response based on the input signal.
+/// @brief Advances the plant model by one step.
 /// @param u_in The input signal to the plant.
 /// @return The output response of the plant.
-void plant_model_task(void *pvParameters) {
-	// Matrix multiplication implementation using CMSIS DSP library
-	// Implementing this:
-	// current_state = A_matrix*current_state + B_matrix*u_in;
+float plantModelStep(float u_in) {
+	float next_state[PLANT_STATE_SIZE];
+
+	memcpy(next_state, current_state, sizeof(next_state));
+	float u_out = PlantModel_Step(next_state, u_in);
+
+	// Swap the new state in at once, a snapshot may be reading it from another task.
+	taskENTER_CRITICAL();
+	memcpy(current_state, next_state, sizeof(current_state));
+	taskEXIT_CRITICAL();
+
+	return u_out;
+}
+
+/// @brief Copies the plant state, e.g. for a warm-restart snapshot.
+void getPlantState(float *state)
+{
+	taskENTER_CRITICAL();
+	memcpy(state, current_state, sizeof(current_state));
+	taskEXIT_CRITICAL();
+}
 
-	// Initialize matrices
-	arm_matrix_instance_f32 MatA;
-	arm_mat_init_f32(&MatA, 6, 6, (float *)A_matrix);
+/// @brief Overwrites the plant state, e.g. when a warm-restart snapshot is restored.
+void setPlantState(const float *state)
+{
+	taskENTER_CRITICAL();
+	memcpy(current_state, state, sizeof(current_state));
+	taskEXIT_CRITICAL();
+}
 
-	// Initialize Temporary result matrices
-	float Ax_result[6]; // Result of A*current_state
-	float Bu_result[6]; // Result of B*u_in
+/// @brief This is the plant model task. Steps the plant with the controller output.
+void plant_model_task(void *pvParameters) {
 
 	TickType_t xLastWakeTime;
 	const TickType_t xInterval = pdMS_TO_TICKS(plant_interval);
@@ -97,32 +103,13 @@ void plant_model_task(void *pvParameters) {
 		// DEBUG:
 		// float temp_u_in = 100; // Forced input without controller.
 
-		// static float current_state[6][1]; // I dont think this should be here? (M.H.)
-											 // Me neither. (I.L.)
-
-		/*** First calculate Ax=A*current_state ***/
-
-		// ARM Matrix and vector multiplication function
-		arm_mat_vec_mult_f32(&MatA, current_state, Ax_result);
-
-		/*** Then calculate Bu=B*u_in ***/
-
-		// ARM scale function to multiply matrix B by scalar u_in
-		arm_scale_f32((float *)B_matrix, temp_u_in, Bu_result, 6);
-
-		/*** Finally calculate current_state = Ax + Bu ***/
-
-		// ARM vector addition function which gives us the current_state
-		arm_add_f32(Ax_result, Bu_result, current_state, 6);
+		float u_out = plantModelStep(temp_u_in);
 
 		// the output u_out
-		setPlantOutputVoltage(current_state[5]); // !NOT! defined locally (I.L.)
+		setPlantOutputVoltage(u_out);
 
-		// Obtain brightness from the output voltage.
-		// Scaled from 0-> TARGET + 100 V and to the 16bit integer value (not anymore)
-		uint16_t LED_brightness = (uint16_t)((current_state[5]/(max_out_plant))*65532);
-
-		updatePWMBrightness(LED_brightness);
+		// Show the output voltage as LED brightness. Scaling and clamping is done in updatePWMBrightness.
+		updatePWMBrightness(u_out);
 
 		// return u_out; // Don't return nothing. We use "global" (protected) variables and semaphores to transfer data in  the system.
 
@@ -131,20 +118,16 @@ void plant_model_task(void *pvParameters) {
 	}
 }
 
-void updatePWMBrightness(uint16_t Count_Value){
-	// Read the interrupt status to clear the interrupt.
-	// TTC0_ISR: Triple Timer Counter (TTC) 0 - Interrupt Status Register (ISR)
-	// TTC0_ISR; // Cleared on read
-
-	// AXI_LED_DATA ^= 0x8;
+/// @brief Maps the plant output voltage to the RGB LED brightness.
+/// Goes through the shadowed PWM output stage, so the match registers are only
+/// written on the plant steps where the value actually changes.
+/// @param u_out Plant output voltage, 0 -> max_out_plant is full scale.
+void updatePWMBrightness(float u_out){
+	float duty = u_out / max_out_plant;
 
-	// COURSE EXAMPLE:
-	// &TTC0_MATCH_0
-	// const u32* ptr_match_register = &TTC0_MATCH_0;
-	// *ptr_register = match_value++;
+	PWM_OutputSetDuty(PWM_TTC0_1, duty);		// Order: R, G, B
+	PWM_OutputSetDuty(PWM_TTC0_2, duty / 2);	// Divided by 2
+	// PWM_OutputSetDuty(PWM_TTC0_3, duty / 4); // Divided by 4
 
-	// Here we adjust the counter count value to have an effect on the PWM output to the RGB LED
-	TTC0_MATCH_1 = Count_Value;	// Order: R, G, B
-	TTC0_MATCH_1_COUNTER_2 = (Count_Value >> 1); // Divided by 2
-	// TTC0_MATCH_1_COUNTER_3 = Count_Value >> 2; // Divided by 4
+	PWM_OutputCommit();
 }
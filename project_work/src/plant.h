@@ -20,9 +20,15 @@
  */
 #include "arm_math.h"
 
+// PLANT_STATE_SIZE
+#include "plant_model.h"
+
 /* Function Prototypes */
 // This allows other files (like main.c) to call your plant function
 void plant_model_task(void *pvParameters);
-void updatePWMBrightness(uint16_t Count_Value);
+void updatePWMBrightness(float u_out);
+float plantModelStep(float u_in);
+void getPlantState(float *state);
+void setPlantState(const float *state);
 
 #endif
@@ -0,0 +1,65 @@
+/**
+ * @file plant_model.c
+ * @brief The discretized converter model. See plant_model.h.
+ */
+
+#include "plant_model.h"
+#include "arm_math.h"
+#include <string.h>
+
+// Discretized model copied from assignment instruction sheet:
+static const float A_matrix[6][6] = {{0.9652, -0.0172, 0.0057, -0.0058, 0.0052, -0.0251},
+									{0.7732, 0.1252, 0.2315, 0.07, 0.1282, 0.7754},
+									{0.8278, -0.7522, -0.0956, 0.3299, -0.4855, 0.3915},
+									{0.9948, 0.2655, -0.3848, 0.4212, 0.3927, 0.2899},
+									{0.7648, -0.4165, -0.4855, -0.3366, -0.0986, 0.7281},
+									{1.1056, 0.7587, 0.1179, 0.0748, -0.2192, 0.1491}};
+
+static const float B_matrix[6][1] = {{0.0471},
+									{0.0377},
+									{0.0404},
+									{0.0485},
+									{0.0375},
+									{0.0539}};
+
+// static const float C_matrix[1][6] = 	{{0,0,0,0,0,1}};
+
+// A matrix as a CMSIS DSP matrix instance for arm_mat_vec_mult_f32.
+static const arm_matrix_instance_f32 MatA = {PLANT_STATE_SIZE, PLANT_STATE_SIZE, (float32_t *)A_matrix};
+
+float PlantModel_Step(float *state, float u_in)
+{
+	// Matrix multiplication implementation using CMSIS DSP library
+	// Implementing this:
+	// state = A_matrix*state + B_matrix*u_in;
+
+	// Initialize Temporary result matrices
+	float Ax_result[PLANT_STATE_SIZE]; // Result of A*state
+	float Bu_result[PLANT_STATE_SIZE]; // Result of B*u_in
+
+	/*** First calculate Ax=A*state ***/
+
+	// ARM Matrix and vector multiplication function
+	arm_mat_vec_mult_f32(&MatA, state, Ax_result);
+
+	/*** Then calculate Bu=B*u_in ***/
+
+	// ARM scale function to multiply matrix B by scalar u_in
+	arm_scale_f32((float *)B_matrix, u_in, Bu_result, PLANT_STATE_SIZE);
+
+	/*** Finally calculate state = Ax + Bu ***/
+
+	// ARM vector addition function which gives us the new state
+	arm_add_f32(Ax_result, Bu_result, state, PLANT_STATE_SIZE);
+
+	return state[5];
+}
+
+void PlantModel_GetMatrices(float a[PLANT_STATE_SIZE][PLANT_STATE_SIZE], float b[PLANT_STATE_SIZE])
+{
+	memcpy(a, A_matrix, sizeof(A_matrix));
+	for (int i = 0; i < PLANT_STATE_SIZE; i++)
+	{
+		b[i] = B_matrix[i][0];
+	}
+}
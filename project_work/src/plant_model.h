@@ -0,0 +1,23 @@
+/**
+ * @file plant_model.h
+ * @brief The discretized converter model without any RTOS or driver calls.
+ *
+ * plant.c steps it in plant_model_task, the AMP loop on the second core and the
+ * host tools step their own copy of the state.
+ */
+
+#ifndef PLANT_MODEL_H
+#define PLANT_MODEL_H
+
+// Number of states in the discretized converter model
+#define PLANT_STATE_SIZE 6
+
+/// @brief Advances the model by one step: state = A * state + B * u_in.
+/// @param state PLANT_STATE_SIZE states, updated in place.
+/// @return The output voltage, the last state.
+float PlantModel_Step(float *state, float u_in);
+
+/// @brief Copies the nominal A and B matrices, for host tools that step perturbed copies.
+void PlantModel_GetMatrices(float a[PLANT_STATE_SIZE][PLANT_STATE_SIZE], float b[PLANT_STATE_SIZE]);
+
+#endif
@@ -0,0 +1,169 @@
+/**
+ * @file pwm_output.c
+ * @brief Shadowed PWM output stage. See pwm_output.h.
+ */
+
+#include "pwm_output.h"
+
+#ifndef PWM_OUTPUT_HOST_MOCK
+#include "xparameters.h"
+#include "zynq_registers.h"
+#include "PWM.h"
+#include <xttcps.h>
+#endif
+
+typedef struct {
+	u32 staged;			// Value to be written on the next commit
+	u32 hw;				// Value the register currently holds
+	u32 full_scale;		// Register value for duty = 1.0
+	float dither_err;	// Fraction carried over to the next commit when dithering
+	bool set;			// SetDuty called since the last commit
+} PwmShadow_t;
+
+static PwmShadow_t shadow[PWM_CHANNEL_COUNT];
+static PwmOutputStats_t stats;
+static u32 refresh_interval = PWM_DEFAULT_REFRESH_INTERVAL;
+static u32 commits_since_refresh = 0;
+static bool dithering = false;
+
+#ifdef PWM_OUTPUT_HOST_MOCK
+static u32 mock_registers[PWM_CHANNEL_COUNT];
+
+u32 PWM_OutputMockRegister(PwmChannel_t channel)
+{
+	return mock_registers[channel];
+}
+#endif
+
+/// @brief The only place that touches the bus.
+static void write_register(PwmChannel_t channel, u32 value)
+{
+#ifdef PWM_OUTPUT_HOST_MOCK
+	mock_registers[channel] = value;
+#else
+	switch (channel)
+	{
+	case PWM_TTC0_1:
+		TTC0_MATCH_1 = value;
+		break;
+	case PWM_TTC0_2:
+		TTC0_MATCH_1_COUNTER_2 = value;
+		break;
+	case PWM_TTC0_3:
+		TTC0_MATCH_1_COUNTER_3 = value;
+		break;
+	default:
+		PWM_Set_Duty(XPAR_PWM_RGB_PWM_AXI_BASEADDR, value, channel - PWM_AXI_0);
+		break;
+	}
+#endif
+	shadow[channel].hw = value;
+	stats.written++;
+}
+
+void PWM_OutputInit(void)
+{
+#ifndef PWM_OUTPUT_HOST_MOCK
+	PWM_Set_Period(XPAR_PWM_RGB_PWM_AXI_BASEADDR, PWM_AXI_PERIOD);
+	PWM_Enable(XPAR_PWM_RGB_PWM_AXI_BASEADDR);
+#endif
+
+	for (int i = 0; i < PWM_CHANNEL_COUNT; i++)
+	{
+		shadow[i].full_scale = (i < PWM_AXI_0) ? PWM_TTC_FULL_SCALE : PWM_AXI_PERIOD;
+		shadow[i].staged = 0;
+		shadow[i].dither_err = 0;
+		shadow[i].set = false;
+		write_register((PwmChannel_t)i, 0);
+	}
+
+	stats = (PwmOutputStats_t){0};
+	commits_since_refresh = 0;
+}
+
+void PWM_OutputSetRefreshInterval(u32 commits)
+{
+	refresh_interval = commits;
+	commits_since_refresh = 0;
+}
+
+void PWM_OutputSetDithering(bool enable)
+{
+	dithering = enable;
+	for (int i = 0; i < PWM_CHANNEL_COUNT; i++)
+	{
+		shadow[i].dither_err = 0;
+	}
+}
+
+void PWM_OutputSetDuty(PwmChannel_t channel, float duty)
+{
+	PwmShadow_t *s = &shadow[channel];
+
+	// Clamp. A negative plant voltage used to wrap around in the uint16 cast.
+	if (duty < 0.0f)
+	{
+		duty = 0.0f;
+	}
+	else if (duty > 1.0f)
+	{
+		duty = 1.0f;
+	}
+
+	float value = duty * (float)s->full_scale;
+
+	if (dithering)
+	{
+		// Error feedback: the part lost to rounding is added to the next value, so
+		// the average over several commits carries the fraction as well.
+		value += s->dither_err;
+		u32 rounded = (u32)(value + 0.5f);
+		if (rounded > s->full_scale)
+		{
+			rounded = s->full_scale;
+		}
+		s->dither_err = value - (float)rounded;
+		s->staged = rounded;
+	}
+	else
+	{
+		s->staged = (u32)(value + 0.5f);
+	}
+
+	s->set = true;
+}
+
+void PWM_OutputCommit(void)
+{
+	bool refresh = false;
+
+	stats.commits++;
+
+	// Periodic rewrite of everything, in case a register was disturbed.
+	if (refresh_interval != 0 && ++commits_since_refresh >= refresh_interval)
+	{
+		commits_since_refresh = 0;
+		refresh = true;
+	}
+
+	for (int i = 0; i < PWM_CHANNEL_COUNT; i++)
+	{
+		PwmShadow_t *s = &shadow[i];
+
+		if (s->set)
+		{
+			stats.requested++;
+			s->set = false;
+		}
+
+		if (refresh || s->staged != s->hw)
+		{
+			write_register((PwmChannel_t)i, s->staged);
+		}
+	}
+}
+
+void PWM_OutputGetStats(PwmOutputStats_t *out)
+{
+	*out = stats;
+}
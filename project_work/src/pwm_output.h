@@ -0,0 +1,69 @@
+/**
+ * @file pwm_output.h
+ * @brief Shadowed PWM output stage.
+ *
+ * Duty cycles are staged into shadow copies and PWM_OutputCommit() only issues a bus
+ * write for the channels whose register value actually changed (or when the periodic
+ * refresh is due). Covers all three TTC0 counters and the custom PWM_v1_0 IP.
+ *
+ * Build with PWM_OUTPUT_HOST_MOCK defined to replace the registers with an in-memory
+ * mock, e.g. to measure the write reduction on a PC.
+ */
+
+#ifndef PWM_OUTPUT_H
+#define PWM_OUTPUT_H
+
+#include "xil_types.h"
+#include <stdbool.h>
+
+typedef enum {
+	PWM_TTC0_1 = 0,		// TTC0 counter 1 -> RGB LED red
+	PWM_TTC0_2 = 1,		// TTC0 counter 2 -> RGB LED green
+	PWM_TTC0_3 = 2,		// TTC0 counter 3 -> RGB LED blue
+	PWM_AXI_0 = 3,		// PWM_v1_0 IP (PWM_RGB) outputs
+	PWM_AXI_1 = 4,
+	PWM_AXI_2 = 5,
+	PWM_CHANNEL_COUNT
+} PwmChannel_t;
+
+// Full scale match value of the 16-bit TTC counters.
+#define PWM_TTC_FULL_SCALE		0xFFFF
+// Period of the PWM_v1_0 IP in clocks. Same resolution as the TTC by default.
+#define PWM_AXI_PERIOD			0xFFFF
+
+// Default forced refresh: rewrite every channel once per this many commits even
+// if nothing changed. 0 disables the refresh.
+#define PWM_DEFAULT_REFRESH_INTERVAL	1000
+
+typedef struct {
+	u32 commits;		// Number of PWM_OutputCommit() calls
+	u32 requested;		// Register writes an unshadowed implementation would have done
+	u32 written;		// Register writes actually issued
+} PwmOutputStats_t;
+
+/// @brief Writes zero to every channel and syncs the shadows with the hardware.
+void PWM_OutputInit(void);
+
+/// @brief Number of commits between forced rewrites of all channels, 0 = only on change.
+void PWM_OutputSetRefreshInterval(u32 commits);
+
+/// @brief Enables dithering of the fractional LSB between commits (error feedback).
+/// Gives more effective resolution than 16 bits when averaged over several periods,
+/// at the cost of more register writes.
+void PWM_OutputSetDithering(bool enable);
+
+/// @brief Stages a new duty cycle for one channel. Nothing is written until PWM_OutputCommit().
+/// @param duty 0.0 - 1.0, clamped.
+void PWM_OutputSetDuty(PwmChannel_t channel, float duty);
+
+/// @brief Writes all staged channels whose register value changed, in one batch.
+void PWM_OutputCommit(void);
+
+void PWM_OutputGetStats(PwmOutputStats_t *stats);
+
+#ifdef PWM_OUTPUT_HOST_MOCK
+/// @brief Current value of the mocked register of a channel.
+u32 PWM_OutputMockRegister(PwmChannel_t channel);
+#endif
+
+#endif
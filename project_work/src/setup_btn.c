@@ -6,11 +6,15 @@
 #include "ui_control.h"
 #include "controller.h"
 #include "system_params.h"
+#include "button_events.h"
 
 XGpio BTNS_SWTS;
 
 void SetupPushButtons()
 {
+    // Event queues have to exist before the first button interrupt.
+    ButtonEvents_Init();
+
     XGpio_Initialize(&BTNS_SWTS, BUTTONS_AXI_ID);
     XGpio_InterruptEnable(&BTNS_SWTS, 0xF);
     XGpio_InterruptGlobalEnable(&BTNS_SWTS);
@@ -29,29 +33,10 @@ void SetupPushButtons()
 
 void PushButtons_Intr_Handler(void *data)
 {
-    // Handle button press to chantge system mode
-
-	static TickType_t last_button_time = 0;
-	const TickType_t debounce_delay = pdMS_TO_TICKS(200); // 200ms debounce
-
-	// Read button states
-    u32 button_states = XGpio_DiscreteRead(&BTNS_SWTS, BUTTONS_channel);
-
-    // start debounce timer and check it
-    TickType_t current_time = xTaskGetTickCount();
-    if (current_time - last_button_time < debounce_delay) {
-    	XGpio_InterruptClear(&BTNS_SWTS, 0xF);
-    	return;
-    }
-
-    last_button_time = current_time;
-
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-
-    // create a notify to ui_control task that will handle the necessary operations
-    // Change to this tasknotify method allows for the button ISR to be shorter, suggestion for this implementation came from Claude AI. Implementation is by -R.M.
-	xTaskNotifyFromISR(ui_control_task_handle, button_states, eSetBits, &xHigherPriorityTaskWoken);
-    XGpio_InterruptClear(&BTNS_SWTS,0xF);
-    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
-
+    // This runs as the FIQ, so it only captures the button state with a hardware timestamp.
+    // Debounce, long-press and repeat detection happen in the UI task (Button_Handler).
+    // xTaskGetTickCount() and the old eSetBits notify were removed: the first is not ISR-safe
+    // and the second merged quick presses into a single notification.
+    ButtonEvents_CaptureFromISR(XGpio_DiscreteRead(&BTNS_SWTS, BUTTONS_channel));
+    XGpio_InterruptClear(&BTNS_SWTS, 0xF);
 }
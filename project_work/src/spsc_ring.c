@@ -0,0 +1,65 @@
+/**
+ * @file spsc_ring.c
+ * @brief Lock-free single-producer / single-consumer ring buffer.
+ */
+
+#include "spsc_ring.h"
+#include <string.h>
+
+bool SpscRing_Init(SpscRing_t *ring, void *storage, uint32_t capacity, uint32_t item_size)
+{
+	// Power of two capacity lets us wrap the free running indexes with a mask.
+	if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+	{
+		return false;
+	}
+
+	ring->head = 0;
+	ring->tail = 0;
+	ring->mask = capacity - 1;
+	ring->item_size = item_size;
+	ring->storage = (uint8_t *)storage;
+	return true;
+}
+
+bool SpscRing_Push(SpscRing_t *ring, const void *item)
+{
+	// Head is ours, tail is read with acquire so we see the slot the consumer has freed.
+	uint32_t head = ring->head;
+	uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+	if ((head - tail) > ring->mask)
+	{
+		// Full
+		return false;
+	}
+
+	memcpy(&ring->storage[(head & ring->mask) * ring->item_size], item, ring->item_size);
+
+	// Release: the item must be visible before the new head is.
+	__atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+bool SpscRing_Pop(SpscRing_t *ring, void *item)
+{
+	uint32_t tail = ring->tail;
+	uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+	if (head == tail)
+	{
+		// Empty
+		return false;
+	}
+
+	memcpy(item, &ring->storage[(tail & ring->mask) * ring->item_size], ring->item_size);
+
+	// Release: the slot is copied out before the producer may reuse it.
+	__atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+uint32_t SpscRing_Count(const SpscRing_t *ring)
+{
+	return __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+}
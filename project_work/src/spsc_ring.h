@@ -0,0 +1,44 @@
+/**
+ * @file spsc_ring.h
+ * @brief Lock-free single-producer / single-consumer ring buffer.
+ *
+ * One side only ever writes head, the other only ever writes tail, so no
+ * mutex or critical section is needed. This makes it safe to push from an
+ * ISR and pop from a task (or the other way around).
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Cortex-A9 L1 cache line size. Head and tail are kept on separate lines so the
+// producer and consumer do not keep stealing the same line from each other.
+#define SPSC_CACHE_LINE 32
+
+typedef struct {
+	volatile uint32_t head __attribute__((aligned(SPSC_CACHE_LINE))); // Written only by the producer
+	volatile uint32_t tail __attribute__((aligned(SPSC_CACHE_LINE))); // Written only by the consumer
+	uint32_t mask;		// capacity - 1, capacity must be a power of two
+	uint32_t item_size;	// Size of one item in bytes
+	uint8_t *storage;	// capacity * item_size bytes, provided by the caller
+} SpscRing_t;
+
+/// @brief Initialises the ring on top of caller provided storage.
+/// @param capacity Number of items, must be a power of two.
+/// @return false if the capacity is not a power of two.
+bool SpscRing_Init(SpscRing_t *ring, void *storage, uint32_t capacity, uint32_t item_size);
+
+/// @brief Producer side. Copies one item into the ring.
+/// @return false if the ring is full (the item is dropped).
+bool SpscRing_Push(SpscRing_t *ring, const void *item);
+
+/// @brief Consumer side. Copies the oldest item out of the ring.
+/// @return false if the ring is empty.
+bool SpscRing_Pop(SpscRing_t *ring, void *item);
+
+/// @brief Number of items currently in the ring. Exact only when called from one of the two sides.
+uint32_t SpscRing_Count(const SpscRing_t *ring);
+
+#endif
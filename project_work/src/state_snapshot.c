@@ -0,0 +1,108 @@
+/**
+ * @file state_snapshot.c
+ * @brief Warm-restart snapshot of the controller and plant state. See state_snapshot.h.
+ */
+
+#include "state_snapshot.h"
+#include "controller.h"
+#include "plant.h"
+#include "crc32.h"
+#include <string.h>
+
+// Version 1 layout is 19 floats. Catch accidental changes to the structs it is built from.
+_Static_assert(sizeof(ControlSnapshot_t) == 19 * sizeof(float), "Snapshot layout changed, bump SNAPSHOT_VERSION");
+
+// Survives a watchdog / soft reset since .noinit is not zeroed by the startup code.
+// After power up it holds garbage, which the CRC rejects.
+static u8 retained_blob[SNAPSHOT_BLOB_SIZE] __attribute__((section(".noinit"), aligned(4)));
+
+u32 Snapshot_Encode(const ControlSnapshot_t *snap, void *blob, u32 blob_size)
+{
+	SnapshotHeader_t header;
+	u8 *out = (u8 *)blob;
+
+	if (blob_size < SNAPSHOT_BLOB_SIZE)
+	{
+		return 0;
+	}
+
+	header.magic = SNAPSHOT_MAGIC;
+	header.version = SNAPSHOT_VERSION;
+	header.size = sizeof(ControlSnapshot_t);
+	header.crc = Crc32(snap, sizeof(ControlSnapshot_t));
+
+	memcpy(out, &header, sizeof(header));
+	memcpy(out + sizeof(header), snap, sizeof(ControlSnapshot_t));
+	return SNAPSHOT_BLOB_SIZE;
+}
+
+int Snapshot_Decode(const void *blob, u32 blob_size, ControlSnapshot_t *snap)
+{
+	SnapshotHeader_t header;
+	const u8 *in = (const u8 *)blob;
+
+	if (blob_size < sizeof(header))
+	{
+		return XST_FAILURE;
+	}
+	memcpy(&header, in, sizeof(header));
+
+	if (header.magic != SNAPSHOT_MAGIC || header.version == 0 || header.version > SNAPSHOT_VERSION ||
+		header.size > sizeof(ControlSnapshot_t) || blob_size < sizeof(header) + header.size ||
+		Crc32(in + sizeof(header), header.size) != header.crc)
+	{
+		return XST_FAILURE;
+	}
+
+	// Older versions only have a prefix of the fields.
+	memset(snap, 0, sizeof(*snap));
+	memcpy(snap, in + sizeof(header), header.size);
+	return XST_SUCCESS;
+}
+
+int Snapshot_Capture(ControlSnapshot_t *snap)
+{
+	if (getControllerSnapshot(snap) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+	getPlantState(snap->plant_state);
+	return XST_SUCCESS;
+}
+
+void Snapshot_Apply(const ControlSnapshot_t *snap)
+{
+	restoreControllerSnapshot(snap);
+	setPlantState(snap->plant_state);
+}
+
+void Snapshot_Retain(void)
+{
+	ControlSnapshot_t snap;
+
+	// A failed read would retain garbage gains with a valid CRC, keep the last good one.
+	if (Snapshot_Capture(&snap) == XST_SUCCESS)
+	{
+		Snapshot_Encode(&snap, retained_blob, sizeof(retained_blob));
+	}
+}
+
+void Snapshot_CopyRetained(u8 *blob)
+{
+	// The control task may be refreshing it, take it in one piece.
+	taskENTER_CRITICAL();
+	memcpy(blob, retained_blob, sizeof(retained_blob));
+	taskEXIT_CRITICAL();
+}
+
+int Snapshot_RestoreRetained(void)
+{
+	ControlSnapshot_t snap;
+
+	if (Snapshot_Decode(retained_blob, sizeof(retained_blob), &snap) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+	Snapshot_Apply(&snap);
+	return XST_SUCCESS;
+}
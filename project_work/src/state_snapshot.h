@@ -0,0 +1,69 @@
+/**
+ * @file state_snapshot.h
+ * @brief Warm-restart snapshot of the controller and plant state.
+ *
+ * A snapshot holds the PID state, plant state, gains, reference and the last
+ * controller output. It is encoded into a small versioned, CRC'd binary blob that
+ * can be kept in RAM (the .noinit section survives a watchdog / soft reset),
+ * written to flash, or loaded by the host replay tool. Encode, decode and restore
+ * are plain copies, O(state size).
+ */
+
+#ifndef STATE_SNAPSHOT_H
+#define STATE_SNAPSHOT_H
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "system_params.h"
+#include "plant.h"
+
+#define SNAPSHOT_MAGIC		0x534E4150	// "SNAP"
+#define SNAPSHOT_VERSION	1			// Bump when fields change meaning. New fields go to the end.
+
+typedef struct {
+	PIDControllerState_t pid;
+	float plant_state[PLANT_STATE_SIZE];
+	float kp;
+	float ki;
+	float kd;
+	float u_ref;
+	float u_out;		// Last controller output
+} ControlSnapshot_t;
+
+typedef struct {
+	u32 magic;
+	u16 version;
+	u16 size;			// Payload size in bytes, lets newer code read older (shorter) blobs
+	u32 crc;			// CRC-32 of the payload
+} SnapshotHeader_t;
+
+#define SNAPSHOT_BLOB_SIZE	(sizeof(SnapshotHeader_t) + sizeof(ControlSnapshot_t))
+
+/// @brief Encodes a snapshot into blob.
+/// @return Number of bytes written, 0 if blob_size is too small.
+u32 Snapshot_Encode(const ControlSnapshot_t *snap, void *blob, u32 blob_size);
+
+/// @brief Decodes and checks a blob. Fields missing from an older version are zeroed.
+/// @return XST_SUCCESS, or XST_FAILURE if magic, version, size or CRC don't match.
+int Snapshot_Decode(const void *blob, u32 blob_size, ControlSnapshot_t *snap);
+
+/// @brief Collects a snapshot from the running controller and plant. Call from the control task.
+/// @return XST_SUCCESS, or XST_FAILURE if the controller parameters could not be read.
+int Snapshot_Capture(ControlSnapshot_t *snap);
+
+/// @brief Loads a snapshot into the controller and plant.
+/// Call from the control task or before the scheduler is started.
+void Snapshot_Apply(const ControlSnapshot_t *snap);
+
+/// @brief Captures a snapshot into the reset-surviving RAM area.
+/// The previous one is kept if the capture fails.
+void Snapshot_Retain(void);
+
+/// @brief Copies the latest retained blob (SNAPSHOT_BLOB_SIZE bytes), e.g. to print it.
+void Snapshot_CopyRetained(u8 *blob);
+
+/// @brief Restores the snapshot left in RAM by the previous run, if any.
+/// @return XST_SUCCESS if a valid snapshot was found and applied.
+int Snapshot_RestoreRetained(void);
+
+#endif
@@ -21,14 +21,15 @@
 extern TaskHandle_t control_task_handle;
 extern TaskHandle_t plant_model_task_handle;
 extern TaskHandle_t ui_control_task_handle;
+extern TaskHandle_t fra_task_handle;
+extern TaskHandle_t meas_task_handle;
+extern TaskHandle_t log_task_handle;
 
 // Task loop intervals in ticks! Check tickrate for conversion to ms. Currently tickrate is 10 kHz -> 1 tick = 1/10 000 s -> 0.1 ms.
 #define controller_interval 1
 #define ui_interval 100
 #define plant_interval 1
 
-// Windup limit for the controller
-#define WINDUP_LIMIT 405.0f
 
 // A flag used to control if modulation print is active or not
 // REPLACED WITH "GLOBAL" SYSTEM MODES!
@@ -56,16 +57,8 @@ typedef enum {
     MODE_MODULATION = 2
 } SystemMode_t;
 
-typedef struct {
-	float err;
-	float err_prev_1;
-	float err_prev_2;
-	float yi_prev;
-	float yp;
-	float yi;
-	float yd;
-	float PI_out;
-} PIDControllerState_t;
+// PIDControllerState_t and WINDUP_LIMIT
+#include "pid_controller.h"
 
 typedef enum {
     PARAM_KP = 0,
@@ -4,6 +4,7 @@
 // We will call the Timer Tickhandler PWM coltrol from controller.c file.
 #include "controller.h"
 #include "zynq_registers.h"
+#include "pwm_output.h"
 
 #include <xttcps.h>
 #include <stdint.h>
@@ -51,9 +52,8 @@ void SetupPWMTimer() {
 
 	// Match value register - TTC0_MATCH_x
 	//     1. Initialize match value to 0
-	TTC0_MATCH_1           = 0;
-	TTC0_MATCH_1_COUNTER_2 = 0;
-	TTC0_MATCH_1_COUNTER_3 = 0;
+	// Done through the PWM output stage so its shadow copies start in sync with the registers.
+	PWM_OutputInit();
 
 
 	//DEBUG:
@@ -0,0 +1,297 @@
+/**
+ * @file trajectory.c
+ * @brief Reference trajectories for u_ref. See trajectory.h.
+ */
+
+#include "trajectory.h"
+#include "spsc_ring.h"
+#include <math.h>
+#include <string.h>
+
+// A move is the step through the acceleration and jerk stages, kept in the table as the
+// transition g, and then through the rate stage: p(k) = p(k - 1) + (g(k) - g(k - n)) / n.
+// That last moving average is the running difference above, so the rate stage, which is
+// what makes long moves long, needs no table and the move length is not limited by it.
+typedef struct {
+	u32 generation;		// Trajectory_Cancel generation it belongs to
+	u32 length;			// Points of the transition, the last one is 1
+	u32 rate_steps;		// n, steps of the rate stage
+	double inv_rate_steps;
+	u32 hold;			// Steps to stay at the end value afterwards
+	float start;
+	float distance;		// Signed, target - start
+	float end;
+	float transition[TRAJ_TABLE_SIZE];
+} TrajTable_t;
+
+static TrajTable_t tables[TRAJ_TABLE_COUNT];
+
+// Table indexes: filled ones to the control task, played ones back to the UI side.
+static u32 ready_storage[TRAJ_TABLE_COUNT];
+static u32 free_storage[TRAJ_TABLE_COUNT];
+static SpscRing_t ready_ring;
+static SpscRing_t free_ring;
+static volatile bool rings_ready = false;
+
+static TrajLimits_t limits = { 0, 0, 0 };
+static volatile u32 generation = 0;		// +1 per cancel, older tables are dropped
+
+// Control task side
+static TrajTable_t *playing = NULL;
+static u32 play_step;
+static double play_fraction;	// p(play_step - 1), 0 to 1. Double: summed over the whole move.
+static u32 hold_left;
+static volatile u32 position_bits;	// Last sample. Raw bits so it can go through a plain atomic store.
+
+// Segments pushed by the UI side and given back by the control task, busy while they differ.
+static volatile u32 queued_segments = 0;
+static volatile u32 done_segments = 0;
+
+static void init_rings(void)
+{
+	SpscRing_Init(&ready_ring, ready_storage, TRAJ_TABLE_COUNT, sizeof(u32));
+	SpscRing_Init(&free_ring, free_storage, TRAJ_TABLE_COUNT, sizeof(u32));
+	for (u32 i = 0; i < TRAJ_TABLE_COUNT; i++)
+	{
+		SpscRing_Push(&free_ring, &i);
+	}
+	__atomic_store_n(&rings_ready, true, __ATOMIC_RELEASE);
+}
+
+/// @brief Steps a stage needs so the next derivative stays within limit: the peak the
+/// previous stage reaches divided by the limit. 1 is a pass-through.
+static u32 stage_length(float peak, float limit)
+{
+	if (!(limit > 0))
+	{
+		return 1;
+	}
+
+	// Slightly below the exact count, so 10 V at 10 V/s is 1000 steps and not 1001.
+	float n = ceilf(peak / limit * TRAJ_SAMPLE_RATE - 1e-3f);
+	return (n > 1.0f) ? (u32)n : 1;
+}
+
+/// @brief Moving average of length n over x[0..len), with x[k < 0] taken as 0.
+/// Runs from the end backwards so it can work in place.
+static void moving_average(float *x, u32 len, u32 n)
+{
+	double sum = 0;
+
+	if (n <= 1)
+	{
+		return;
+	}
+	for (u32 k = (len > n) ? len - n : 0; k < len; k++)
+	{
+		sum += x[k];
+	}
+	for (u32 k = len; k-- > 0;)
+	{
+		float current = x[k];
+		x[k] = (float)(sum / n);
+		sum -= current;
+		if (k >= n)
+		{
+			sum += x[k - n];
+		}
+	}
+}
+
+/// @brief Fills a free table with start -> target and stamps it with the given generation.
+static int fill_table(float start, float target, u32 hold_ms, u32 table_generation)
+{
+	u32 n1 = 1;
+	u32 n2 = 1;
+	u32 n3 = 1;
+	u32 index;
+
+	// Stage lengths in steps: n1 keeps the rate, n2 the acceleration, n3 the jerk.
+	if (limits.rate > 0)
+	{
+		n1 = stage_length(fabsf(target - start), limits.rate);
+		n2 = stage_length(limits.rate, limits.accel);
+		if (limits.accel > 0)
+		{
+			n3 = stage_length(limits.accel, limits.jerk);
+		}
+	}
+
+	u32 length = n2 + n3 - 1;
+	if (length > TRAJ_TABLE_SIZE)
+	{
+		return XST_FAILURE;
+	}
+
+	if (!rings_ready)
+	{
+		init_rings();
+	}
+	if (!SpscRing_Pop(&free_ring, &index))
+	{
+		return XST_FAILURE;
+	}
+
+	TrajTable_t *table = &tables[index];
+	for (u32 k = 0; k < length; k++)
+	{
+		table->transition[k] = 1.0f;
+	}
+	moving_average(table->transition, length, n2);
+	moving_average(table->transition, length, n3);
+	table->transition[length - 1] = 1.0f;
+
+	table->length = length;
+	table->rate_steps = n1;
+	table->inv_rate_steps = 1.0 / n1;
+	table->hold = hold_ms / PID_SAMPLE_TIME_MS;
+	table->start = start;
+	table->distance = target - start;
+	table->end = target;
+	table->generation = table_generation;
+
+	__atomic_store_n(&queued_segments, queued_segments + 1, __ATOMIC_RELEASE);
+	SpscRing_Push(&ready_ring, &index);
+	return XST_SUCCESS;
+}
+
+int Trajectory_SetLimits(const TrajLimits_t *new_limits)
+{
+	if (new_limits->rate < 0 || new_limits->accel < 0 || new_limits->jerk < 0)
+	{
+		return XST_FAILURE;
+	}
+	limits = *new_limits;
+	return XST_SUCCESS;
+}
+
+void Trajectory_GetLimits(TrajLimits_t *out)
+{
+	*out = limits;
+}
+
+bool Trajectory_Enabled(void)
+{
+	return limits.rate > 0;
+}
+
+int Trajectory_Queue(float start, float target, u32 hold_ms)
+{
+	return fill_table(start, target, hold_ms, __atomic_load_n(&generation, __ATOMIC_ACQUIRE));
+}
+
+int Trajectory_Replace(float start, float target, u32 hold_ms)
+{
+	// Stamped with the next generation: it waits behind the current segment until the
+	// cancel below, which drops everything older in one go.
+	u32 next = __atomic_load_n(&generation, __ATOMIC_ACQUIRE) + 1;
+
+	if (fill_table(start, target, hold_ms, next) != XST_SUCCESS)
+	{
+		return XST_FAILURE;
+	}
+	__atomic_store_n(&generation, next, __ATOMIC_RELEASE);
+	return XST_SUCCESS;
+}
+
+void Trajectory_Cancel(void)
+{
+	__atomic_store_n(&generation, generation + 1, __ATOMIC_RELEASE);
+}
+
+float Trajectory_Position(void)
+{
+	u32 bits = __atomic_load_n(&position_bits, __ATOMIC_ACQUIRE);
+	float position;
+
+	memcpy(&position, &bits, sizeof(position));
+	return position;
+}
+
+bool Trajectory_Busy(void)
+{
+	return __atomic_load_n(&queued_segments, __ATOMIC_ACQUIRE) != __atomic_load_n(&done_segments, __ATOMIC_ACQUIRE);
+}
+
+/// @brief true if the table was queued before the last cancel.
+static bool stale(const TrajTable_t *table, u32 current_generation)
+{
+	return (s32)(table->generation - current_generation) < 0;
+}
+
+/// @brief Gives the playing table back to the UI side.
+static void release_playing(void)
+{
+	u32 index = (u32)(playing - tables);
+
+	SpscRing_Push(&free_ring, &index);
+	__atomic_store_n(&done_segments, done_segments + 1, __ATOMIC_RELEASE);
+	playing = NULL;
+}
+
+/// @brief g(k) of the playing table: 0 before the move, 1 after the transition.
+static float transition_at(s32 k)
+{
+	if (k < 0)
+	{
+		return 0.0f;
+	}
+	return ((u32)k < playing->length) ? playing->transition[k] : 1.0f;
+}
+
+float Trajectory_Sample(float u_ref)
+{
+	float out = u_ref;
+
+	if (__atomic_load_n(&rings_ready, __ATOMIC_ACQUIRE))
+	{
+		u32 current_generation = __atomic_load_n(&generation, __ATOMIC_ACQUIRE);
+		u32 index;
+
+		if (playing != NULL && stale(playing, current_generation))
+		{
+			release_playing();
+		}
+		// Next segment, dropping cancelled ones. Bounded by the pool size.
+		while (playing == NULL && SpscRing_Pop(&ready_ring, &index))
+		{
+			playing = &tables[index];
+			play_step = 0;
+			play_fraction = 0;
+			hold_left = playing->hold;
+			if (stale(playing, current_generation))
+			{
+				release_playing();
+			}
+		}
+
+		if (playing != NULL)
+		{
+			// The last step lands on the end value exactly, whatever the rounding on the way.
+			if (play_step + 1 < playing->length + playing->rate_steps - 1)
+			{
+				s32 k = (s32)play_step;
+				play_fraction += (transition_at(k) - transition_at(k - (s32)playing->rate_steps)) * playing->inv_rate_steps;
+				out = playing->start + playing->distance * (float)play_fraction;
+				play_step++;
+			}
+			else
+			{
+				out = playing->end;
+				if (hold_left > 0)
+				{
+					hold_left--;
+				}
+				else
+				{
+					release_playing();
+				}
+			}
+		}
+	}
+
+	u32 bits;
+	memcpy(&bits, &out, sizeof(bits));
+	__atomic_store_n(&position_bits, bits, __ATOMIC_RELEASE);
+	return out;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file trajectory.h
+ * @brief Reference trajectories for u_ref: rate limited ramps and S-curves.
+ *
+ * A move is precomputed into a table when it is queued, so control_task only reads
+ * one sample per step. The shape is a step through a cascade of moving averages
+ * (rate, then acceleration, then jerk stage): each stage bounds the next derivative
+ * and the move ends exactly on the target. Only the acceleration / jerk transition is
+ * tabulated, so TRAJ_TABLE_SIZE limits rate / accel + accel / jerk, not the move length.
+ *
+ * Tables come from a pool of TRAJ_TABLE_COUNT. Queued segments play back to back, a
+ * segment can hold its end value for a while before the next one starts. Queuing
+ * happens from the UI side under controller_params_MUTEX (see controller.c),
+ * Trajectory_Sample from the control task; the two only meet in SpscRings.
+ */
+
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "pid_controller.h"
+#include <stdbool.h>
+
+#define TRAJ_TABLE_SIZE		4096	// Transition steps per segment, 4.096 s at 1 kHz
+#define TRAJ_TABLE_COUNT	8		// Segments in flight, power of two
+#define TRAJ_SAMPLE_RATE	(1000.0f / PID_SAMPLE_TIME_MS)
+
+typedef struct {
+	float rate;		// V/s, 0 disables shaping (instant steps)
+	float accel;	// V/s^2, 0 for a plain ramp
+	float jerk;		// V/s^3, 0 to leave the acceleration steps in
+} TrajLimits_t;
+
+/// @brief Limits used by the following Trajectory_Queue calls.
+/// @return XST_FAILURE if a limit is negative.
+int Trajectory_SetLimits(const TrajLimits_t *limits);
+
+void Trajectory_GetLimits(TrajLimits_t *limits);
+
+/// @brief true when setpoint changes should go through a trajectory (rate > 0).
+bool Trajectory_Enabled(void);
+
+/// @brief Precomputes start -> target and queues it behind the segments already queued.
+/// @param hold_ms Time to stay at target before the next segment.
+/// @return XST_FAILURE if no table is free or the transition doesn't fit TRAJ_TABLE_SIZE.
+int Trajectory_Queue(float start, float target, u32 hold_ms);
+
+/// @brief Like Trajectory_Queue, but the running and queued segments are dropped as soon
+/// as the new one is in place. Used to retarget a move without a gap in between.
+int Trajectory_Replace(float start, float target, u32 hold_ms);
+
+/// @brief Drops the running and queued segments from the next control step on.
+void Trajectory_Cancel(void);
+
+/// @brief Reference the control task used last, where a new move should start from.
+float Trajectory_Position(void);
+
+/// @brief Control task side, once per step. O(1).
+/// @param u_ref Returned when no segment is playing.
+float Trajectory_Sample(float u_ref);
+
+/// @brief true while a segment is playing or queued.
+bool Trajectory_Busy(void);
+
+#endif
@@ -7,6 +7,15 @@
 #include "controller.h"
 #include "ui_control.h"
 #include "system_params.h"
+#include "param_store.h"
+#include "state_snapshot.h"
+#include "gain_schedule.h"
+#include "freq_analyser.h"
+#include "meas_source_xadc.h"
+#include "log_backend_sd.h"
+#include "boot_profile.h"
+#include "trajectory.h"
+#include "xtime_l.h"
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
@@ -20,6 +29,251 @@ static char rx_buffer[UART_RX_BUFFER_SIZE];
 static volatile int rx_buffer_index = 0;
 
 static void UART_ExecuteCommand(char *cmd);
+static void UART_ProcessChar(char c);
+
+// Lookups timed by "schedule bench"
+#define SCHEDULE_BENCH_ROUNDS 1000
+
+/// @brief Reads the next numeric token of the command being parsed.
+/// @return 0 if the token is missing.
+static int next_float(float *value)
+{
+	char *value_str = strtok(NULL, " \t");
+
+	if (value_str == NULL)
+	{
+		return 0;
+	}
+	*value = atof(value_str);
+	return 1;
+}
+
+/// @brief Handles "schedule ..." and "pt ..." i.e. loading and inspecting the gain-schedule table.
+/// @param token The command token, "schedule" or "pt".
+static void UART_ScheduleCommand(const char *token)
+{
+	GainScheduleGrid_t grid;
+	PIDGains_t gains;
+	float n;
+	char *sub;
+
+	// pt <kp> <ki> <kd>: next point of the table being loaded
+	if (strcmp(token, "pt") == 0)
+	{
+		if (!next_float(&gains.kp) || !next_float(&gains.ki) || !next_float(&gains.kd) ||
+			GainSchedule_AddPoint(&gains) != XST_SUCCESS)
+		{
+			xil_printf("\r\nInvalid usage.\r\n");
+			return;
+		}
+		xil_printf("\r\nok\r\n");
+		return;
+	}
+
+	sub = strtok(NULL, " \t");
+	if (sub == NULL)
+	{
+		xil_printf("\r\nInvalid usage.\r\n");
+		return;
+	}
+
+	if (strcmp(sub, "ref") == 0 || strcmp(sub, "meas") == 0 || strcmp(sub, "2d") == 0)
+	{
+		// Loading is only allowed in config mode, like the other parameters.
+		if (!uart_in_config)
+		{
+			xil_printf("\r\nNot in Serial Config mode. Type 'config' first! \r\n");
+			return;
+		}
+
+		grid.axis = (strcmp(sub, "ref") == 0) ? SCHEDULE_AXIS_REF :
+					(strcmp(sub, "meas") == 0) ? SCHEDULE_AXIS_MEAS : SCHEDULE_AXIS_BOTH;
+		grid.y0 = 0;
+		grid.y_step = 0;
+		grid.ny = 1;
+
+		if (!next_float(&grid.x0) || !next_float(&grid.x_step) || !next_float(&n))
+		{
+			xil_printf("\r\nInvalid usage.\r\n");
+			return;
+		}
+		grid.nx = (u32)n;
+
+		if (grid.axis == SCHEDULE_AXIS_BOTH)
+		{
+			if (!next_float(&grid.y0) || !next_float(&grid.y_step) || !next_float(&n))
+			{
+				xil_printf("\r\nInvalid usage.\r\n");
+				return;
+			}
+			grid.ny = (u32)n;
+		}
+
+		if (GainSchedule_Begin(&grid) != XST_SUCCESS)
+		{
+			xil_printf("\r\nInvalid table size.\r\n");
+			return;
+		}
+		xil_printf("\r\nSend %d points with 'pt <kp> <ki> <kd>', then 'schedule commit'.\r\n", (int)(grid.nx * grid.ny));
+	}
+	else if (strcmp(sub, "commit") == 0)
+	{
+		if (GainSchedule_Commit() == XST_SUCCESS)
+		{
+			xil_printf("\r\nGain schedule active.\r\n");
+		}
+		else
+		{
+			xil_printf("\r\nError: table incomplete, nothing changed.\r\n");
+		}
+	}
+	else if (strcmp(sub, "abort") == 0)
+	{
+		GainSchedule_Abort();
+		xil_printf("\r\nTable load aborted.\r\n");
+	}
+	else if (strcmp(sub, "off") == 0)
+	{
+		GainSchedule_Disable();
+		xil_printf("\r\nGain schedule off, using fixed parameters.\r\n");
+	}
+	else if (strcmp(sub, "show") == 0)
+	{
+		if (GainSchedule_GetGrid(&grid) != XST_SUCCESS)
+		{
+			xil_printf("\r\nNo gain schedule, using fixed parameters.\r\n");
+			return;
+		}
+		xil_printf("\r\nGain schedule: %s, %d x %d points\r\n",
+				   grid.axis == SCHEDULE_AXIS_REF ? "ref" : grid.axis == SCHEDULE_AXIS_MEAS ? "meas" : "2d",
+				   (int)grid.nx, (int)grid.ny);
+		xil_printf("x: from %d mV in steps of %d mV\r\n", (int)(grid.x0 * 1000), (int)(grid.x_step * 1000));
+		if (grid.axis == SCHEDULE_AXIS_BOTH)
+		{
+			xil_printf("y: from %d mV in steps of %d mV\r\n", (int)(grid.y0 * 1000), (int)(grid.y_step * 1000));
+		}
+	}
+	else if (strcmp(sub, "bench") == 0)
+	{
+		// Per-sample cost of the lookup, measured with the global timer.
+		volatile float sink = 0;
+		XTime start, end;
+
+		if (GainSchedule_GetGrid(&grid) != XST_SUCCESS)
+		{
+			xil_printf("\r\nNo gain schedule loaded.\r\n");
+			return;
+		}
+
+		XTime_GetTime(&start);
+		for (int i = 0; i < SCHEDULE_BENCH_ROUNDS; i++)
+		{
+			float v = (float)(i % 400);
+			GainSchedule_Lookup(v, v, &gains);
+			sink += gains.kp;
+		}
+		XTime_GetTime(&end);
+		(void)sink;
+
+		// The global timer runs at half the CPU clock.
+		xil_printf("\r\nLookup: %d ns, %d CPU cycles\r\n",
+				   (int)((end - start) * 1000000000ULL / COUNTS_PER_SECOND / SCHEDULE_BENCH_ROUNDS),
+				   (int)((end - start) * 2 / SCHEDULE_BENCH_ROUNDS));
+	}
+	else
+	{
+		xil_printf("\r\nInvalid usage.\r\n");
+	}
+}
+
+/// @brief Handles "profile ..." i.e. the reference trajectory limits and multi-segment profiles.
+static void UART_ProfileCommand(void)
+{
+	char *sub = strtok(NULL, " \t");
+	TrajLimits_t limits;
+
+	if (sub == NULL)
+	{
+		xil_printf("\r\nInvalid usage.\r\n");
+		return;
+	}
+
+	Trajectory_GetLimits(&limits);
+
+	// profile limits <rate> [accel] [jerk]: 0 rate is instant steps, 0 accel / jerk leaves that stage out
+	if (strcmp(sub, "limits") == 0)
+	{
+		TrajLimits_t new_limits = { 0, 0, 0 };
+
+		if (!next_float(&new_limits.rate))
+		{
+			xil_printf("\r\nInvalid usage.\r\n");
+			return;
+		}
+		next_float(&new_limits.accel);
+		next_float(&new_limits.jerk);
+		if (Trajectory_SetLimits(&new_limits) != XST_SUCCESS)
+		{
+			xil_printf("\r\nInvalid usage.\r\n");
+			return;
+		}
+		xil_printf("\r\nTrajectory limits set.\r\n");
+	}
+	else if (strcmp(sub, "show") == 0)
+	{
+		xil_printf("\r\nRate: %d V/s | Accel: %d V/s^2 | Jerk: %d V/s^3 | %s\r\n",
+				   (int)limits.rate, (int)limits.accel, (int)limits.jerk,
+				   Trajectory_Busy() ? "running" : "idle");
+	}
+	else if (strcmp(sub, "off") == 0)
+	{
+		stopTargetProfile();
+		xil_printf("\r\nProfile stopped at %d mV.\r\n", (int)(Trajectory_Position() * 1000));
+	}
+	// profile <target>[@hold_ms] ...: segments played back to back
+	else if (getSystemMode() != MODE_MODULATION)
+	{
+		xil_printf("\r\n Not in modulation mode. Profile not started! \r\n");
+	}
+	else if (!Trajectory_Enabled())
+	{
+		xil_printf("\r\nSet the limits first: profile limits <rate> [accel] [jerk]\r\n");
+	}
+	else
+	{
+		float targets[TRAJ_TABLE_COUNT];
+		u32 holds[TRAJ_TABLE_COUNT];
+		u32 count = 0;
+
+		for (; sub != NULL; sub = strtok(NULL, " \t"))
+		{
+			char *hold = strchr(sub, '@');
+
+			if (count == TRAJ_TABLE_COUNT)
+			{
+				xil_printf("\r\nAt most %d segments.\r\n", TRAJ_TABLE_COUNT);
+				return;
+			}
+			targets[count] = atof(sub);
+			holds[count] = (hold != NULL) ? (u32)atoi(hold + 1) : 0;
+			if (targets[count] < 0 || targets[count] > 400)
+			{
+				xil_printf("\r\nInvalid usage.\r\n");
+				return;
+			}
+			count++;
+		}
+
+		if (runTargetProfile(targets, holds, count) == XST_SUCCESS)
+		{
+			xil_printf("\r\nProfile of %d segments started.\r\n", (int)count);
+		}
+		else
+		{
+			xil_printf("\r\nProfile too long for the limits, not started.\r\n");
+		}
+	}
+}
 
 void SetupUART(void)
 {
@@ -87,12 +341,27 @@ void UART_SendHelp(void)
 	xil_printf("modulation		- Change to MODULATION mode\r\n");
 	xil_printf("idle			- Change to IDLE mode\r\n");
 	xil_printf("exit			- Exit to IDLE mode\r\n");
+	xil_printf("save			- Save parameters, target voltage and mode to flash\r\n");
+	xil_printf("snapshot		- Print the warm-restart snapshot (hex, for host/replay)\r\n");
+	xil_printf("boot			- Print the boot profile (for host/boot_check)\r\n");
 	xil_printf("------------------\r\n");
 	xil_printf("Following commands available only in config mode:\r\n");
 	xil_printf("setparam <param> <value> - Set parameter (kp, ki, kd) value (0-100)\r\n");
+	xil_printf("schedule ref|meas <v0> <step> <n> - Load a gain schedule over target / plant voltage\r\n");
+	xil_printf("schedule 2d <ref0> <step> <n> <meas0> <step> <n> - Load a 2-D gain schedule\r\n");
+	xil_printf("pt <kp> <ki> <kd> - Next table point, then 'schedule commit' (or 'abort')\r\n");
+	xil_printf("------------------\r\n");
+	xil_printf("schedule show|off|bench - Show / disable / time the gain schedule\r\n");
+	xil_printf("fra start <amplitude> - Measure the loop response, tone amplitude in V\r\n");
+	xil_printf("fra stop        - Stop the frequency-response measurement\r\n");
+	xil_printf("meas start|stop|stats - XADC measurement instead of the plant model / statistics\r\n");
+	xil_printf("log start|stop|stats - Record every control sample to the SD card / statistics\r\n");
+	xil_printf("profile limits <rate> [accel] [jerk] - Shape target changes, V/s (0 = steps)\r\n");
+	xil_printf("profile show|off - Show the limits / stop where the reference is\r\n");
 	xil_printf("------------------\r\n");
 	xil_printf("Following commands available only in modulation mode:\r\n");
 	xil_printf("setvoltage <value> - Set target voltage (0-400)\r\n");
+	xil_printf("profile <v>[@hold_ms] ... - Run target segments (0-400) with the trajectory limits\r\n");
 	xil_printf("\r\n\r\n");
 }
 
@@ -135,6 +404,13 @@ static void UART_ExecuteCommand(char *cmd)
 	}
 
 
+	// Command: boot
+	// Read only, like help.
+	if (strcmp(token, "boot") == 0){
+		BootProfile_Report();
+		return;
+	}
+
 	// IF parameter semaphore is not taken, we can change params.
 	if( cooldown_semaphore_take() != pdTRUE){
 		// Debug:
@@ -219,6 +495,163 @@ static void UART_ExecuteCommand(char *cmd)
 			setSystemMode(MODE_IDLE);
 		}
 
+		// Command: save
+		// Store parameters, target voltage and mode so they survive a power cycle.
+		// Restored at boot in main.c.
+		else if (strcmp(token, "save") == 0)
+		{
+			ParamValues_t values;
+
+			values.mode = getSystemMode();
+
+			// Nothing is written unless every value was read.
+			if (getParameters(&values.kp, &values.ki, &values.kd) == XST_SUCCESS &&
+				getTargetVoltage(&values.u_ref) == XST_SUCCESS &&
+				ParamStore_Save(&values) == XST_SUCCESS)
+			{
+				xil_printf("\r\nParameters saved to flash.\r\n");
+			}
+			else
+			{
+				xil_printf("\r\nError while saving the parameters to flash.\r\n");
+			}
+		}
+
+		// Command: snapshot
+		// Dump the controller / plant snapshot so a field run can be replayed on a PC.
+		else if (strcmp(token, "snapshot") == 0)
+		{
+			u8 blob[SNAPSHOT_BLOB_SIZE];
+
+			Snapshot_CopyRetained(blob);
+			xil_printf("\r\n");
+			for (u32 i = 0; i < SNAPSHOT_BLOB_SIZE; i++)
+			{
+				xil_printf("%02X", blob[i]);
+			}
+			xil_printf("\r\n");
+		}
+
+		// Command: schedule / pt
+		// Gain-schedule table, loaded as schedule <grid> + pt lines + schedule commit
+		// EXAMPLE schedule ref 0 100 5, pt 4.5 6 0.01 (x5), schedule commit
+		else if (strcmp(token, "schedule") == 0 || strcmp(token, "pt") == 0)
+		{
+			UART_ScheduleCommand(token);
+		}
+
+		// Command: fra
+		// Frequency-response analyser. Runs only in modulation mode, results are streamed by fra_task.
+		// EXAMPLE fra start 2
+		else if (strcmp(token, "fra") == 0)
+		{
+			char *sub = strtok(NULL, " \t");
+
+			if (sub != NULL && strcmp(sub, "start") == 0)
+			{
+				if (next_float(&value) && FRA_Start(value, 1000.0f / controller_interval) == XST_SUCCESS)
+				{
+					xil_printf("\r\nFrequency-response analyser started. Results every %d blocks.\r\n", FRA_AVERAGE_BLOCKS);
+				}
+				else
+				{
+					xil_printf("\r\nInvalid usage.\r\n");
+				}
+			}
+			else if (sub != NULL && strcmp(sub, "stop") == 0)
+			{
+				FRA_Stop();
+				xil_printf("\r\nFrequency-response analyser stopped.\r\n");
+			}
+			else
+			{
+				xil_printf("\r\nInvalid usage.\r\n");
+			}
+		}
+
+		// Command: meas
+		// Feed the controller from the XADC front-end instead of the plant model.
+		else if (strcmp(token, "meas") == 0)
+		{
+			char *sub = strtok(NULL, " \t");
+
+			if (sub != NULL && strcmp(sub, "start") == 0)
+			{
+				if (MeasFrontend_Start(&MeasSourceXadc) == XST_SUCCESS)
+				{
+					xil_printf("\r\nMeasurement front-end started (%s).\r\n", MeasSourceXadc.name);
+				}
+				else
+				{
+					xil_printf("\r\nError while starting the measurement front-end.\r\n");
+				}
+			}
+			else if (sub != NULL && strcmp(sub, "stop") == 0)
+			{
+				MeasFrontend_Stop();
+				xil_printf("\r\nMeasurement front-end stopped, using the plant model.\r\n");
+			}
+			else if (sub != NULL && strcmp(sub, "stats") == 0)
+			{
+				MeasStats_t stats;
+				MeasFrontend_GetStats(&stats);
+
+				if (stats.elapsed_counts == 0)
+				{
+					return;
+				}
+				xil_printf("\r\nRaw: %d samples/s | Out: %d samples/s | Dropped blocks: %d | CPU: %d.%02d %%\r\n",
+						   (int)((u64)stats.raw_samples * COUNTS_PER_SECOND / stats.elapsed_counts),
+						   (int)((u64)stats.out_samples * COUNTS_PER_SECOND / stats.elapsed_counts),
+						   (int)stats.dropped_blocks,
+						   (int)(stats.busy_counts * 100 / stats.elapsed_counts),
+						   (int)(stats.busy_counts * 10000 / stats.elapsed_counts % 100));
+			}
+			else
+			{
+				xil_printf("\r\nInvalid usage.\r\n");
+			}
+		}
+
+		// Command: log
+		// Record every control sample to the SD card.
+		else if (strcmp(token, "log") == 0)
+		{
+			char *sub = strtok(NULL, " \t");
+
+			if (sub != NULL && strcmp(sub, "start") == 0)
+			{
+				if (DataLogger_Start(&LogBackendSd) == XST_SUCCESS)
+				{
+					xil_printf("\r\nLogging to %s.\r\n", LogBackendSd.name);
+				}
+				else
+				{
+					xil_printf("\r\nError while starting the logger.\r\n");
+				}
+			}
+			else if (sub != NULL && strcmp(sub, "stop") == 0)
+			{
+				DataLogger_Stop();
+				xil_printf("\r\nLogger stopping, the last block is written in the background.\r\n");
+			}
+			else if (sub != NULL && strcmp(sub, "stats") == 0)
+			{
+				LogStats_t stats;
+				DataLogger_GetStats(&stats);
+
+				xil_printf("\r\n%s | Samples: %d | Dropped: %d | Blocks: %d | Errors: %d | Bytes/sample: %d.%02d\r\n",
+						   stats.running ? "Running" : "Stopped",
+						   (int)stats.samples, (int)stats.dropped, (int)stats.blocks, (int)stats.write_errors,
+						   (int)(stats.samples ? stats.payload_bytes / stats.samples : 0),
+						   (int)(stats.samples ? stats.payload_bytes * 100 / stats.samples % 100 : 0));
+			}
+			else
+			{
+				xil_printf("\r\nInvalid usage.\r\n");
+			}
+		}
+
 		// Command: setparam
 		// set parameter value (only in config mode) kp, ki, kd from 0 to 100
 		// EXAMPLE setparam kp 50
@@ -284,6 +717,14 @@ static void UART_ExecuteCommand(char *cmd)
 			}
 		}
 
+		// Command: profile
+		// Reference trajectories: limits for all target changes, multi-segment profiles in modulation mode.
+		// EXAMPLE profile limits 100 1000 20000, profile 300@2000 100
+		else if (strcmp(token, "profile") == 0)
+		{
+			UART_ProfileCommand();
+		}
+
 		// Command: setvoltage
 		// set target voltage (only in modulation mode) from 0 to 400
 		// EXAMPLE setvoltage 250
@@ -329,15 +770,19 @@ static void UART_ExecuteCommand(char *cmd)
 // This function processes UART input by reading characters, buffering them, and executing commands when a newline is received.
 void UART_ProcessInput(void)
 {
-	// Read character from UART
-	char c = uart_receive();
+	char c;
 
-	// No character received
-	if (c == 0)
+	// Read characters from UART. Drain everything that has arrived since the last
+	// call, so a table sent line by line doesn't overflow the 64 byte RX FIFO.
+	while ((c = uart_receive()) != 0)
 	{
-		return;
+		UART_ProcessChar(c);
 	}
+}
 
+/// @brief Buffers one received character and executes the command at the end of a line.
+static void UART_ProcessChar(char c)
+{
 	// if character is newline
 	if (c == '\r' || c == '\n')
 	{
@@ -17,6 +17,7 @@
 #include "ui_control.h"
 #include "uart_ui.h"
 #include "system_params.h"
+#include "button_events.h"
 
 /* LUT includes. */
 #include "zynq_registers.h"
@@ -35,9 +36,6 @@ static volatile SystemMode_t current_system_mode = MODE_CONFIG;
 static volatile SystemMode_t ui_local_mode = MODE_CONFIG;
 static volatile SystemMode_t previous_mode = MODE_CONFIG;
 
-// Variable that captures the button ISR value!
-static uint32_t ulNotificationValue;
-
 // Target voltage for step changes
 static float tgt = 0;
 
@@ -110,118 +108,137 @@ void cooldown_timer_callback(TimerHandle_t cooldown_timer){
 }
 
 
-void Button_Handler(void)
+/// @brief Performs the UI action of one button press.
+/// @param buttons Bitmask of the pressed button (0x01 = button 0).
+static void Button_Action(u32 buttons)
 {
-	// Check if UART in config mode, if UART is in config mode, then buttons are disabled -> not handled -> return
-	if (xSemaphoreTake(uart_config_SEMAPHORE, 0) == pdFALSE)
-	{
-		xTaskNotifyWait(0x00, 0xFFFFFFFF, &ulNotificationValue, 0);
-		return;
-	}
-	// release the semaphore immediately
-	xSemaphoreGive(uart_config_SEMAPHORE);
-
-	// IF THERE IS A BUTTON INTERRUPT ACTIVE:
-	// NotificationValue contains the button that has caused the interrupt.
-	// Change to this tasknotify method allows for the button ISR to be shorter, suggestion for this implementation came from Claude AI. Implementation is by -R.M.
-	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &ulNotificationValue, 0) == pdTRUE)
-	{
-		// IF parameter semaphore is not taken, we can change params.
-		
-		if(cooldown_semaphore_take() == pdFALSE){
-			xTimerReset(cooldown_timer, 0);
-			//xil_printf("\r\nDBG: Button cooldown resetted... \r\n");
+	// IF parameter semaphore is not taken, we can change params.
+	
+	if(cooldown_semaphore_take() == pdFALSE){
+		xTimerReset(cooldown_timer, 0);
+		//xil_printf("\r\nDBG: Button cooldown resetted... \r\n");
+	} else {
+		// From FreeRTOS_Reference_Manual_V10.0.0.pdf -I.L.
+		if(xTimerStart(cooldown_timer, 0 ) == pdPASS){
+			/* The timer could not be set into the Active state. */
+			//xil_printf("\r\nDBG: Button 5s cooldown started... \r\n");
 		} else {
-			// From FreeRTOS_Reference_Manual_V10.0.0.pdf -I.L.
-			if(xTimerStart(cooldown_timer, 0 ) == pdPASS){
-				/* The timer could not be set into the Active state. */
-				//xil_printf("\r\nDBG: Button 5s cooldown started... \r\n");
-			} else {
-				xil_printf("Error starting the UART block timer.");
-			}
+			xil_printf("Error starting the UART block timer.");
 		}
-		
-		// IF BUTTON "0" IS PRESSED
-		// WE CHANGE SYSTEM MODE:
-		if (ulNotificationValue & 0x01){
-			// Button 0 - mode change
-			// Modulo "%" allows for looping and prevents overflow.
-			// We set the LOCAL version of the system mode. This is only used in this file.
-			// The local Should be in Sync with the "global" system mode, and through this
-			// the "global" system-mode is also updated!
-			setSystemMode((SystemMode_t)((ui_local_mode + 1) % 3));
-			xil_printf("\r\n\n");
-			xil_printf("System mode changed to: ");
-
-		// ELSE WE OPERATE INSIDE THE MODES:
-		}	else	{
+	}
+	
+	// IF BUTTON "0" IS PRESSED
+	// WE CHANGE SYSTEM MODE:
+	if (buttons & 0x01){
+		// Button 0 - mode change
+		// Modulo "%" allows for looping and prevents overflow.
+		// We set the LOCAL version of the system mode. This is only used in this file.
+		// The local Should be in Sync with the "global" system mode, and through this
+		// the "global" system-mode is also updated!
+		setSystemMode((SystemMode_t)((ui_local_mode + 1) % 3));
+		xil_printf("\r\n\n");
+		xil_printf("System mode changed to: ");
+
+	// ELSE WE OPERATE INSIDE THE MODES:
+	}	else	{
+
+		switch (ui_local_mode)
+		{
 
-			switch (ui_local_mode)
+		case MODE_MODULATION:
+			/* BUTTON "1" */
+			// Set step target voltage to 400V - set_voltage_tgt from system_params.h
+			if (buttons & 0x02)
+			{
+				setTargetVoltage(step_voltage_tgt);
+				xil_printf("\r\n");
+				xil_printf("Target voltage set to %d V!\r\n", step_voltage_tgt);
+			}
+			/* BUTTON "2" */
+			// Increase target voltage by 10V
+			else if (buttons & 0x04)
+			{
+				increaseTargetVoltage(10);
+				xil_printf("\r\nTarget voltage increased by: +10V!\r\n");
+			}
+			/* BUTTON "3" */
+			// Decrease target voltage by 10V
+			else if (buttons & 0x08)
 			{
+				decreaseTargetVoltage(10);
+				xil_printf("\r\nTarget voltage decreased by: -10V!\r\n");
+			}
+			break;
 
-			case MODE_MODULATION:
-				/* BUTTON "1" */
-				// Set step target voltage to 400V - set_voltage_tgt from system_params.h
-				if (ulNotificationValue & 0x02)
+		case MODE_CONFIG:
+			/* BUTTON "1" */
+			// toggle selected parameter (Kp, Ki, Kd)
+			if (buttons & 0x02)
+			{
+				toggleParameter();
+				ConfigParam_t param = getSelectedParameter();
+				if (param == PARAM_KP)
 				{
-					setTargetVoltage(step_voltage_tgt);
-					xil_printf("\r\n");
-					xil_printf("Target voltage set to %d V!\r\n", step_voltage_tgt);
+					xil_printf("\r\nSelected parameter: [Kp]\r\n");
 				}
-				/* BUTTON "2" */
-				// Increase target voltage by 10V
-				else if (ulNotificationValue & 0x04)
+				else if (param == PARAM_KI)
 				{
-					increaseTargetVoltage(10);
-					xil_printf("\r\nTarget voltage increased by: +10V!\r\n");
+					xil_printf("\r\nSelected parameter: [Ki]\r\n");
 				}
-				/* BUTTON "3" */
-				// Decrease target voltage by 10V
-				else if (ulNotificationValue & 0x08)
+				else
 				{
-					decreaseTargetVoltage(10);
-					xil_printf("\r\nTarget voltage decreased by: -10V!\r\n");
+					xil_printf("\r\nSelected parameter: [Kd]\r\n");
 				}
-				break;
+			}
+			/* BUTTON "2" */
+			// Increase selected parameter by 0.01
+			else if (buttons & 0x04)
+			{
+				increaseParameter(0.01);
+			}
+			/* BUTTON "3" */
+			// Decrease selected parameter by 0.01
+			else if (buttons & 0x08)
+			{
+				decreaseParameter(0.01);
+			}
+			break;
 
-			case MODE_CONFIG:
-				/* BUTTON "1" */
-				// toggle selected parameter (Kp, Ki, Kd)
-				if (ulNotificationValue & 0x02)
-				{
-					toggleParameter();
-					ConfigParam_t param = getSelectedParameter();
-					if (param == PARAM_KP)
-					{
-						xil_printf("\r\nSelected parameter: [Kp]\r\n");
-					}
-					else if (param == PARAM_KI)
-					{
-						xil_printf("\r\nSelected parameter: [Ki]\r\n");
-					}
-					else
-					{
-						xil_printf("\r\nSelected parameter: [Kd]\r\n");
-					}
-				}
-				/* BUTTON "2" */
-				// Increase selected parameter by 0.01
-				else if (ulNotificationValue & 0x04)
-				{
-					increaseParameter(0.01);
-				}
-				/* BUTTON "3" */
-				// Decrease selected parameter by 0.01
-				else if (ulNotificationValue & 0x08)
-				{
-					decreaseParameter(0.01);
-				}
-				break;
+		case MODE_IDLE:
+			// In IDLE mode, buttons 1-3 do nothing
+			break;
+		}
+	}
+}
 
-			case MODE_IDLE:
-				// In IDLE mode, buttons 1-3 do nothing
-				break;
-			}
+/// @brief Handles the button events queued by the button ISR, in the order they happened.
+void Button_Handler(void)
+{
+	ButtonEvent_t event;
+
+	// Debounce, long-press and repeat detection for everything the ISR has captured.
+	ButtonEvents_Process();
+
+	// Check if UART in config mode, if UART is in config mode, then buttons are disabled -> not handled -> return
+	if (xSemaphoreTake(uart_config_SEMAPHORE, 0) == pdFALSE)
+	{
+		ButtonEvents_Flush();
+		return;
+	}
+	// release the semaphore immediately
+	xSemaphoreGive(uart_config_SEMAPHORE);
+
+	// Every press is its own event, so quick sequences are no longer merged or lost.
+	while (ButtonEvents_Get(&event))
+	{
+		if (event.type == BTN_EVENT_PRESS)
+		{
+			Button_Action(event.button_mask);
+		}
+		// Holding button 2 or 3 keeps stepping the value up / down.
+		else if ((event.type == BTN_EVENT_LONG_PRESS || event.type == BTN_EVENT_REPEAT) && (event.button_mask & 0x0C))
+		{
+			Button_Action(event.button_mask);
 		}
 	}
 }
@@ -237,7 +254,9 @@ void ui_control_task(void *pvParameters)
 	AXI_LED_TRI = 0; // Set all LEDs as output
 	AXI_LED_DATA = LED_MODE_CONFIG; // Start with CONFIG mode LED on
 
-	UART_SendHelp(); // Send help message on startup
+#ifndef FAST_START
+	UART_SendHelp(); // Send help message on startup. Fast start sends it from boot_task.
+#endif
 
 	for (;;)
 	{
@@ -245,7 +264,7 @@ void ui_control_task(void *pvParameters)
 		// Process any UART input
 		UART_ProcessInput();
 
-		// check if notify from button ISR
+		// handle the button events queued by the button ISR
 		Button_Handler();
 
 		// switch case to handle different modes